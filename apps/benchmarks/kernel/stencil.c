@@ -0,0 +1 @@
+../../stencil/kernel/stencil.c
\ No newline at end of file
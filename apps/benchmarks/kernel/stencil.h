@@ -0,0 +1 @@
+../../stencil/kernel/stencil.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../stencil/kernel/stencil_impl.h
\ No newline at end of file
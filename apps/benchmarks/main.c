@@ -73,6 +73,12 @@
 #elif defined(ROI_ALIGN)
 #include "benchmark/roi_align.bmark"
 
+#elif defined(STENCIL)
+#include "benchmark/stencil.bmark"
+
+#elif defined(VRED)
+#include "benchmark/vred.bmark"
+
 #else
 #error                                                                         \
     "Error, no kernel was specified. Please, run 'make bin/benchmarks ENV_DEFINES=-D${KERNEL}', where KERNEL contains the kernel to benchmark. For example: 'make bin/benchmarks ENV_DEFINES=-DIMATMUL'."
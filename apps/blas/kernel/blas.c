@@ -0,0 +1,172 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// BLAS-1/2 kernels: dot products (single and batched), GEMV (row- and
+// column-major), AXPY, and NRM2.
+//
+// The float16 and int8 versions use widening multiply-accumulates: the
+// float16 products are accumulated in float32 (vfwmacc), and the int8
+// inputs are sign-extended to int16 and accumulated in int32 (vwmacc), as in
+// fconv2d_f16 and iconv2d_i8. So, the accumulation does not overflow the
+// input width.
+
+#include <math.h>
+#include <riscv_vector.h>
+#include <stddef.h>
+
+#include "blas.h"
+
+// float64
+#define BLAS_P d
+#define BLAS_TI double
+#define BLAS_TA double
+#define BLAS_VIN vfloat64m4_t
+#define BLAS_VACC vfloat64m4_t
+#define BLAS_VRED vfloat64m1_t
+#define BLAS_VSETVL vsetvl_e64m4
+#define BLAS_VSETVLMAX vsetvlmax_e64m4
+#define BLAS_LOAD(p, vl) vle64_v_f64m4(p, vl)
+#define BLAS_STORE(p, v, vl) vse64_v_f64m4(p, v, vl)
+#define BLAS_ZERO(vl) vfmv_v_f_f64m4(0, vl)
+#define BLAS_MUL(a, b, vl) vfmul_vv_f64m4(a, b, vl)
+#define BLAS_MACC(acc, a, b, vl) vfmacc_vv_f64m4(acc, a, b, vl)
+#define BLAS_MUL_VF(a, s, vl) vfmul_vf_f64m4(a, s, vl)
+#define BLAS_MACC_VF(acc, s, a, vl) vfmacc_vf_f64m4(acc, s, a, vl)
+#define BLAS_ADD(a, b, vl) vfadd_vv_f64m4(a, b, vl)
+#define BLAS_REDSUM(v, red, vl) vfredusum_vs_f64m4_f64m1(red, v, red, vl)
+#define BLAS_RED_ZERO() vfmv_v_f_f64m1(0, 1)
+#define BLAS_RED_GET(red) vfmv_f_s_f64m1_f64(red)
+#define BLAS_RED_LOAD(p) vle64_v_f64m1(p, 1)
+#define BLAS_RED_STORE(p, red) vse64_v_f64m1(p, red, 1)
+#define BLAS_RED_SCALE(red, s) vfmul_vf_f64m1(red, s, 1)
+#define BLAS_RED_MACC(red, s, a) vfmacc_vf_f64m1(red, s, a, 1)
+#define BLAS_SQRT sqrt
+#define BLAS_FULL
+#include "blas_impl.h"
+#undef BLAS_P
+#undef BLAS_TI
+#undef BLAS_TA
+#undef BLAS_VIN
+#undef BLAS_VACC
+#undef BLAS_VRED
+#undef BLAS_VSETVL
+#undef BLAS_VSETVLMAX
+#undef BLAS_LOAD
+#undef BLAS_STORE
+#undef BLAS_ZERO
+#undef BLAS_MUL
+#undef BLAS_MACC
+#undef BLAS_MUL_VF
+#undef BLAS_MACC_VF
+#undef BLAS_ADD
+#undef BLAS_REDSUM
+#undef BLAS_RED_ZERO
+#undef BLAS_RED_GET
+#undef BLAS_RED_LOAD
+#undef BLAS_RED_STORE
+#undef BLAS_RED_SCALE
+#undef BLAS_RED_MACC
+#undef BLAS_SQRT
+
+// float32
+#define BLAS_P s
+#define BLAS_TI float
+#define BLAS_TA float
+#define BLAS_VIN vfloat32m4_t
+#define BLAS_VACC vfloat32m4_t
+#define BLAS_VRED vfloat32m1_t
+#define BLAS_VSETVL vsetvl_e32m4
+#define BLAS_VSETVLMAX vsetvlmax_e32m4
+#define BLAS_LOAD(p, vl) vle32_v_f32m4(p, vl)
+#define BLAS_STORE(p, v, vl) vse32_v_f32m4(p, v, vl)
+#define BLAS_ZERO(vl) vfmv_v_f_f32m4(0, vl)
+#define BLAS_MUL(a, b, vl) vfmul_vv_f32m4(a, b, vl)
+#define BLAS_MACC(acc, a, b, vl) vfmacc_vv_f32m4(acc, a, b, vl)
+#define BLAS_MUL_VF(a, s, vl) vfmul_vf_f32m4(a, s, vl)
+#define BLAS_MACC_VF(acc, s, a, vl) vfmacc_vf_f32m4(acc, s, a, vl)
+#define BLAS_ADD(a, b, vl) vfadd_vv_f32m4(a, b, vl)
+#define BLAS_REDSUM(v, red, vl) vfredusum_vs_f32m4_f32m1(red, v, red, vl)
+#define BLAS_RED_ZERO() vfmv_v_f_f32m1(0, 1)
+#define BLAS_RED_GET(red) vfmv_f_s_f32m1_f32(red)
+#define BLAS_RED_LOAD(p) vle32_v_f32m1(p, 1)
+#define BLAS_RED_STORE(p, red) vse32_v_f32m1(p, red, 1)
+#define BLAS_RED_SCALE(red, s) vfmul_vf_f32m1(red, s, 1)
+#define BLAS_RED_MACC(red, s, a) vfmacc_vf_f32m1(red, s, a, 1)
+#define BLAS_SQRT sqrtf
+#include "blas_impl.h"
+#undef BLAS_FULL
+#undef BLAS_P
+#undef BLAS_TI
+#undef BLAS_VIN
+#undef BLAS_LOAD
+#undef BLAS_MUL
+#undef BLAS_MACC
+
+// float16 inputs, float32 accumulation
+#define BLAS_P h
+#define BLAS_TI _Float16
+#define BLAS_VIN vfloat16m2_t
+#define BLAS_LOAD(p, vl) vle16_v_f16m2(p, vl)
+#define BLAS_MUL(a, b, vl) vfwmul_vv_f32m4(a, b, vl)
+#define BLAS_MACC(acc, a, b, vl) vfwmacc_vv_f32m4(acc, a, b, vl)
+#include "blas_impl.h"
+#undef BLAS_P
+#undef BLAS_TI
+#undef BLAS_TA
+#undef BLAS_VIN
+#undef BLAS_VACC
+#undef BLAS_VRED
+#undef BLAS_VSETVL
+#undef BLAS_VSETVLMAX
+#undef BLAS_LOAD
+#undef BLAS_STORE
+#undef BLAS_ZERO
+#undef BLAS_MUL
+#undef BLAS_MACC
+#undef BLAS_MUL_VF
+#undef BLAS_MACC_VF
+#undef BLAS_ADD
+#undef BLAS_REDSUM
+#undef BLAS_RED_ZERO
+#undef BLAS_RED_GET
+#undef BLAS_RED_LOAD
+#undef BLAS_RED_STORE
+#undef BLAS_RED_SCALE
+#undef BLAS_RED_MACC
+#undef BLAS_SQRT
+
+// int8 inputs, sign-extended to int16, int32 accumulation
+#define BLAS_P i8
+#define BLAS_TI int8_t
+#define BLAS_TA int32_t
+#define BLAS_VIN vint16m2_t
+#define BLAS_VACC vint32m4_t
+#define BLAS_VRED vint32m1_t
+#define BLAS_VSETVL vsetvl_e32m4
+#define BLAS_VSETVLMAX vsetvlmax_e32m4
+#define BLAS_LOAD(p, vl) vsext_vf2_i16m2(vle8_v_i8m1(p, vl), vl)
+#define BLAS_MUL(a, b, vl) vwmul_vv_i32m4(a, b, vl)
+#define BLAS_MACC(acc, a, b, vl) vwmacc_vv_i32m4(acc, a, b, vl)
+#define BLAS_ADD(a, b, vl) vadd_vv_i32m4(a, b, vl)
+#define BLAS_REDSUM(v, red, vl) vredsum_vs_i32m4_i32m1(red, v, red, vl)
+#define BLAS_RED_ZERO() vmv_v_x_i32m1(0, 1)
+#define BLAS_RED_GET(red) vmv_x_s_i32m1_i32(red)
+#define BLAS_RED_LOAD(p) vle32_v_i32m1(p, 1)
+#define BLAS_RED_STORE(p, red) vse32_v_i32m1(p, red, 1)
+#define BLAS_RED_SCALE(red, s) vmul_vx_i32m1(red, s, 1)
+#define BLAS_RED_MACC(red, s, a) vmacc_vx_i32m1(red, s, a, 1)
+#include "blas_impl.h"
@@ -0,0 +1,72 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef _BLAS_H_
+#define _BLAS_H_
+
+#include <stdint.h>
+
+// BLAS-1/2 subset. Prefixes: d (float64), s (float32), h (float16 inputs,
+// float32 accumulation and results), i8 (int8 inputs, int32 accumulation
+// and results).
+//
+// All the matrices are dense, with leading dimension ld (in elements).
+// beta == 0 does not read y, as in the reference BLAS.
+
+// Dot product x . y
+double blas_ddot(const double *x, const double *y, uint64_t n);
+float blas_sdot(const float *x, const float *y, uint64_t n);
+float blas_hdot(const _Float16 *x, const _Float16 *y, uint64_t n);
+int32_t blas_i8dot(const int8_t *x, const int8_t *y, uint64_t n);
+
+// k dot products: out[i] = (x + i * ldx) . (y + i * ldy), each of length n.
+// ldy == 0 reuses the same y for all of them.
+void blas_ddot_batch(const double *x, uint64_t ldx, const double *y,
+                     uint64_t ldy, uint64_t n, uint64_t k, double *out);
+void blas_sdot_batch(const float *x, uint64_t ldx, const float *y,
+                     uint64_t ldy, uint64_t n, uint64_t k, float *out);
+void blas_hdot_batch(const _Float16 *x, uint64_t ldx, const _Float16 *y,
+                     uint64_t ldy, uint64_t n, uint64_t k, float *out);
+void blas_i8dot_batch(const int8_t *x, uint64_t ldx, const int8_t *y,
+                      uint64_t ldy, uint64_t n, uint64_t k, int32_t *out);
+
+// y = alpha * A * x + beta * y, A is m x n and row-major
+void blas_dgemv_rm(uint64_t m, uint64_t n, double alpha, const double *A,
+                   uint64_t lda, const double *x, double beta, double *y);
+void blas_sgemv_rm(uint64_t m, uint64_t n, float alpha, const float *A,
+                   uint64_t lda, const float *x, float beta, float *y);
+void blas_hgemv_rm(uint64_t m, uint64_t n, float alpha, const _Float16 *A,
+                   uint64_t lda, const _Float16 *x, float beta, float *y);
+void blas_i8gemv_rm(uint64_t m, uint64_t n, int32_t alpha, const int8_t *A,
+                    uint64_t lda, const int8_t *x, int32_t beta, int32_t *y);
+
+// y = alpha * A * x + beta * y, A is m x n and column-major
+void blas_dgemv_cm(uint64_t m, uint64_t n, double alpha, const double *A,
+                   uint64_t lda, const double *x, double beta, double *y);
+void blas_sgemv_cm(uint64_t m, uint64_t n, float alpha, const float *A,
+                   uint64_t lda, const float *x, float beta, float *y);
+
+// y = a * x + y
+void blas_daxpy(uint64_t n, double a, const double *x, double *y);
+void blas_saxpy(uint64_t n, float a, const float *x, float *y);
+
+// Euclidean norm of x. The sum of the squares is not scaled, so it must not
+// overflow.
+double blas_dnrm2(const double *x, uint64_t n);
+float blas_snrm2(const float *x, uint64_t n);
+
+#endif
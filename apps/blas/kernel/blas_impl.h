@@ -0,0 +1,216 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// BLAS kernels, type-generic body.
+// This file is included by blas.c once per data type, with the BLAS_* type
+// parameters defined. The accumulators are m4 registers of BLAS_TA; the
+// operands (BLAS_VIN) are as wide as BLAS_TI, or sign-extended to half of the
+// width of BLAS_TA for the int8 version. BLAS_FULL also enables the kernels
+// that are not dot products.
+
+#define _BLAS_CAT3(a, b, c) a##b##c
+#define BLAS_CAT3(a, b, c) _BLAS_CAT3(a, b, c)
+#define BLAS_NAME(name) BLAS_CAT3(blas_, BLAS_P, name)
+
+// red[0] + x . y
+// Two accumulators, fed by alternate strips, hide the latency of the
+// multiply-accumulate chain. The partial strips at the end are reduced on
+// their own, since the tail elements of the accumulators are not preserved.
+static inline BLAS_VRED BLAS_NAME(dot_red)(const BLAS_TI *x, const BLAS_TI *y,
+                                           uint64_t n, BLAS_VRED red) {
+  const size_t vlmax = BLAS_VSETVLMAX();
+  BLAS_VIN a, b;
+
+  if (n >= 2 * vlmax) {
+    a = BLAS_LOAD(x, vlmax);
+    b = (x == y) ? a : BLAS_LOAD(y, vlmax);
+    BLAS_VACC acc0 = BLAS_MUL(a, b, vlmax);
+    a = BLAS_LOAD(x + vlmax, vlmax);
+    b = (x == y) ? a : BLAS_LOAD(y + vlmax, vlmax);
+    BLAS_VACC acc1 = BLAS_MUL(a, b, vlmax);
+    x += 2 * vlmax;
+    y += 2 * vlmax;
+    n -= 2 * vlmax;
+
+    for (; n >= 2 * vlmax; n -= 2 * vlmax) {
+      a = BLAS_LOAD(x, vlmax);
+      b = (x == y) ? a : BLAS_LOAD(y, vlmax);
+      acc0 = BLAS_MACC(acc0, a, b, vlmax);
+      a = BLAS_LOAD(x + vlmax, vlmax);
+      b = (x == y) ? a : BLAS_LOAD(y + vlmax, vlmax);
+      acc1 = BLAS_MACC(acc1, a, b, vlmax);
+      x += 2 * vlmax;
+      y += 2 * vlmax;
+    }
+
+    red = BLAS_REDSUM(BLAS_ADD(acc0, acc1, vlmax), red, vlmax);
+  }
+
+  size_t vl;
+  for (; n > 0; n -= vl) {
+    vl = BLAS_VSETVL(n);
+    a = BLAS_LOAD(x, vl);
+    b = (x == y) ? a : BLAS_LOAD(y, vl);
+    red = BLAS_REDSUM(BLAS_MUL(a, b, vl), red, vl);
+    x += vl;
+    y += vl;
+  }
+
+  return red;
+}
+
+// *out = alpha * red[0] + beta * *out, with single-element vector operations,
+// so that the scalar core does not wait for the reduction
+static inline void BLAS_NAME(dot_out)(BLAS_TA *out, BLAS_VRED red,
+                                      BLAS_TA alpha, BLAS_TA beta) {
+  if (alpha != 1)
+    red = BLAS_RED_SCALE(red, alpha);
+  if (beta != 0)
+    red = BLAS_RED_MACC(red, beta, BLAS_RED_LOAD(out));
+  BLAS_RED_STORE(out, red);
+}
+
+// Partial products of one strip of the four dot products of a block
+#define BLAS_DOTS4(op, vl)                                                     \
+  do {                                                                         \
+    BLAS_VIN b0 = BLAS_LOAD(y0 + j, vl);                                       \
+    BLAS_VIN b1 = ldy ? BLAS_LOAD(y0 + ldy + j, vl) : b0;                      \
+    BLAS_VIN b2 = ldy ? BLAS_LOAD(y0 + 2 * ldy + j, vl) : b0;                  \
+    BLAS_VIN b3 = ldy ? BLAS_LOAD(y0 + 3 * ldy + j, vl) : b0;                  \
+    op(0, b0, vl);                                                             \
+    op(1, b1, vl);                                                             \
+    op(2, b2, vl);                                                             \
+    op(3, b3, vl);                                                             \
+  } while (0)
+#define BLAS_DOTS4_MUL(r, b, vl)                                               \
+  acc##r = BLAS_MUL(BLAS_LOAD(x0 + (r)*ldx + j, vl), b, vl)
+#define BLAS_DOTS4_MACC(r, b, vl)                                              \
+  acc##r = BLAS_MACC(acc##r, BLAS_LOAD(x0 + (r)*ldx + j, vl), b, vl)
+#define BLAS_DOTS4_TAIL(r, b, vl)                                              \
+  red##r = BLAS_REDSUM(BLAS_MUL(BLAS_LOAD(x0 + (r)*ldx + j, vl), b, vl),       \
+                       red##r, vl)
+
+// out[i] = alpha * (x + i * ldx) . (y + i * ldy) + beta * out[i]
+// The dot products are computed four at a time. Their accumulators are
+// independent, so the multiply-accumulate chains overlap, and the loads of y
+// are shared when ldy == 0. The results are reduced and written back without
+// moving them to the scalar core, which amortizes the final reductions.
+static void BLAS_NAME(dots)(const BLAS_TI *x, uint64_t ldx, const BLAS_TI *y,
+                            uint64_t ldy, uint64_t n, uint64_t k,
+                            BLAS_TA *out, BLAS_TA alpha, BLAS_TA beta) {
+  const size_t vlmax = BLAS_VSETVLMAX();
+  uint64_t i = 0;
+
+  for (; i + 4 <= k; i += 4) {
+    const BLAS_TI *x0 = x + i * ldx;
+    const BLAS_TI *y0 = y + i * ldy;
+    BLAS_VACC acc0, acc1, acc2, acc3;
+    BLAS_VRED red0 = BLAS_RED_ZERO(), red1 = red0, red2 = red0, red3 = red0;
+    uint64_t j = 0;
+
+    if (n >= vlmax) {
+      BLAS_DOTS4(BLAS_DOTS4_MUL, vlmax);
+      for (j = vlmax; j + vlmax <= n; j += vlmax)
+        BLAS_DOTS4(BLAS_DOTS4_MACC, vlmax);
+      red0 = BLAS_REDSUM(acc0, red0, vlmax);
+      red1 = BLAS_REDSUM(acc1, red1, vlmax);
+      red2 = BLAS_REDSUM(acc2, red2, vlmax);
+      red3 = BLAS_REDSUM(acc3, red3, vlmax);
+    }
+    if (j < n) {
+      const size_t vl = BLAS_VSETVL(n - j);
+      BLAS_DOTS4(BLAS_DOTS4_TAIL, vl);
+    }
+
+    BLAS_NAME(dot_out)(out + i, red0, alpha, beta);
+    BLAS_NAME(dot_out)(out + i + 1, red1, alpha, beta);
+    BLAS_NAME(dot_out)(out + i + 2, red2, alpha, beta);
+    BLAS_NAME(dot_out)(out + i + 3, red3, alpha, beta);
+  }
+
+  for (; i < k; ++i)
+    BLAS_NAME(dot_out)(out + i,
+                       BLAS_NAME(dot_red)(x + i * ldx, y + i * ldy, n,
+                                          BLAS_RED_ZERO()),
+                       alpha, beta);
+}
+
+BLAS_TA BLAS_NAME(dot)(const BLAS_TI *x, const BLAS_TI *y, uint64_t n) {
+  return BLAS_RED_GET(BLAS_NAME(dot_red)(x, y, n, BLAS_RED_ZERO()));
+}
+
+void BLAS_NAME(dot_batch)(const BLAS_TI *x, uint64_t ldx, const BLAS_TI *y,
+                          uint64_t ldy, uint64_t n, uint64_t k, BLAS_TA *out) {
+  BLAS_NAME(dots)(x, ldx, y, ldy, n, k, out, 1, 0);
+}
+
+// Every row of A is a dot product with x
+void BLAS_NAME(gemv_rm)(uint64_t m, uint64_t n, BLAS_TA alpha,
+                        const BLAS_TI *A, uint64_t lda, const BLAS_TI *x,
+                        BLAS_TA beta, BLAS_TA *y) {
+  BLAS_NAME(dots)(A, lda, x, 0, n, m, y, alpha, beta);
+}
+
+#ifdef BLAS_FULL
+
+// Stripmine on the rows, and accumulate the columns of A scaled by x.
+// Even and odd columns go to two accumulators, so that consecutive
+// multiply-accumulates are independent. No reduction is needed.
+void BLAS_NAME(gemv_cm)(uint64_t m, uint64_t n, BLAS_TA alpha,
+                        const BLAS_TI *A, uint64_t lda, const BLAS_TI *x,
+                        BLAS_TA beta, BLAS_TA *y) {
+  size_t vl;
+  for (uint64_t i = 0; i < m; i += vl) {
+    vl = BLAS_VSETVL(m - i);
+    BLAS_VACC acc0 = (beta != 0) ? BLAS_MUL_VF(BLAS_LOAD(y + i, vl), beta, vl)
+                                 : BLAS_ZERO(vl);
+    BLAS_VACC acc1 = BLAS_ZERO(vl);
+    uint64_t j = 0;
+    for (; j + 1 < n; j += 2) {
+      acc0 = BLAS_MACC_VF(acc0, alpha * x[j], BLAS_LOAD(A + j * lda + i, vl),
+                          vl);
+      acc1 = BLAS_MACC_VF(acc1, alpha * x[j + 1],
+                          BLAS_LOAD(A + (j + 1) * lda + i, vl), vl);
+    }
+    if (j < n)
+      acc0 = BLAS_MACC_VF(acc0, alpha * x[j], BLAS_LOAD(A + j * lda + i, vl),
+                          vl);
+    BLAS_STORE(y + i, BLAS_ADD(acc0, acc1, vl), vl);
+  }
+}
+
+void BLAS_NAME(axpy)(uint64_t n, BLAS_TA a, const BLAS_TI *x, BLAS_TA *y) {
+  size_t vl;
+  for (; n > 0; n -= vl) {
+    vl = BLAS_VSETVL(n);
+    BLAS_STORE(y, BLAS_MACC_VF(BLAS_LOAD(y, vl), a, BLAS_LOAD(x, vl), vl), vl);
+    x += vl;
+    y += vl;
+  }
+}
+
+BLAS_TA BLAS_NAME(nrm2)(const BLAS_TI *x, uint64_t n) {
+  return BLAS_SQRT(BLAS_NAME(dot)(x, x, n));
+}
+
+#endif
+
+#undef BLAS_NAME
+#undef BLAS_DOTS4
+#undef BLAS_DOTS4_MUL
+#undef BLAS_DOTS4_MACC
+#undef BLAS_DOTS4_TAIL
@@ -0,0 +1,208 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Test and benchmark of the BLAS-1/2 kernels (kernel/blas.h). Every kernel
+// is run once per data type, timed, and checked against the golden model.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel/blas.h"
+#include "runtime.h"
+#include "util.h"
+
+#ifndef SPIKE
+#include "printf.h"
+#else
+#include <stdio.h>
+#endif
+
+// Relative thresholds for the floating-point checks
+#define THRESHOLD_F64 0.000000001
+#define THRESHOLD_F32 0.0001
+
+// Scalars of AXPY and GEMV (see script/gen_data.py)
+#define ALPHA 1.5
+#define BETA 0.5
+#define ALPHA_I 3
+#define BETA_I 2
+
+extern uint64_t N;
+extern uint64_t M;
+
+#define DECLARE(T, name) extern T name[] __attribute__((aligned(4 * NR_LANES)));
+
+DECLARE(double, x_d)
+DECLARE(double, y_d)
+DECLARE(double, A_d)
+DECLARE(double, At_d)
+DECLARE(double, yg_d)
+DECLARE(float, x_s)
+DECLARE(float, y_s)
+DECLARE(float, A_s)
+DECLARE(float, At_s)
+DECLARE(float, yg_s)
+DECLARE(_Float16, x_h)
+DECLARE(_Float16, y_h)
+DECLARE(_Float16, A_h)
+DECLARE(int8_t, x_i8)
+DECLARE(int8_t, y_i8)
+DECLARE(int8_t, A_i8)
+DECLARE(int32_t, yg_i)
+DECLARE(double, dot_d)
+DECLARE(float, dot_s)
+DECLARE(float, dot_h)
+DECLARE(int32_t, dot_i8)
+DECLARE(double, nrm2_d)
+DECLARE(float, nrm2_s)
+DECLARE(double, axpy_d)
+DECLARE(float, axpy_s)
+DECLARE(double, batch_d)
+DECLARE(float, batch_s)
+DECLARE(float, batch_h)
+DECLARE(int32_t, batch_i8)
+DECLARE(double, gemv_d)
+DECLARE(float, gemv_s)
+DECLARE(float, gemv_h)
+DECLARE(int32_t, gemv_i8)
+DECLARE(double, o_d)
+DECLARE(float, o_s)
+DECLARE(int32_t, o_i)
+
+int error = 0;
+
+// Compare an output with its golden model
+void check_f(const char *name, const double *o, const double *g, uint64_t len,
+             double threshold) {
+  for (uint64_t k = 0; k < len; ++k) {
+    double t = threshold * (1 + (g[k] < 0 ? -g[k] : g[k]));
+    if (!similarity_check(o[k], g[k], t)) {
+      printf("Error (%s) at index %d. %f != %f\n", name, k, o[k], g[k]);
+      error = 1;
+    }
+  }
+}
+
+void check_s(const char *name, const float *o, const float *g, uint64_t len) {
+  for (uint64_t k = 0; k < len; ++k) {
+    float t = THRESHOLD_F32 * (1 + (g[k] < 0 ? -g[k] : g[k]));
+    if (!similarity_check_32b(o[k], g[k], t)) {
+      printf("Error (%s) at index %d. %f != %f\n", name, k, o[k], g[k]);
+      error = 1;
+    }
+  }
+}
+
+void check_i(const char *name, const int32_t *o, const int32_t *g,
+             uint64_t len) {
+  for (uint64_t k = 0; k < len; ++k) {
+    if (o[k] != g[k]) {
+      printf("Error (%s) at index %d. %d != %d\n", name, k, o[k], g[k]);
+      error = 1;
+    }
+  }
+}
+
+// Time a kernel call, and print its throughput in elements per cycle
+#define BENCH(name, elems, call)                                               \
+  do {                                                                         \
+    start_timer();                                                             \
+    call;                                                                      \
+    stop_timer();                                                              \
+    int64_t runtime = get_timer();                                             \
+    printf("%-16s %8d cycles (%f elem/cycle)\n", name, runtime,                \
+           (float)(elems) / runtime);                                          \
+  } while (0)
+
+int main() {
+  printf("\n");
+  printf("==========\n");
+  printf("=  BLAS  =\n");
+  printf("==========\n");
+  printf("\n");
+  printf("\n");
+
+  printf("N = %d, M = %d\n", N, M);
+
+  // Dot products
+  double rd;
+  float rs;
+  int32_t ri;
+  BENCH("ddot", N, rd = blas_ddot(x_d, y_d, N));
+  check_f("ddot", &rd, dot_d, 1, THRESHOLD_F64);
+  BENCH("sdot", N, rs = blas_sdot(x_s, y_s, N));
+  check_s("sdot", &rs, dot_s, 1);
+  BENCH("hdot", N, rs = blas_hdot(x_h, y_h, N));
+  check_s("hdot", &rs, dot_h, 1);
+  BENCH("i8dot", N, ri = blas_i8dot(x_i8, y_i8, N));
+  check_i("i8dot", &ri, dot_i8, 1);
+
+  // NRM2
+  BENCH("dnrm2", N, rd = blas_dnrm2(x_d, N));
+  check_f("dnrm2", &rd, nrm2_d, 1, THRESHOLD_F64);
+  BENCH("snrm2", N, rs = blas_snrm2(x_s, N));
+  check_s("snrm2", &rs, nrm2_s, 1);
+
+  // AXPY
+  memcpy(o_d, y_d, N * sizeof(double));
+  BENCH("daxpy", N, blas_daxpy(N, ALPHA, x_d, o_d));
+  check_f("daxpy", o_d, axpy_d, N, THRESHOLD_F64);
+  memcpy(o_s, y_s, N * sizeof(float));
+  BENCH("saxpy", N, blas_saxpy(N, ALPHA, x_s, o_s));
+  check_s("saxpy", o_s, axpy_s, N);
+
+  // Batched dot products: every row of A with x
+  BENCH("ddot_batch", M * N, blas_ddot_batch(A_d, N, x_d, 0, N, M, o_d));
+  check_f("ddot_batch", o_d, batch_d, M, THRESHOLD_F64);
+  BENCH("sdot_batch", M * N, blas_sdot_batch(A_s, N, x_s, 0, N, M, o_s));
+  check_s("sdot_batch", o_s, batch_s, M);
+  BENCH("hdot_batch", M * N, blas_hdot_batch(A_h, N, x_h, 0, N, M, o_s));
+  check_s("hdot_batch", o_s, batch_h, M);
+  BENCH("i8dot_batch", M * N, blas_i8dot_batch(A_i8, N, x_i8, 0, N, M, o_i));
+  check_i("i8dot_batch", o_i, batch_i8, M);
+
+  // GEMV
+  memcpy(o_d, yg_d, M * sizeof(double));
+  BENCH("dgemv_rm", M * N,
+        blas_dgemv_rm(M, N, ALPHA, A_d, N, x_d, BETA, o_d));
+  check_f("dgemv_rm", o_d, gemv_d, M, THRESHOLD_F64);
+  memcpy(o_d, yg_d, M * sizeof(double));
+  BENCH("dgemv_cm", M * N,
+        blas_dgemv_cm(M, N, ALPHA, At_d, M, x_d, BETA, o_d));
+  check_f("dgemv_cm", o_d, gemv_d, M, THRESHOLD_F64);
+  memcpy(o_s, yg_s, M * sizeof(float));
+  BENCH("sgemv_rm", M * N,
+        blas_sgemv_rm(M, N, ALPHA, A_s, N, x_s, BETA, o_s));
+  check_s("sgemv_rm", o_s, gemv_s, M);
+  memcpy(o_s, yg_s, M * sizeof(float));
+  BENCH("sgemv_cm", M * N,
+        blas_sgemv_cm(M, N, ALPHA, At_s, M, x_s, BETA, o_s));
+  check_s("sgemv_cm", o_s, gemv_s, M);
+  memcpy(o_s, yg_s, M * sizeof(float));
+  BENCH("hgemv_rm", M * N,
+        blas_hgemv_rm(M, N, ALPHA, A_h, N, x_h, BETA, o_s));
+  check_s("hgemv_rm", o_s, gemv_h, M);
+  memcpy(o_i, yg_i, M * sizeof(int32_t));
+  BENCH("i8gemv_rm", M * N,
+        blas_i8gemv_rm(M, N, ALPHA_I, A_i8, N, x_i8, BETA_I, o_i));
+  check_i("i8gemv_rm", o_i, gemv_i8, M);
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+
+  return error;
+}
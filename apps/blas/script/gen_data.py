@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+# Copyright 2022 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+# arg1: vector length N, arg2: number of GEMV rows M
+
+import numpy as np
+import sys
+
+def emit(name, array, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  bs = array.tobytes()
+  # Pad to a multiple of 4 bytes (int8 and float16 arrays)
+  bs += bytes(-len(bs) % 4)
+  for i in range(0, len(bs), 4):
+    s = ""
+    for n in range(4):
+      s += "%02x" % bs[i+3-n]
+    print("    .word 0x%s" % s)
+
+############
+## SCRIPT ##
+############
+
+if len(sys.argv) == 3:
+  N = int(sys.argv[1])
+  M = int(sys.argv[2])
+else:
+  print("Error. Give me two arguments: the vector length N and the number of GEMV rows M.")
+  sys.exit()
+
+# Scalars of AXPY and GEMV (see main.c)
+alpha   = 1.5
+beta    = 0.5
+alpha_i = 3
+beta_i  = 2
+
+# Inputs, in [-1, 1) for the floating-point types
+x_d  = np.random.uniform(-1, 1, N)
+y_d  = np.random.uniform(-1, 1, N)
+A_d  = np.random.uniform(-1, 1, (M, N))
+yg_d = np.random.uniform(-1, 1, M)
+x_i8 = np.random.randint(-128, 128, N, dtype=np.int8)
+y_i8 = np.random.randint(-128, 128, N, dtype=np.int8)
+A_i8 = np.random.randint(-128, 128, (M, N), dtype=np.int8)
+yg_i = np.random.randint(-1000, 1000, M, dtype=np.int32)
+
+x_s, y_s, A_s, yg_s = (a.astype(np.float32) for a in (x_d, y_d, A_d, yg_d))
+x_h, y_h, A_h = (a.astype(np.float16) for a in (x_d, y_d, A_d))
+
+# Golden models, computed in float64 (or int64) from the actual inputs
+def gold(x, y, A, yg, a, b, dtype):
+  x, y, A, yg = (v.astype(np.float64) for v in (x, y, A, yg))
+  return (np.array(x @ y, dtype=dtype), (A @ x).astype(dtype),
+          (a * (A @ x) + b * yg).astype(dtype))
+
+dot_d, batch_d, gemv_d = gold(x_d, y_d, A_d, yg_d, alpha, beta, np.float64)
+dot_s, batch_s, gemv_s = gold(x_s, y_s, A_s, yg_s, alpha, beta, np.float32)
+dot_h, batch_h, gemv_h = gold(x_h, y_h, A_h, yg_s, alpha, beta, np.float32)
+xi, yi, Ai = (v.astype(np.int64) for v in (x_i8, y_i8, A_i8))
+dot_i8 = np.array(xi @ yi, dtype=np.int32)
+batch_i8 = (Ai @ xi).astype(np.int32)
+gemv_i8 = (alpha_i * (Ai @ xi) + beta_i * yg_i).astype(np.int32)
+
+nrm2_d = np.array(np.sqrt(x_d @ x_d), dtype=np.float64)
+nrm2_s = np.array(np.sqrt(x_s.astype(np.float64) @ x_s), dtype=np.float32)
+axpy_d = alpha * x_d + y_d
+axpy_s = (alpha * x_s.astype(np.float64) + y_s).astype(np.float32)
+
+# Result buffers
+L = max(N, M)
+
+print(".section .data,\"aw\",@progbits")
+emit("N", np.array(N, dtype=np.uint64))
+emit("M", np.array(M, dtype=np.uint64))
+emit("x_d", x_d, 'NR_LANES*4')
+emit("y_d", y_d, 'NR_LANES*4')
+emit("A_d", A_d, 'NR_LANES*4')
+emit("At_d", np.ascontiguousarray(A_d.T), 'NR_LANES*4')
+emit("yg_d", yg_d, 'NR_LANES*4')
+emit("x_s", x_s, 'NR_LANES*4')
+emit("y_s", y_s, 'NR_LANES*4')
+emit("A_s", A_s, 'NR_LANES*4')
+emit("At_s", np.ascontiguousarray(A_s.T), 'NR_LANES*4')
+emit("yg_s", yg_s, 'NR_LANES*4')
+emit("x_h", x_h, 'NR_LANES*4')
+emit("y_h", y_h, 'NR_LANES*4')
+emit("A_h", A_h, 'NR_LANES*4')
+emit("x_i8", x_i8, 'NR_LANES*4')
+emit("y_i8", y_i8, 'NR_LANES*4')
+emit("A_i8", A_i8, 'NR_LANES*4')
+emit("yg_i", yg_i, 'NR_LANES*4')
+emit("dot_d", dot_d)
+emit("dot_s", dot_s)
+emit("dot_h", dot_h)
+emit("dot_i8", dot_i8)
+emit("nrm2_d", nrm2_d)
+emit("nrm2_s", nrm2_s)
+emit("axpy_d", axpy_d, 'NR_LANES*4')
+emit("axpy_s", axpy_s, 'NR_LANES*4')
+emit("batch_d", batch_d, 'NR_LANES*4')
+emit("batch_s", batch_s, 'NR_LANES*4')
+emit("batch_h", batch_h, 'NR_LANES*4')
+emit("batch_i8", batch_i8, 'NR_LANES*4')
+emit("gemv_d", gemv_d, 'NR_LANES*4')
+emit("gemv_s", gemv_s, 'NR_LANES*4')
+emit("gemv_h", gemv_h, 'NR_LANES*4')
+emit("gemv_i8", gemv_i8, 'NR_LANES*4')
+emit("o_d", np.zeros(L, dtype=np.float64), 'NR_LANES*4')
+emit("o_s", np.zeros(L, dtype=np.float32), 'NR_LANES*4')
+emit("o_i", np.zeros(L, dtype=np.int32), 'NR_LANES*4')
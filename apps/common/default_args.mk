@@ -7,12 +7,15 @@ def_args_fmatmul     = "128 128 128"
 def_args_iconv2d     = "112 7"
 def_args_fconv2d     = "112 7"
 def_args_fconv3d     = "112 7"
+# Batch, input channels, height, width, output channels, filter size,
+# stride, padding, dilation, layout (nchw|nhwc)
+def_args_conv2d      = "1 3 32 32 8 3 1 1 1 nchw"
 # Vector size
 def_args_fdotproduct = "512"
 # Vector size
 def_args_dotproduct  = "512"
-# Matrix padded size 0, matrix padded size 1, onlyvec
-def_args_jacobi2d    = "130 130"
+# Matrix padded size 0, matrix padded size 1, time steps
+def_args_jacobi2d    = "130 130 4"
 # Vector size
 def_args_dropout     = "1024"
 # Vector size, data-type
@@ -23,9 +26,17 @@ def_args_dwt         = "512"
 def_args_exp         = "512"
 def_args_cos         = "512"
 def_args_log         = "512"
-# Channels and Inner size
-def_args_softmax     = "3 256"
+# Samples per function and data type
+def_args_vmath       = "512"
+# Vector length, number of GEMV rows
+def_args_blas        = "1024 16"
+# Vector length, average segment length
+def_args_vred        = "4096 16"
+# Batch size, channels, and inner size
+def_args_softmax     = "2 3 256"
 # Number of steps and width of the vector
 def_args_pathfinder  = "1 1024 64"
 # Batch_size, depth, height, width, n_boxes (in total), crop_h, crop_w
 def_args_roi_align   = "1 32 4 4 4 2 2"
+# Dimensions, shape (star/box), radius, size, number of steps
+def_args_stencil     = "2 box 1 64 2"
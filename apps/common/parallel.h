@@ -0,0 +1,124 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Parallel runtime for multi-tile systems (header only)
+//
+// A system with nr_tiles > 1 (hardware/Makefile) has several Ariane+Ara
+// tiles sharing the L2 memory. Every hart boots from the same image: hart 0
+// runs main(), the others run __parallel_main(), if the app defines it with
+// PARALLEL_MAIN, or park otherwise. The model is SPMD: all the harts call
+// barrier() and parallel_for() in the same order, and only hart 0 prints,
+// measures time, and writes the end of computation. Before a multi-tile part,
+// the other harts wait in start_barrier() for hart 0 to finish its own
+// measurements, and hart 0 must reach it also when these fail.
+//
+// Caveats:
+// - The D$ of the tiles are not coherent with each other. Ara's stores only
+//   invalidate the D$ of their own tile. Before reading with scalar loads
+//   data written by another tile, call dcache_invalidate() on it.
+// - There are no atomics in the memory system. barrier() uses a register per
+//   hart in the control registers, which only its hart writes.
+
+#ifndef _PARALLEL_H_
+#define _PARALLEL_H_
+
+#include <stdint.h>
+
+#include "runtime.h"
+
+// Run main() on every hart. The app tells the harts apart with get_hartid().
+#define PARALLEL_MAIN int __parallel_main() __attribute__((alias("main")));
+
+// Cycles between two polls of the sync registers, to leave the control
+// registers to the harts that still have to arrive
+#define BARRIER_BACKOFF 16
+// The harts parked in start_barrier() can wait for a whole single-tile
+// benchmark: they poll much less often
+#define START_BARRIER_BACKOFF 1024
+
+inline uint64_t get_hartid() {
+  uint64_t hartid;
+  asm volatile("csrr %0, mhartid" : "=r"(hartid));
+  return hartid;
+}
+
+#ifndef SPIKE
+inline uint64_t get_nr_tiles() { return nr_tiles_reg; }
+
+inline void barrier_backoff(uint64_t backoff) {
+  uint64_t hartid = get_hartid();
+  uint64_t nr_tiles = get_nr_tiles();
+  uint64_t epoch = sync_reg[hartid] + 1;
+
+  // Wait for Ara and the store buffer
+  asm volatile("fence" ::: "memory");
+  sync_reg[hartid] = epoch;
+  for (uint64_t h = 0; h < nr_tiles; ++h)
+    while ((int64_t)(sync_reg[h] - epoch) < 0)
+      for (uint64_t i = 0; i < backoff; ++i)
+        asm volatile("nop");
+  asm volatile("fence" ::: "memory");
+}
+
+// Wait for all the harts. The stores (scalar and vector) issued before the
+// barrier are visible in the L2 to all the harts after it.
+inline void barrier() { barrier_backoff(BARRIER_BACKOFF); }
+
+// Same as barrier(), for the harts that wait while hart 0 runs on its own:
+// they stay parked until hart 0 calls it too. There are no interrupts to wake
+// up a hart from wfi, so the parked harts poll, with a long backoff.
+inline void start_barrier() { barrier_backoff(START_BARRIER_BACKOFF); }
+#else
+inline uint64_t get_nr_tiles() { return 1; }
+inline void barrier() {}
+inline void start_barrier() {}
+#endif
+
+// Split [0, n) into nr_active contiguous chunks, multiple of align (but the
+// last one), and call body(start, end, arg) on the chunk of every hart below
+// nr_active. All the harts must call it, with the same arguments.
+inline void parallel_for(uint64_t n, uint64_t align, uint64_t nr_active,
+                         void (*body)(uint64_t, uint64_t, void *), void *arg) {
+  uint64_t hartid = get_hartid();
+  uint64_t units = (n + align - 1) / align;
+
+  barrier();
+  if (hartid < nr_active) {
+    uint64_t start = units * hartid / nr_active * align;
+    uint64_t end = units * (hartid + 1) / nr_active * align;
+    if (end > n)
+      end = n;
+    if (start < end)
+      body(start, end, arg);
+  }
+  barrier();
+}
+
+// Drop the lines of [ptr, ptr + bytes) from the D$ of this tile. Ara copies
+// the range onto itself, and its stores invalidate the lines that the D$
+// might hold. Only safe after a barrier, when nobody else writes the range.
+inline void dcache_invalidate(void *ptr, uint64_t bytes) {
+  uint8_t *p = (uint8_t *)ptr;
+  uint64_t vl;
+  for (; bytes > 0; bytes -= vl, p += vl) {
+    asm volatile("vsetvli %0, %1, e8, m8, ta, ma" : "=r"(vl) : "r"(bytes));
+    asm volatile("vle8.v v8, (%0)" ::"r"(p));
+    asm volatile("vse8.v v8, (%0)" ::"r"(p));
+  }
+  asm volatile("fence" ::: "memory");
+}
+
+#endif // _PARALLEL_H_
@@ -11,6 +11,11 @@ extern int64_t event_trigger;
 extern int64_t timer;
 // SoC-level CSR
 extern uint64_t hw_cnt_en_reg;
+extern volatile uint64_t inval_lines_reg;
+extern volatile uint64_t inval_issued_reg;
+// Multi-tile systems (parallel.h)
+extern volatile uint64_t nr_tiles_reg;
+extern volatile uint64_t sync_reg[];
 
 // Return the current value of the cycle counter
 inline int64_t get_cycle_count() {
@@ -36,6 +41,12 @@ inline void stop_timer() { timer += get_cycle_count(); }
 
 // Get the value of the timer
 inline int64_t get_timer() { return timer; }
+
+// Lines written by Ara, and cache invalidations sent to Ariane's D$. With
+// several tiles, these are the totals over all of them: every hart reads the
+// same values, and the counters of one tile are not available on their own.
+inline uint64_t get_inval_lines() { return inval_lines_reg; }
+inline uint64_t get_inval_issued() { return inval_issued_reg; }
 #else
 #define HW_CNT_READY ;
 #define HW_CNT_NOT_READY ;
@@ -51,6 +62,9 @@ inline void stop_timer() {
 
 // Get the value of the timer
 inline int64_t get_timer() { return 0; }
+
+inline uint64_t get_inval_lines() { return 0; }
+inline uint64_t get_inval_issued() { return 0; }
 #endif
 
 #endif // _RUNTIME_H_
@@ -107,9 +107,12 @@ endif
 # Compile two different versions of the runtime, since we cannot link code compiled with two different toolchains
 RUNTIME_GCC   ?= common/crt0-gcc.S.o common/printf-gcc.c.o common/string-gcc.c.o common/serial-gcc.c.o common/util-gcc.c.o
 RUNTIME_LLVM  ?= common/crt0-llvm.S.o common/printf-llvm.c.o common/string-llvm.c.o common/serial-llvm.c.o common/util-llvm.c.o
+# The riscv-tests keep the scalar string functions (see string.c)
+RUNTIME_GCC_TESTS  ?= $(subst string-gcc,string-scalar-gcc,$(RUNTIME_GCC))
+RUNTIME_LLVM_TESTS ?= $(subst string-llvm,string-scalar-llvm,$(RUNTIME_LLVM))
 RUNTIME_SPIKE ?= $(spike_env_dir)/benchmarks/common/crt.S.o.spike $(spike_env_dir)/benchmarks/common/syscalls.c.o.spike common/util.c.o.spike
 
-.INTERMEDIATE: $(RUNTIME_GCC) $(RUNTIME_LLVM)
+.INTERMEDIATE: $(RUNTIME_GCC) $(RUNTIME_LLVM) $(RUNTIME_GCC_TESTS) $(RUNTIME_LLVM_TESTS)
 
 %-gcc.S.o: %.S
 	$(RISCV_CC_GCC) $(RISCV_CCFLAGS_GCC) -c $< -o $@
@@ -117,12 +120,18 @@ RUNTIME_SPIKE ?= $(spike_env_dir)/benchmarks/common/crt.S.o.spike $(spike_env_di
 %-gcc.c.o: %.c
 	$(RISCV_CC_GCC) $(RISCV_CCFLAGS_GCC) -c $< -o $@
 
+%-scalar-gcc.c.o: %.c
+	$(RISCV_CC_GCC) $(RISCV_CCFLAGS_GCC) -DSTRING_SCALAR -c $< -o $@
+
 %-llvm.S.o: %.S
 	$(RISCV_CC) $(RISCV_CCFLAGS) -c $< -o $@
 
 %-llvm.c.o: %.c
 	$(RISCV_CC) $(RISCV_CCFLAGS) -c $< -o $@
 
+%-scalar-llvm.c.o: %.c
+	$(RISCV_CC) $(RISCV_CCFLAGS) -DSTRING_SCALAR -c $< -o $@
+
 %.S.o: %.S
 	$(RISCV_CC) $(RISCV_CCFLAGS) -c $< -o $@
 
@@ -2,7 +2,221 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "util.h"
+
+// The compiler must not turn the scalar loops back into calls to memcpy and
+// memset
+#ifdef __clang__
+#define NO_BUILTIN __attribute__((no_builtin))
+#else
+#define NO_BUILTIN __attribute__((optimize("no-tree-loop-distribute-patterns")))
+#endif
+
+// Below this size, in bytes, the string functions keep the scalar loops,
+// which are faster than setting up the vector unit. The string app measures
+// the crossover for each configuration.
+#ifndef STRING_VEC_MIN
+#define STRING_VEC_MIN 128
+#endif
+
+// The riscv-tests link a runtime built with STRING_SCALAR, which never takes
+// the vector paths: a test must not depend on vector instructions other than
+// the ones it checks
+#ifdef STRING_SCALAR
+#undef STRING_VEC_MIN
+#define STRING_VEC_MIN SIZE_MAX
+#endif
+
+// Misaligned vector stores are split into narrower AXI beats: the vector
+// paths write the first bytes with the scalar core, up to the alignment of
+// the AXI data width of Ara (32 * NR_LANES bits)
+#define STRING_VEC_ALIGN (4 * NR_LANES)
+
+// The vector paths strip-mine the buffers with e8 and LMUL = 8, which works
+// with any alignment. strlen and memchr use fault-only-first loads: they can
+// read past the end of the string, or past the first match, without
+// faulting, since a fault trims vl to the elements before it. Each
+// strip-mining step is a single asm block that declares the vector registers
+// it writes, so that the compiler never keeps values in them across steps.
+#define STRING_VREGS_V8                                                        \
+  "v8", "v9", "v10", "v11", "v12", "v13", "v14", "v15"
+#define STRING_VREGS_V16                                                       \
+  "v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23"
+
+NO_BUILTIN void *memcpy_vector(void *dest, const void *src, size_t len) {
+  const char *s = src;
+  char *d = dest;
+  size_t head = -(uintptr_t)d & (STRING_VEC_ALIGN - 1);
+  for (; head > 0 && len > 0; --head, --len)
+    *d++ = *s++;
+  while (len > 0) {
+    size_t vl;
+    asm volatile("vsetvli %0, %1, e8, m8, ta, ma\n"
+                 "vle8.v v8, (%2)\n"
+                 "vse8.v v8, (%3)"
+                 : "=&r"(vl)
+                 : "r"(len), "r"(s), "r"(d)
+                 : STRING_VREGS_V8, "memory");
+    s += vl;
+    d += vl;
+    len -= vl;
+  }
+  return dest;
+}
+
+NO_BUILTIN void *memset_vector(void *dest, int byte, size_t len) {
+  char *d = dest;
+  size_t head = -(uintptr_t)d & (STRING_VEC_ALIGN - 1);
+  for (; head > 0 && len > 0; --head, --len)
+    *d++ = (char)byte;
+  while (len > 0) {
+    size_t vl;
+    asm volatile("vsetvli %0, %1, e8, m8, ta, ma\n"
+                 "vmv.v.x v8, %2\n"
+                 "vse8.v v8, (%3)"
+                 : "=&r"(vl)
+                 : "r"(len), "r"(byte), "r"(d)
+                 : STRING_VREGS_V8, "memory");
+    d += vl;
+    len -= vl;
+  }
+  return dest;
+}
+
+// A forward copy to lower addresses is safe also between overlapping buffers,
+// since each byte is stored after the bytes above it were loaded. A backward
+// copy to higher addresses goes in chunks not longer than the distance of the
+// buffers, so that no chunk overwrites its own source; if they are too close,
+// the chunks are too short for the vector unit.
+NO_BUILTIN void *memmove_vector(void *dest, const void *src, size_t len) {
+  const char *s = src;
+  char *d = dest;
+  size_t dist = (size_t)(d - s);
+  if (d <= s || dist >= len)
+    return memcpy_vector(dest, src, len);
+  if (dist < STRING_VEC_MIN)
+    return memmove_scalar(dest, src, len);
+  size_t vlmax;
+  asm volatile("vsetvli %0, zero, e8, m8, ta, ma" : "=r"(vlmax));
+  while (len > 0) {
+    // Not longer than VLMAX, so that vsetvli grants the whole chunk
+    size_t vl = MIN(MIN(len, dist), vlmax);
+    len -= vl;
+    asm volatile("vsetvli zero, %0, e8, m8, ta, ma\n"
+                 "vle8.v v8, (%1)\n"
+                 "vse8.v v8, (%2)"
+                 :
+                 : "r"(vl), "r"(s + len), "r"(d + len)
+                 : STRING_VREGS_V8, "memory");
+  }
+  return dest;
+}
+
+NO_BUILTIN int memcmp_vector(const void *s1, const void *s2, size_t n) {
+  const unsigned char *p1 = s1;
+  const unsigned char *p2 = s2;
+  while (n > 0) {
+    size_t vl;
+    long first;
+    asm volatile("vsetvli %0, %2, e8, m8, ta, ma\n"
+                 "vle8.v v8, (%3)\n"
+                 "vle8.v v16, (%4)\n"
+                 "vmsne.vv v0, v8, v16\n"
+                 "vfirst.m %1, v0"
+                 : "=&r"(vl), "=&r"(first)
+                 : "r"(n), "r"(p1), "r"(p2)
+                 : "v0", STRING_VREGS_V8, STRING_VREGS_V16, "memory");
+    if (first >= 0)
+      return p1[first] - p2[first];
+    p1 += vl;
+    p2 += vl;
+    n -= vl;
+  }
+  return 0;
+}
+
+NO_BUILTIN size_t strlen_vector(const char *s) {
+  const char *p = s;
+  size_t vl;
+  long first;
+  do {
+    asm volatile("vsetvli %0, zero, e8, m8, ta, ma\n"
+                 "vle8ff.v v8, (%2)\n"
+                 "csrr %0, vl\n"
+                 "vmseq.vi v0, v8, 0\n"
+                 "vfirst.m %1, v0"
+                 : "=&r"(vl), "=&r"(first)
+                 : "r"(p)
+                 : "v0", STRING_VREGS_V8, "memory");
+    p += vl;
+  } while (first < 0);
+  return (size_t)(p - vl + first - s);
+}
+
+NO_BUILTIN void *memchr_vector(const void *s, int c, size_t n) {
+  const unsigned char *p = s;
+  while (n > 0) {
+    size_t vl;
+    long first;
+    asm volatile("vsetvli zero, %2, e8, m8, ta, ma\n"
+                 "vle8ff.v v8, (%3)\n"
+                 "csrr %0, vl\n"
+                 "vmseq.vx v0, v8, %4\n"
+                 "vfirst.m %1, v0"
+                 : "=&r"(vl), "=&r"(first)
+                 : "r"(n), "r"(p), "r"(c)
+                 : "v0", STRING_VREGS_V8, "memory");
+    if (first >= 0)
+      return (void *)(p + first);
+    p += vl;
+    n -= vl;
+  }
+  return NULL;
+}
+
 void *memcpy(void *dest, const void *src, size_t len) {
+  if (len < STRING_VEC_MIN)
+    return memcpy_scalar(dest, src, len);
+  return memcpy_vector(dest, src, len);
+}
+
+void *memset(void *dest, int byte, size_t len) {
+  if (len < STRING_VEC_MIN)
+    return memset_scalar(dest, byte, len);
+  return memset_vector(dest, byte, len);
+}
+
+void *memmove(void *dest, const void *src, size_t len) {
+  if (len < STRING_VEC_MIN)
+    return memmove_scalar(dest, src, len);
+  return memmove_vector(dest, src, len);
+}
+
+int memcmp(const void *s1, const void *s2, size_t n) {
+  if (n < STRING_VEC_MIN)
+    return memcmp_scalar(s1, s2, n);
+  return memcmp_vector(s1, s2, n);
+}
+
+// The length is not known in advance: the first STRING_VEC_MIN bytes are
+// scanned with the scalar core, so that short strings (e.g., printf formats)
+// never issue a full-VLMAX vector load
+NO_BUILTIN size_t strlen(const char *s) {
+  for (size_t i = 0; i < STRING_VEC_MIN; ++i)
+    if (s[i] == '\0')
+      return i;
+  return STRING_VEC_MIN + strlen_vector(s + STRING_VEC_MIN);
+}
+
+void *memchr(const void *s, int c, size_t n) {
+  if (n < STRING_VEC_MIN)
+    return memchr_scalar(s, c, n);
+  return memchr_vector(s, c, n);
+}
+
+// Scalar references
+
+NO_BUILTIN void *memcpy_scalar(void *dest, const void *src, size_t len) {
   if ((((uintptr_t)dest | (uintptr_t)src | len) & (sizeof(uintptr_t) - 1)) ==
       0) {
     const uintptr_t *s = src;
@@ -18,7 +232,7 @@ void *memcpy(void *dest, const void *src, size_t len) {
   return dest;
 }
 
-void *memset(void *dest, int byte, size_t len) {
+NO_BUILTIN void *memset_scalar(void *dest, int byte, size_t len) {
   if ((((uintptr_t)dest | len) & (sizeof(uintptr_t) - 1)) == 0) {
     uintptr_t word = byte & 0xFF;
     word |= word << 8;
@@ -36,25 +250,37 @@ void *memset(void *dest, int byte, size_t len) {
   return dest;
 }
 
-size_t strlen(const char *s) {
+NO_BUILTIN size_t strlen_scalar(const char *s) {
   const char *p = s;
   while (*p)
     p++;
   return (size_t)(p - s);
 }
 
-int strcmp(const char *s1, const char *s2) {
-  unsigned char c1, c2;
-
-  do {
-    c1 = *s1++;
-    c2 = *s2++;
-  } while (c1 != 0 && c1 == c2);
+NO_BUILTIN void *memchr_scalar(const void *s, int c, size_t n) {
+  const unsigned char *p = s;
+  while (n--) {
+    if (*p == (unsigned char)c)
+      return (void *)p;
+    p++;
+  }
+  return NULL;
+}
 
-  return c1 - c2;
+NO_BUILTIN void *memmove_scalar(void *dest, const void *src, size_t len) {
+  const char *s = src;
+  char *d = dest;
+  if (d < s) {
+    while (len--)
+      *d++ = *s++;
+  } else {
+    while (len--)
+      d[len] = s[len];
+  }
+  return dest;
 }
 
-int memcmp(const void *s1, const void *s2, size_t n) {
+NO_BUILTIN int memcmp_scalar(const void *s1, const void *s2, size_t n) {
   if ((((uintptr_t)s1 | (uintptr_t)s2) & (sizeof(uintptr_t) - 1)) == 0) {
     const uintptr_t *u1 = s1;
     const uintptr_t *u2 = s2;
@@ -80,6 +306,17 @@ int memcmp(const void *s1, const void *s2, size_t n) {
   return 0;
 }
 
+int strcmp(const char *s1, const char *s2) {
+  unsigned char c1, c2;
+
+  do {
+    c1 = *s1++;
+    c2 = *s2++;
+  } while (c1 != 0 && c1 == c2);
+
+  return c1 - c2;
+}
+
 char *strcpy(char *dest, const char *src) {
   char *d = dest;
   while ((*d++ = *src++))
@@ -21,6 +21,8 @@
 #ifndef __UTIL_H__
 #define __UTIL_H__
 
+#include <stddef.h>
+
 #ifdef GATE_SIM
 #define NO_PRINTF
 #endif
@@ -55,4 +57,19 @@ int similarity_check_32b(float a, float b, float threshold);
 // Dummy declaration for libm exp
 int *__errno(void);
 
+// Scalar and vector paths of the string.c functions. The runtime functions
+// pick one of the two depending on the size (STRING_VEC_MIN).
+void *memcpy_scalar(void *dest, const void *src, size_t len);
+void *memset_scalar(void *dest, int byte, size_t len);
+void *memmove_scalar(void *dest, const void *src, size_t len);
+int memcmp_scalar(const void *s1, const void *s2, size_t n);
+size_t strlen_scalar(const char *s);
+void *memchr_scalar(const void *s, int c, size_t n);
+void *memcpy_vector(void *dest, const void *src, size_t len);
+void *memset_vector(void *dest, int byte, size_t len);
+void *memmove_vector(void *dest, const void *src, size_t len);
+int memcmp_vector(const void *s1, const void *s2, size_t n);
+size_t strlen_vector(const char *s);
+void *memchr_vector(const void *s, int c, size_t n);
+
 #endif
@@ -0,0 +1,139 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Fused element-wise loops (header only)
+//
+// A chain of element-wise operators is written as one expression of the
+// VF_* macros, inside a single stripmined loop, e.g.,
+//
+//   #define VFUSE_SEW 32
+//   #define VFUSE_LMUL 4
+//   VFUSE_FOR(n) VF_ST(y, VF_MULS(VF_MATH(vexp, VF_SUBS(VF_LD(x), m)), s));
+//
+// computes y = s * exp(x - m) with one load and one store per element: the
+// intermediates are intrinsic values, i.e., vector registers, and never go
+// to memory. The operators expand to the intrinsics of the element type and
+// LMUL given by VFUSE_SEW (16, 32, 64) and VFUSE_LMUL (1, 2, 4, 8), which
+// are read where the loop is written, so that they can be redefined from one
+// kernel to the next.
+//
+// Inside the loop, vf_i is the index of the first element of the strip and
+// vf_vl the vector length. VF_LD(p) and VF_ST(p, v) access p[vf_i..]. Longer
+// chains, or operands used more than once, can be held in VF_T locals:
+//
+//   VFUSE_FOR(n) {
+//     VF_T v = VF_ADD(VF_LD(x), VF_LD(bias));
+//     VF_ST(y, VF_MUL(v, VF_MATH(vsigmoid, v)));
+//   }
+//
+// Every macro argument is evaluated once, except n, which is evaluated at
+// every strip. VFUSE_FOR cannot be nested.
+
+#ifndef VFUSE_H
+#define VFUSE_H
+
+#include <riscv_vector.h>
+#include <stddef.h>
+
+#include "vmath.h"
+#include "vrng.h"
+
+#define VF_CAT2_(a, b) a##b
+#define VF_CAT2(a, b) VF_CAT2_(a, b)
+#define VF_CAT5_(a, b, c, d, e) a##b##c##d##e
+#define VF_CAT5(a, b, c, d, e) VF_CAT5_(a, b, c, d, e)
+
+// Type suffix (e.g., f32m4), vector type, and intrinsic names
+#define VF_SFX VF_CAT5(f, VFUSE_SEW, m, VFUSE_LMUL, )
+#define VF_T VF_CAT5(vfloat, VFUSE_SEW, m, VFUSE_LMUL, _t)
+#define VF_FN(op) VF_CAT2(op, VF_SFX)
+
+// Ratio SEW/LMUL of the mask type
+#define VF_MB_16_1 16
+#define VF_MB_16_2 8
+#define VF_MB_16_4 4
+#define VF_MB_16_8 2
+#define VF_MB_32_1 32
+#define VF_MB_32_2 16
+#define VF_MB_32_4 8
+#define VF_MB_32_8 4
+#define VF_MB_64_1 64
+#define VF_MB_64_2 32
+#define VF_MB_64_4 16
+#define VF_MB_64_8 8
+#define VF_MB VF_CAT5(VF_MB_, VFUSE_SEW, _, VFUSE_LMUL, )
+
+/////////////////
+// Stripmining //
+/////////////////
+
+#define VFUSE_FOR(n)                                                           \
+  for (size_t vf_i = 0, vf_vl;                                                 \
+       vf_i < (n) &&                                                           \
+       (vf_vl = VF_CAT5(vsetvl_e, VFUSE_SEW, m, VFUSE_LMUL, )((n)-vf_i));      \
+       vf_i += vf_vl)
+
+///////////////
+// Operators //
+///////////////
+
+// Memory
+#define VF_LD(p) VF_FN(VF_CAT5(vle, VFUSE_SEW, _v_, , ))(&(p)[vf_i], vf_vl)
+#define VF_ST(p, v)                                                            \
+  VF_FN(VF_CAT5(vse, VFUSE_SEW, _v_, , ))(&(p)[vf_i], v, vf_vl)
+#define VF_SPLAT(s) VF_FN(vfmv_v_f_)(s, vf_vl)
+
+// Arithmetic, vector-vector
+#define VF_ADD(a, b) VF_FN(vfadd_vv_)(a, b, vf_vl)
+#define VF_SUB(a, b) VF_FN(vfsub_vv_)(a, b, vf_vl)
+#define VF_MUL(a, b) VF_FN(vfmul_vv_)(a, b, vf_vl)
+#define VF_DIV(a, b) VF_FN(vfdiv_vv_)(a, b, vf_vl)
+#define VF_MAX(a, b) VF_FN(vfmax_vv_)(a, b, vf_vl)
+#define VF_MIN(a, b) VF_FN(vfmin_vv_)(a, b, vf_vl)
+// a * b + c
+#define VF_FMA(a, b, c) VF_FN(vfmadd_vv_)(a, b, c, vf_vl)
+
+// Arithmetic, vector-scalar (s is a scalar of the element type)
+#define VF_ADDS(a, s) VF_FN(vfadd_vf_)(a, s, vf_vl)
+#define VF_SUBS(a, s) VF_FN(vfsub_vf_)(a, s, vf_vl)
+#define VF_RSUBS(a, s) VF_FN(vfrsub_vf_)(a, s, vf_vl)
+#define VF_MULS(a, s) VF_FN(vfmul_vf_)(a, s, vf_vl)
+#define VF_DIVS(a, s) VF_FN(vfdiv_vf_)(a, s, vf_vl)
+#define VF_RDIVS(a, s) VF_FN(vfrdiv_vf_)(a, s, vf_vl)
+#define VF_MAXS(a, s) VF_FN(vfmax_vf_)(a, s, vf_vl)
+#define VF_MINS(a, s) VF_FN(vfmin_vf_)(a, s, vf_vl)
+// a * s + c
+#define VF_FMAS(a, s, c) VF_FN(vfmadd_vf_)(a, s, c, vf_vl)
+
+// Unary
+#define VF_NEG(a) VF_FN(vfneg_v_)(a, vf_vl)
+#define VF_ABS(a) VF_FN(vfabs_v_)(a, vf_vl)
+#define VF_SQRT(a) VF_FN(vfsqrt_v_)(a, vf_vl)
+#define VF_RELU(a) VF_MAXS(a, 0)
+#define VF_CLAMP(a, lo, hi) VF_MINS(VF_MAXS(a, lo), hi)
+// Any function of common/vmath.h, e.g., VF_MATH(vtanh_fast, a)
+#define VF_MATH(fn, a) VF_CAT2(fn, VF_CAT2(_, VF_SFX))(a, vf_vl)
+
+// Inverted dropout: a * scale with probability keep / 65536, else 0. The
+// mask is drawn from the vrng_t *rng (common/vrng.h) in the mask register.
+// Available for the mask types of vrng_bernoulli_b* (e32/m8, e32/m4, e64/m8).
+#define VF_DROPOUT(a, rng, keep, scale)                                        \
+  VF_CAT2(VF_FN(vfmul_vf_), _m)(                                               \
+      VF_CAT2(vrng_bernoulli_b, VF_MB)(rng, keep, vf_vl), VF_SPLAT(0), a,      \
+      scale, vf_vl)
+
+#endif
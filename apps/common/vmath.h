@@ -0,0 +1,271 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Vector math library (header only)
+//
+// For every element type (f16, f32, f64) and LMUL (m1, m2, m4, m8), this
+// header defines the inline functions
+//
+//   vexp, vlog, vsin, vcos, vtanh, vsigmoid       (accurate tier)
+//   vexp_fast, vlog_fast, vsin_fast, vcos_fast,
+//   vtanh_fast, vsigmoid_fast,
+//   vrecip_fast, vrsqrt_fast, vsqrt_fast, vdiv_fast (fast tier)
+//
+// named after the intrinsics, e.g., vexp_f32m4(vfloat32m4_t x, size_t vl).
+// VMATH_APPLY() stripmines one of them over an array.
+//
+// The accurate tier targets a few ulp (see VMATH_ULP_*). The fast tier uses
+// lower-degree polynomials and skips the special-case handling, for callers
+// that can tolerate ~5e-3 (f16), ~1e-4 (f32), ~3e-8 (f64) relative error.
+// Its reciprocal, square root, and division replace vfdiv and vfsqrt, which
+// the lanes may compute one element at a time, with the vfrec7 and vfrsqrt7
+// estimates refined by Newton-Raphson steps on the pipelined FMA.
+//
+// All the constants are used through the vector-scalar (.vf) instructions:
+// they live in scalar FP registers, are loaded once outside of the
+// stripmining loop by the compiler, and do not take vector registers, which
+// keeps LMUL = 8 usable.
+//
+// Input ranges (outside of them, the results saturate):
+//   exp, sigmoid: x in [-708, 709] (f64), [-87, 88] (f32), [-9.7, 10.7] (f16)
+//   sin, cos:     |x| < 1e3 (f64, f32), 32 (f16); the Cody-Waite reduction
+//                 loses accuracy beyond
+//   log:          positive normal numbers; the accurate tier also returns NaN
+//                 for x < 0 or NaN, -inf for 0, and +inf for +inf
+//   recip, div:   normal numbers, and normal divisors and results
+//   rsqrt, sqrt:  positive normal numbers; vsqrt_fast also returns 0 for 0
+
+#ifndef VMATH_H
+#define VMATH_H
+
+#include <math.h>
+#include <riscv_vector.h>
+#include <stddef.h>
+
+// Measured accuracy bounds of the accurate tier, in ulp (see apps/vmath)
+#define VMATH_ULP_F64 2
+#define VMATH_ULP_F32 2
+#define VMATH_ULP_F16 2
+
+// Stripmine fn over n elements: y[i] = fn(x[i]), with SEW S and LMUL L.
+// E.g., VMATH_APPLY(vexp, 32, 4, y, x, n)
+#define VMATH_APPLY(fn, S, L, y, x, n)                                         \
+  do {                                                                         \
+    size_t vl_;                                                                \
+    for (size_t i_ = 0; i_ < (n); i_ += vl_) {                                 \
+      vl_ = vsetvl_e##S##m##L((n)-i_);                                         \
+      vse##S##_v_f##S##m##L(                                                   \
+          &(y)[i_], fn##_f##S##m##L(vle##S##_v_f##S##m##L(&(x)[i_], vl_), vl_), \
+          vl_);                                                                \
+    }                                                                          \
+  } while (0)
+
+/////////////////////////
+// Per-type parameters //
+/////////////////////////
+
+// Naming: vmath_<name>_<SEW>. The polynomial tables are shared by the two
+// tiers when the fast one is a prefix of the accurate one.
+
+// Floating-point format
+#define VMATH_MANT_64 52
+#define VMATH_MANT_32 23
+#define VMATH_MANT_16 10
+#define VMATH_BIAS_64 1023
+#define VMATH_BIAS_32 127
+#define VMATH_BIAS_16 15
+
+// exp(x) = 2^k * exp(r), r = x - k*ln2, |r| <= ln2/2
+// exp(r) = 1 + r + r * (r * (1/2! + r/3! + r^2/4! + ...))
+static const double vmath_ln2_hi_64 = 6.93147180369123816490e-01;
+static const double vmath_ln2_lo_64 = 1.90821492927058770002e-10;
+static const float vmath_ln2_hi_32 = 0.693359375f;
+static const float vmath_ln2_lo_32 = -2.12194440e-4f;
+static const _Float16 vmath_ln2_hi_16 = 0.693359375f;
+static const _Float16 vmath_ln2_lo_16 = -2.12194440e-4f;
+
+static const double vmath_exp_hi_64 = 709.0;
+static const double vmath_exp_lo_64 = -708.0;
+static const float vmath_exp_hi_32 = 88.0f;
+static const float vmath_exp_lo_32 = -87.0f;
+static const _Float16 vmath_exp_hi_16 = 10.7f;
+static const _Float16 vmath_exp_lo_16 = -9.7f;
+
+#define VMATH_INV_FACT                                                         \
+  {                                                                            \
+    1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720, 1.0 / 5040,              \
+        1.0 / 40320, 1.0 / 362880, 1.0 / 3628800, 1.0 / 39916800,              \
+        1.0 / 479001600, 1.0 / 6227020800                                      \
+  }
+static const double vmath_exp_c_64[] = VMATH_INV_FACT;
+static const float vmath_exp_c_32[] = VMATH_INV_FACT;
+static const _Float16 vmath_exp_c_16[] = VMATH_INV_FACT;
+#define VMATH_EXP_N_64 12
+#define VMATH_EXP_N_FAST_64 6
+#define VMATH_EXP_N_32 6
+#define VMATH_EXP_N_FAST_32 4
+#define VMATH_EXP_N_16 3
+#define VMATH_EXP_N_FAST_16 2
+
+// log(x) = e*ln2 + log(m), m in [sqrt(2)/2, sqrt(2)), s = (m-1)/(m+1)
+// log(m) = 2s + s * (z * (2/3 + z*2/5 + z^2*2/7 + ...)), z = s^2
+#define VMATH_LOG_C                                                            \
+  {                                                                            \
+    2.0 / 3, 2.0 / 5, 2.0 / 7, 2.0 / 9, 2.0 / 11, 2.0 / 13, 2.0 / 15,          \
+        2.0 / 17, 2.0 / 19                                                     \
+  }
+static const double vmath_log_c_64[] = VMATH_LOG_C;
+static const float vmath_log_c_32[] = VMATH_LOG_C;
+static const _Float16 vmath_log_c_16[] = VMATH_LOG_C;
+#define VMATH_LOG_N_64 9
+#define VMATH_LOG_N_FAST_64 4
+#define VMATH_LOG_N_32 4
+#define VMATH_LOG_N_FAST_32 2
+#define VMATH_LOG_N_16 2
+#define VMATH_LOG_N_FAST_16 1
+
+// sin/cos: x = k*pi/2 + r, |r| <= pi/4, z = r^2
+// sin(r) = r + r * (z * S(z)), cos(r) = 1 - z/2 + z * (z * C(z))
+// pi/2 is split in three parts for the reduction (Cody-Waite)
+static const double vmath_pio2_1_64 = 1.57079632673412561417e+00;
+static const double vmath_pio2_2_64 = 6.07710050630396597660e-11;
+static const double vmath_pio2_3_64 = 2.02226624871116645580e-21;
+static const float vmath_pio2_1_32 = 1.5703125f;
+static const float vmath_pio2_2_32 = 4.837512969970703125e-4f;
+static const float vmath_pio2_3_32 = 7.54978995489188216e-8f;
+static const _Float16 vmath_pio2_1_16 = 1.5703125f;
+static const _Float16 vmath_pio2_2_16 = 4.837512969970703125e-4f;
+static const _Float16 vmath_pio2_3_16 = 0;
+
+// Taylor coefficients
+#define VMATH_SIN_TAYLOR                                                       \
+  { -1.0 / 6, 1.0 / 120, -1.0 / 5040, 1.0 / 362880 }
+#define VMATH_COS_TAYLOR                                                       \
+  { 1.0 / 24, -1.0 / 720, 1.0 / 40320, -1.0 / 3628800 }
+static const double vmath_sin_taylor_64[] = VMATH_SIN_TAYLOR;
+static const double vmath_cos_taylor_64[] = VMATH_COS_TAYLOR;
+static const float vmath_sin_taylor_32[] = VMATH_SIN_TAYLOR;
+static const float vmath_cos_taylor_32[] = VMATH_COS_TAYLOR;
+static const _Float16 vmath_sin_taylor_16[] = VMATH_SIN_TAYLOR;
+static const _Float16 vmath_cos_taylor_16[] = VMATH_COS_TAYLOR;
+// Minimax coefficients, from fdlibm (f64) and Cephes (f32)
+static const double vmath_sin_minimax_64[] = {
+    -1.66666666666666324348e-01, 8.33333333332248946124e-03,
+    -1.98412698298579493134e-04, 2.75573137070700676789e-06,
+    -2.50507602534068634195e-08, 1.58969099521155010221e-10};
+static const double vmath_cos_minimax_64[] = {
+    4.16666666666666019037e-02,  -1.38888888888741095749e-03,
+    2.48015872894767294178e-05,  -2.75573143513906633035e-07,
+    2.08757232129817482790e-09,  -1.13596475577881948265e-11};
+static const float vmath_sin_minimax_32[] = {-1.6666654611E-1f, 8.3321608736E-3f,
+                                             -1.9515295891E-4f};
+static const float vmath_cos_minimax_32[] = {
+    4.166664568298827E-2f, -1.388731625493765E-3f, 2.443315711809948E-5f};
+
+#define VMATH_SIN_C_64 vmath_sin_minimax_64
+#define VMATH_COS_C_64 vmath_cos_minimax_64
+#define VMATH_SIN_N_64 6
+#define VMATH_COS_N_64 6
+#define VMATH_SIN_C_FAST_64 vmath_sin_taylor_64
+#define VMATH_COS_C_FAST_64 vmath_cos_taylor_64
+#define VMATH_SIN_N_FAST_64 4
+#define VMATH_COS_N_FAST_64 4
+
+#define VMATH_SIN_C_32 vmath_sin_minimax_32
+#define VMATH_COS_C_32 vmath_cos_minimax_32
+#define VMATH_SIN_N_32 3
+#define VMATH_COS_N_32 3
+#define VMATH_SIN_C_FAST_32 vmath_sin_taylor_32
+#define VMATH_COS_C_FAST_32 vmath_cos_taylor_32
+#define VMATH_SIN_N_FAST_32 2
+#define VMATH_COS_N_FAST_32 2
+
+#define VMATH_SIN_C_16 vmath_sin_taylor_16
+#define VMATH_COS_C_16 vmath_cos_taylor_16
+#define VMATH_SIN_N_16 2
+#define VMATH_COS_N_16 2
+#define VMATH_SIN_C_FAST_16 vmath_sin_taylor_16
+#define VMATH_COS_C_FAST_16 vmath_cos_taylor_16
+#define VMATH_SIN_N_FAST_16 1
+#define VMATH_COS_N_FAST_16 1
+
+// 1/x, 1/sqrt(x): 7-bit vfrec7/vfrsqrt7 estimate, and Newton-Raphson steps,
+// each doubling the correct bits. vdiv_fast turns the last step of the
+// reciprocal into a correction of the quotient.
+#define VMATH_RECIP_N_FAST_64 2
+#define VMATH_RECIP_N_FAST_32 1
+#define VMATH_RECIP_N_FAST_16 1
+#define VMATH_RSQRT_N_FAST_64 2
+#define VMATH_RSQRT_N_FAST_32 2
+#define VMATH_RSQRT_N_FAST_16 1
+
+///////////////////
+// Instantiation //
+///////////////////
+
+// VMATH_MB is the ratio SEW/LMUL of the mask type
+#define VMATH_T double
+#define VMATH_SEW 64
+#define VMATH_LMUL 1
+#define VMATH_MB 64
+#include "vmath_impl.h"
+#define VMATH_LMUL 2
+#define VMATH_MB 32
+#include "vmath_impl.h"
+#define VMATH_LMUL 4
+#define VMATH_MB 16
+#include "vmath_impl.h"
+#define VMATH_LMUL 8
+#define VMATH_MB 8
+#include "vmath_impl.h"
+#undef VMATH_T
+#undef VMATH_SEW
+
+#define VMATH_T float
+#define VMATH_SEW 32
+#define VMATH_LMUL 1
+#define VMATH_MB 32
+#include "vmath_impl.h"
+#define VMATH_LMUL 2
+#define VMATH_MB 16
+#include "vmath_impl.h"
+#define VMATH_LMUL 4
+#define VMATH_MB 8
+#include "vmath_impl.h"
+#define VMATH_LMUL 8
+#define VMATH_MB 4
+#include "vmath_impl.h"
+#undef VMATH_T
+#undef VMATH_SEW
+
+#define VMATH_T _Float16
+#define VMATH_SEW 16
+#define VMATH_LMUL 1
+#define VMATH_MB 16
+#include "vmath_impl.h"
+#define VMATH_LMUL 2
+#define VMATH_MB 8
+#include "vmath_impl.h"
+#define VMATH_LMUL 4
+#define VMATH_MB 4
+#include "vmath_impl.h"
+#define VMATH_LMUL 8
+#define VMATH_MB 2
+#include "vmath_impl.h"
+#undef VMATH_T
+#undef VMATH_SEW
+
+#endif
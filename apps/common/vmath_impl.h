@@ -0,0 +1,295 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Vector math library, type-generic body.
+// Included by vmath.h once per (SEW, LMUL), with VMATH_T (element type),
+// VMATH_SEW, VMATH_LMUL and VMATH_MB (SEW/LMUL, for the mask type) defined.
+// Do not include directly.
+
+#ifndef VMATH_IMPL_HELPERS
+#define VMATH_IMPL_HELPERS
+
+#define VMATH_INLINE static inline __attribute__((always_inline))
+
+#define VMATH_LOG2E 1.44269504088896340736
+#define VMATH_2_PI 0.636619772367581343076
+#define VMATH_SQRT2 1.41421356237309504880
+
+#define VM_CAT2_(a, b) a##b
+#define VM_CAT2(a, b) VM_CAT2_(a, b)
+#define VM_CAT3_(a, b, c) a##b##c
+#define VM_CAT3(a, b, c) VM_CAT3_(a, b, c)
+#define VM_CAT5_(a, b, c, d, e) a##b##c##d##e
+#define VM_CAT5(a, b, c, d, e) VM_CAT5_(a, b, c, d, e)
+#define VM_CAT7_(a, b, c, d, e, f, g) a##b##c##d##e##f##g
+#define VM_CAT7(a, b, c, d, e, f, g) VM_CAT7_(a, b, c, d, e, f, g)
+#define VM_CAT8_(a, b, c, d, e, f, g, h) a##b##c##d##e##f##g##h
+#define VM_CAT8(a, b, c, d, e, f, g, h) VM_CAT8_(a, b, c, d, e, f, g, h)
+
+// Types
+#define VM_VT VM_CAT5(vfloat, VMATH_SEW, m, VMATH_LMUL, _t)
+#define VM_IT VM_CAT5(vint, VMATH_SEW, m, VMATH_LMUL, _t)
+#define VM_BT VM_CAT3(vbool, VMATH_MB, _t)
+#define VM_ST VM_CAT3(int, VMATH_SEW, _t)
+
+// Intrinsics and function names, e.g., VM_F(vfadd_vv) -> vfadd_vv_f32m4
+#define VM_F(op) VM_CAT5(op, _f, VMATH_SEW, m, VMATH_LMUL)
+#define VM_I(op) VM_CAT5(op, _i, VMATH_SEW, m, VMATH_LMUL)
+#define VM_FM(op) VM_CAT7(op, _f, VMATH_SEW, m, VMATH_LMUL, _m, )
+#define VM_IM(op) VM_CAT7(op, _i, VMATH_SEW, m, VMATH_LMUL, _m, )
+#define VM_FB(op) VM_CAT7(op, _f, VMATH_SEW, m, VMATH_LMUL, _b, VMATH_MB)
+#define VM_IB(op) VM_CAT7(op, _i, VMATH_SEW, m, VMATH_LMUL, _b, VMATH_MB)
+#define VM_F2I                                                                 \
+  VM_CAT8(vreinterpret_v_f, VMATH_SEW, m, VMATH_LMUL, _i, VMATH_SEW, m,        \
+          VMATH_LMUL)
+#define VM_I2F                                                                 \
+  VM_CAT8(vreinterpret_v_i, VMATH_SEW, m, VMATH_LMUL, _f, VMATH_SEW, m,        \
+          VMATH_LMUL)
+#define VM_MOR VM_CAT2(vmor_mm_b, VMATH_MB)
+
+// Per-type parameter, e.g., VM_P(VMATH_EXP_N) -> VMATH_EXP_N_32
+#define VM_P(name) VM_CAT3(name, _, VMATH_SEW)
+
+#endif
+
+// z * (c[0] + z * (c[1] + ... + z * c[n-1]))
+VMATH_INLINE VM_VT VM_F(__vmath_zpoly)(VM_VT z, const VMATH_T *c, int n,
+                                       size_t vl) {
+  VM_VT y = VM_F(vfmul_vf)(z, c[n - 1], vl);
+  for (int i = n - 2; i >= 0; --i)
+    y = VM_F(vfmul_vv)(VM_F(vfadd_vf)(y, c[i], vl), z, vl);
+  return y;
+}
+
+// 2^k, for k in the normal exponent range
+VMATH_INLINE VM_VT VM_F(__vmath_pow2)(VM_IT k, size_t vl) {
+  k = VM_I(vadd_vx)(k, VM_P(VMATH_BIAS), vl);
+  k = VM_I(vsll_vx)(k, VM_P(VMATH_MANT), vl);
+  return VM_I2F(k);
+}
+
+// Range reduction for exp: x = k*ln2 + r. Returns r, and k in *k
+VMATH_INLINE VM_VT VM_F(__vmath_exp_reduce)(VM_VT x, VM_IT *k, size_t vl) {
+  x = VM_F(vfmin_vf)(x, VM_P(vmath_exp_hi), vl);
+  x = VM_F(vfmax_vf)(x, VM_P(vmath_exp_lo), vl);
+  *k = VM_I(vfcvt_x_f_v)(VM_F(vfmul_vf)(x, VMATH_LOG2E, vl), vl);
+  VM_VT kf = VM_F(vfcvt_f_x_v)(*k, vl);
+  VM_VT r = VM_F(vfnmsac_vf)(x, VM_P(vmath_ln2_hi), kf, vl);
+  return VM_F(vfnmsac_vf)(r, VM_P(vmath_ln2_lo), kf, vl);
+}
+
+VMATH_INLINE VM_VT VM_F(__vmath_exp)(VM_VT x, int n, size_t vl) {
+  VM_IT k;
+  VM_VT r = VM_F(__vmath_exp_reduce)(x, &k, vl);
+  // exp(r) - 1 = r + r * (r * (1/2! + r/3! + ...))
+  VM_VT q = VM_F(vfmacc_vv)(
+      r, r, VM_F(__vmath_zpoly)(r, VM_P(vmath_exp_c), n, vl), vl);
+  VM_VT p = VM_F(vfadd_vf)(q, 1, vl);
+  return VM_F(vfmul_vv)(p, VM_F(__vmath_pow2)(k, vl), vl);
+}
+
+// exp(x) - 1, without cancellation for small x
+VMATH_INLINE VM_VT VM_F(__vmath_expm1)(VM_VT x, int n, size_t vl) {
+  VM_IT k;
+  VM_VT r = VM_F(__vmath_exp_reduce)(x, &k, vl);
+  VM_VT q = VM_F(vfmacc_vv)(
+      r, r, VM_F(__vmath_zpoly)(r, VM_P(vmath_exp_c), n, vl), vl);
+  // 2^k * (exp(r) - 1) + (2^k - 1)
+  VM_VT s = VM_F(__vmath_pow2)(k, vl);
+  return VM_F(vfmacc_vv)(VM_F(vfsub_vf)(s, 1, vl), q, s, vl);
+}
+
+VMATH_INLINE VM_VT VM_F(__vmath_log)(VM_VT x, int n, int special,
+                                     size_t vl) {
+  // Split x = m * 2^e, with m in [1, 2)
+  VM_IT b = VM_F2I(x);
+  VM_IT e = VM_I(vsub_vx)(VM_I(vsra_vx)(b, VM_P(VMATH_MANT), vl),
+                          VM_P(VMATH_BIAS), vl);
+  b = VM_I(vand_vx)(b, ((VM_ST)1 << VM_P(VMATH_MANT)) - 1, vl);
+  b = VM_I(vor_vx)(b, (VM_ST)VM_P(VMATH_BIAS) << VM_P(VMATH_MANT), vl);
+  VM_VT m = VM_I2F(b);
+  // Bring m into [sqrt(2)/2, sqrt(2))
+  VM_BT big = VM_FB(vmfgt_vf)(m, VMATH_SQRT2, vl);
+  m = VM_FM(vfmul_vf)(big, m, m, 0.5, vl);
+  e = VM_IM(vadd_vx)(big, e, e, 1, vl);
+
+  // log(m) = 2s + s * (z * (2/3 + z*2/5 + ...))
+  VM_VT f = VM_F(vfsub_vf)(m, 1, vl);
+  VM_VT s = VM_F(vfdiv_vv)(f, VM_F(vfadd_vf)(m, 1, vl), vl);
+  VM_VT z = VM_F(vfmul_vv)(s, s, vl);
+  VM_VT y = VM_F(vfmacc_vv)(VM_F(vfadd_vv)(s, s, vl), s,
+                            VM_F(__vmath_zpoly)(z, VM_P(vmath_log_c), n, vl),
+                            vl);
+  VM_VT ef = VM_F(vfcvt_f_x_v)(e, vl);
+  y = VM_F(vfmacc_vf)(y, VM_P(vmath_ln2_lo), ef, vl);
+  y = VM_F(vfmacc_vf)(y, VM_P(vmath_ln2_hi), ef, vl);
+
+  if (special) {
+    VM_BT nan = VM_MOR(VM_FB(vmflt_vf)(x, 0, vl), VM_FB(vmfne_vv)(x, x, vl),
+                       vl);
+    y = VM_F(vfmerge_vfm)(nan, y, NAN, vl);
+    y = VM_F(vfmerge_vfm)(VM_FB(vmfeq_vf)(x, 0, vl), y, -INFINITY, vl);
+    y = VM_F(vfmerge_vfm)(VM_FB(vmfeq_vf)(x, INFINITY, vl), y, INFINITY, vl);
+  }
+  return y;
+}
+
+VMATH_INLINE VM_VT VM_F(__vmath_sincos)(VM_VT x, int is_cos,
+                                        const VMATH_T *cs, int ns,
+                                        const VMATH_T *cc, int nc, size_t vl) {
+  // x = k*pi/2 + r
+  VM_IT k = VM_I(vfcvt_x_f_v)(VM_F(vfmul_vf)(x, VMATH_2_PI, vl), vl);
+  VM_VT kf = VM_F(vfcvt_f_x_v)(k, vl);
+  VM_VT r = VM_F(vfnmsac_vf)(x, VM_P(vmath_pio2_1), kf, vl);
+  r = VM_F(vfnmsac_vf)(r, VM_P(vmath_pio2_2), kf, vl);
+  r = VM_F(vfnmsac_vf)(r, VM_P(vmath_pio2_3), kf, vl);
+  // cos(x) = sin(x + pi/2)
+  if (is_cos)
+    k = VM_I(vadd_vx)(k, 1, vl);
+
+  VM_VT z = VM_F(vfmul_vv)(r, r, vl);
+  VM_VT sin_r =
+      VM_F(vfmacc_vv)(r, r, VM_F(__vmath_zpoly)(z, cs, ns, vl), vl);
+  VM_VT cos_r = VM_F(vfmul_vv)(z, VM_F(__vmath_zpoly)(z, cc, nc, vl), vl);
+  cos_r = VM_F(vfadd_vf)(VM_F(vfnmsac_vf)(cos_r, 0.5, z, vl), 1, vl);
+
+  // Quadrant k: sin(r), cos(r), -sin(r), -cos(r)
+  VM_BT odd = VM_IB(vmsne_vx)(VM_I(vand_vx)(k, 1, vl), 0, vl);
+  VM_BT neg = VM_IB(vmsne_vx)(VM_I(vand_vx)(k, 2, vl), 0, vl);
+  VM_VT y = VM_F(vmerge_vvm)(odd, sin_r, cos_r, vl);
+  return VM_FM(vfmul_vf)(neg, y, y, -1, vl);
+}
+
+VMATH_INLINE VM_VT VM_F(__vmath_tanh)(VM_VT x, int n, size_t vl) {
+  // tanh(|x|) = e / (e + 2), e = exp(2|x|) - 1
+  VM_VT a = VM_F(vfabs_v)(x, vl);
+  VM_VT e = VM_F(__vmath_expm1)(VM_F(vfadd_vv)(a, a, vl), n, vl);
+  VM_VT t = VM_F(vfdiv_vv)(e, VM_F(vfadd_vf)(e, 2, vl), vl);
+  return VM_F(vfsgnj_vv)(t, x, vl);
+}
+
+VMATH_INLINE VM_VT VM_F(__vmath_sigmoid)(VM_VT x, int n, size_t vl) {
+  // 1 / (1 + exp(-x))
+  VM_VT e = VM_F(__vmath_exp)(VM_F(vfsgnjn_vv)(x, x, vl), n, vl);
+  return VM_F(vfrdiv_vf)(VM_F(vfadd_vf)(e, 1, vl), 1, vl);
+}
+
+// 1/x: vfrec7 estimate, and n Newton-Raphson steps y += y * (1 - x*y)
+VMATH_INLINE VM_VT VM_F(__vmath_recip)(VM_VT x, int n, size_t vl) {
+  VM_VT y = VM_F(vfrec7_v)(x, vl);
+  for (int i = 0; i < n; ++i) {
+    VM_VT e = VM_F(vfrsub_vf)(VM_F(vfmul_vv)(x, y, vl), 1, vl);
+    y = VM_F(vfmacc_vv)(y, y, e, vl);
+  }
+  return y;
+}
+
+// 1/sqrt(x): vfrsqrt7 estimate, and n Newton-Raphson steps
+// y += y * (1/2 - x/2 * y^2)
+VMATH_INLINE VM_VT VM_F(__vmath_rsqrt)(VM_VT x, int n, size_t vl) {
+  VM_VT h = VM_F(vfmul_vf)(x, 0.5, vl);
+  VM_VT y = VM_F(vfrsqrt7_v)(x, vl);
+  for (int i = 0; i < n; ++i) {
+    VM_VT t = VM_F(vfmul_vv)(VM_F(vfmul_vv)(h, y, vl), y, vl);
+    y = VM_F(vfmacc_vv)(y, y, VM_F(vfrsub_vf)(t, 0.5, vl), vl);
+  }
+  return y;
+}
+
+// Accurate tier
+
+VMATH_INLINE VM_VT VM_F(vexp)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_exp)(x, VM_P(VMATH_EXP_N), vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vlog)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_log)(x, VM_P(VMATH_LOG_N), 1, vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vsin)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_sincos)(x, 0, VM_P(VMATH_SIN_C), VM_P(VMATH_SIN_N),
+                              VM_P(VMATH_COS_C), VM_P(VMATH_COS_N), vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vcos)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_sincos)(x, 1, VM_P(VMATH_SIN_C), VM_P(VMATH_SIN_N),
+                              VM_P(VMATH_COS_C), VM_P(VMATH_COS_N), vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vtanh)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_tanh)(x, VM_P(VMATH_EXP_N), vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vsigmoid)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_sigmoid)(x, VM_P(VMATH_EXP_N), vl);
+}
+
+// Fast tier
+
+VMATH_INLINE VM_VT VM_F(vexp_fast)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_exp)(x, VM_P(VMATH_EXP_N_FAST), vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vlog_fast)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_log)(x, VM_P(VMATH_LOG_N_FAST), 0, vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vsin_fast)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_sincos)(
+      x, 0, VM_P(VMATH_SIN_C_FAST), VM_P(VMATH_SIN_N_FAST),
+      VM_P(VMATH_COS_C_FAST), VM_P(VMATH_COS_N_FAST), vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vcos_fast)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_sincos)(
+      x, 1, VM_P(VMATH_SIN_C_FAST), VM_P(VMATH_SIN_N_FAST),
+      VM_P(VMATH_COS_C_FAST), VM_P(VMATH_COS_N_FAST), vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vtanh_fast)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_tanh)(x, VM_P(VMATH_EXP_N_FAST), vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vsigmoid_fast)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_sigmoid)(x, VM_P(VMATH_EXP_N_FAST), vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vrecip_fast)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_recip)(x, VM_P(VMATH_RECIP_N_FAST), vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vrsqrt_fast)(VM_VT x, size_t vl) {
+  return VM_F(__vmath_rsqrt)(x, VM_P(VMATH_RSQRT_N_FAST), vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vsqrt_fast)(VM_VT x, size_t vl) {
+  // sqrt(x) = x * (1/sqrt(x)), which would be NaN for 0
+  VM_BT zero = VM_FB(vmfeq_vf)(x, 0, vl);
+  VM_VT s = VM_F(vfmul_vv)(
+      x, VM_F(__vmath_rsqrt)(x, VM_P(VMATH_RSQRT_N_FAST), vl), vl);
+  return VM_F(vmerge_vvm)(zero, s, x, vl);
+}
+
+VMATH_INLINE VM_VT VM_F(vdiv_fast)(VM_VT a, VM_VT b, size_t vl) {
+  // q = a * (1/b), corrected by q += (1/b) * (a - b*q) in place of the last
+  // step of the reciprocal
+  VM_VT y = VM_F(__vmath_recip)(b, VM_P(VMATH_RECIP_N_FAST) - 1, vl);
+  VM_VT q = VM_F(vfmul_vv)(a, y, vl);
+  return VM_F(vfmacc_vv)(q, VM_F(vfnmsac_vv)(a, b, q, vl), y, vl);
+}
+
+#undef VMATH_LMUL
+#undef VMATH_MB
@@ -0,0 +1,82 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Vector reduction library (header only)
+//
+// For f64 and f32 arrays, this header defines the inline functions
+//
+//   vred_sum, vred_osum, vred_max, vred_min     (reduction to a scalar)
+//   vred_argmax, vred_argmin                    (index of the first extremum)
+//   vred_segsum                                 (segments given by offsets)
+//   vred_segsum_mask                            (segments given by head flags)
+//
+// named after the element type, e.g., vred_sum_f32(x, n). The _red versions
+// (e.g., vred_sum_red_f32) take and return the running result in element 0
+// of an m1 register, so that the caller can chain or store it without
+// moving it to the scalar core.
+//
+// The unordered reductions accumulate the input into a single LMUL = 8
+// register, element-wise. The accumulator is then folded in halves, with
+// power-of-two slides and vector operations, down to VRED_TREE_MIN elements,
+// and only these are reduced with vfred*. On Ara, the folds use the whole
+// VFUs, while the reduction instructions are latency-bound in the lanes and
+// in the inter-lane tree of the SLDU. VRED_TREE_MIN = the maximum vector
+// length disables the folds. The vred app sweeps this threshold.
+//
+// vred_osum is the ordered sum (vfredosum), i.e., bit-exact with the scalar
+// loop. The other reductions reassociate the sum. NaNs are ignored by the
+// max/min reductions, and by argmax/argmin, which return 0 if all the
+// elements are NaN.
+
+#ifndef VRED_H
+#define VRED_H
+
+#include <math.h>
+#include <riscv_vector.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Number of elements below which the accumulator is reduced with vfred*
+#ifndef VRED_TREE_MIN
+#ifdef NR_LANES
+#define VRED_TREE_MIN (8 * NR_LANES)
+#else
+#define VRED_TREE_MIN 32
+#endif
+#endif
+
+///////////////////
+// Instantiation //
+///////////////////
+
+// VRED_MB is the ratio SEW/LMUL of the mask type of the m4 registers, and
+// VRED_H8 the LMUL of the uint8 registers with the same number of elements
+#define VRED_T double
+#define VRED_SEW 64
+#define VRED_LOG2B 3
+#define VRED_MB 16
+#define VRED_H8 f2
+#include "vred_impl.h"
+
+#define VRED_T float
+#define VRED_SEW 32
+#define VRED_LOG2B 2
+#define VRED_MB 8
+#define VRED_H8 1
+#include "vred_impl.h"
+
+#endif
@@ -0,0 +1,330 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Vector reduction library, type-generic body.
+// Included by vred.h once per SEW, with VRED_T (element type), VRED_SEW,
+// VRED_LOG2B (log2 of the element size), VRED_MB and VRED_H8 defined.
+// Do not include directly.
+
+#ifndef VRED_IMPL_HELPERS
+#define VRED_IMPL_HELPERS
+
+#define VRED_INLINE static inline __attribute__((always_inline))
+
+// Element-wise operation of a reduction
+#define VRED_OP_SUM 0
+#define VRED_OP_MAX 1
+#define VRED_OP_MIN 2
+
+#define VR_CAT2_(a, b) a##b
+#define VR_CAT2(a, b) VR_CAT2_(a, b)
+#define VR_CAT3_(a, b, c) a##b##c
+#define VR_CAT3(a, b, c) VR_CAT3_(a, b, c)
+#define VR_CAT5_(a, b, c, d, e) a##b##c##d##e
+#define VR_CAT5(a, b, c, d, e) VR_CAT5_(a, b, c, d, e)
+#define VR_CAT6_(a, b, c, d, e, f) a##b##c##d##e##f
+#define VR_CAT6(a, b, c, d, e, f) VR_CAT6_(a, b, c, d, e, f)
+
+// Types: m8 data, m4 data and indices, m1 results, masks of the m4 registers
+#define VR_V8 VR_CAT3(vfloat, VRED_SEW, m8_t)
+#define VR_V4 VR_CAT3(vfloat, VRED_SEW, m4_t)
+#define VR_V1 VR_CAT3(vfloat, VRED_SEW, m1_t)
+#define VR_U4 VR_CAT3(vuint, VRED_SEW, m4_t)
+#define VR_U1 VR_CAT3(vuint, VRED_SEW, m1_t)
+#define VR_B4 VR_CAT3(vbool, VRED_MB, _t)
+#define VR_H VR_CAT3(vuint8m, VRED_H8, _t)
+#define VR_UT VR_CAT3(uint, VRED_SEW, _t)
+
+// Intrinsics, e.g., VR_F8(vfadd_vv) -> vfadd_vv_f32m8
+#define VR_F8(op) VR_CAT5(op, _f, VRED_SEW, m8, )
+#define VR_F4(op) VR_CAT5(op, _f, VRED_SEW, m4, )
+#define VR_F1(op) VR_CAT5(op, _f, VRED_SEW, m1, )
+#define VR_U4F(op) VR_CAT5(op, _u, VRED_SEW, m4, )
+#define VR_U1F(op) VR_CAT5(op, _u, VRED_SEW, m1, )
+#define VR_F4M(op) VR_CAT5(op, _f, VRED_SEW, m4, _m)
+#define VR_F4B(op) VR_CAT6(op, _f, VRED_SEW, m4_b, VRED_MB, )
+#define VR_U4B(op) VR_CAT6(op, _u, VRED_SEW, m4_b, VRED_MB, )
+#define VR_B(op) VR_CAT3(op, _b, VRED_MB)
+// Unit-stride memory operations
+#define VR_LD8 VR_CAT5(vle, VRED_SEW, _v_f, VRED_SEW, m8)
+#define VR_LD4 VR_CAT5(vle, VRED_SEW, _v_f, VRED_SEW, m4)
+#define VR_ST1 VR_CAT5(vse, VRED_SEW, _v_f, VRED_SEW, m1)
+// Reductions, e.g., VR_R8(vfredusum_vs) -> vfredusum_vs_f32m8_f32m1
+#define VR_R8(op) VR_CAT6(op, _f, VRED_SEW, m8_f, VRED_SEW, m1)
+#define VR_R4(op) VR_CAT6(op, _f, VRED_SEW, m4_f, VRED_SEW, m1)
+#define VR_RU4(op) VR_CAT6(op, _u, VRED_SEW, m4_u, VRED_SEW, m1)
+
+// Function names, e.g., VR_N(vred_sum) -> vred_sum_f32
+#define VR_N(name) VR_CAT3(name, _f, VRED_SEW)
+
+#endif
+
+// Element-wise op of two accumulators
+VRED_INLINE VR_V8 VR_N(__vred_op)(int op, VR_V8 a, VR_V8 b, size_t vl) {
+  if (op == VRED_OP_MAX)
+    return VR_F8(vfmax_vv)(a, b, vl);
+  if (op == VRED_OP_MIN)
+    return VR_F8(vfmin_vv)(a, b, vl);
+  return VR_F8(vfadd_vv)(a, b, vl);
+}
+
+// red[0] op v[0] op ... op v[vl-1]
+VRED_INLINE VR_V1 VR_N(__vred_red)(int op, VR_V8 v, VR_V1 red, size_t vl) {
+  if (op == VRED_OP_MAX)
+    return VR_R8(vfredmax_vs)(red, v, red, vl);
+  if (op == VRED_OP_MIN)
+    return VR_R8(vfredmin_vs)(red, v, red, vl);
+  return VR_R8(vfredusum_vs)(red, v, red, vl);
+}
+
+// red[0] op x[0] op ... op x[n-1]
+// The full strips are accumulated element-wise, the accumulator is folded
+// down to tree_min elements (a power of two), and the rest is reduced. The
+// partial strip at the end is reduced on its own, since the tail elements of
+// the accumulator are not preserved.
+VRED_INLINE VR_V1 VR_N(__vred_fold)(int op, const VRED_T *x, size_t n,
+                                    VR_V1 red, size_t tree_min) {
+  const size_t vlmax = VR_CAT3(vsetvlmax_e, VRED_SEW, m8)();
+
+  if (n >= vlmax) {
+    VR_V8 acc = VR_LD8(x, vlmax);
+    x += vlmax;
+    n -= vlmax;
+    for (; n >= vlmax; n -= vlmax) {
+      acc = VR_N(__vred_op)(op, acc, VR_LD8(x, vlmax), vlmax);
+      x += vlmax;
+    }
+
+    size_t m = vlmax;
+    while (m > tree_min && m > 1) {
+      m /= 2;
+      acc = VR_N(__vred_op)(op, acc, VR_F8(vslidedown_vx)(acc, acc, m, m), m);
+    }
+    red = VR_N(__vred_red)(op, acc, red, m);
+  }
+
+  if (n > 0) {
+    const size_t vl = VR_CAT3(vsetvl_e, VRED_SEW, m8)(n);
+    red = VR_N(__vred_red)(op, VR_LD8(x, vl), red, vl);
+  }
+
+  return red;
+}
+
+// Index of the first extremum of v[0..vl-1], among the indices idx. The
+// extremum itself is returned in *best (init if all the elements are NaN).
+VRED_INLINE size_t VR_N(__vred_argpick)(int op, VR_V4 v, VR_U4 idx, size_t vl,
+                                        VRED_T init, VRED_T *best) {
+  VR_V1 red = VR_F1(vfmv_v_f)(init, 1);
+  red = (op == VRED_OP_MAX) ? VR_R4(vfredmax_vs)(red, v, red, vl)
+                            : VR_R4(vfredmin_vs)(red, v, red, vl);
+  const VRED_T m = VR_CAT5(vfmv_f_s_f, VRED_SEW, m1_f, VRED_SEW, )(red);
+  *best = m;
+
+  // The indices of the other elements are replaced by the largest one
+  const VR_UT none = (VR_UT)-1;
+  VR_B4 ne = VR_F4B(vmfne_vf)(v, m, vl);
+  VR_U4 cand = VR_U4F(vmerge_vxm)(ne, idx, none, vl);
+  VR_U1 ired = VR_U1F(vmv_v_x)(none, 1);
+  ired = VR_RU4(vredminu_vs)(ired, cand, ired, vl);
+  return VR_CAT5(vmv_x_s_u, VRED_SEW, m1_u, VRED_SEW, )(ired);
+}
+
+// Index of the first maximum (op = VRED_OP_MAX) or minimum of x[0..n-1]
+// The full strips keep the running extremum of each element and its index,
+// so that the reduction across the elements happens only once.
+VRED_INLINE size_t VR_N(__vred_arg)(int op, const VRED_T *x, size_t n) {
+  const size_t vlmax = VR_CAT3(vsetvlmax_e, VRED_SEW, m4)();
+  const VRED_T init = (op == VRED_OP_MAX) ? -INFINITY : INFINITY;
+  VRED_T best = init;
+  size_t ibest = 0;
+  size_t i = 0;
+
+  if (n >= vlmax) {
+    VR_V4 acc = VR_F4(vfmv_v_f)(init, vlmax);
+    VR_U4 idx = VR_U4F(vmv_v_x)(0, vlmax);
+    VR_U4 cur = VR_U4F(vid_v)(vlmax);
+    for (; n - i >= vlmax; i += vlmax) {
+      VR_V4 v = VR_LD4(x + i, vlmax);
+      // NaNs never compare true, and never enter the accumulator
+      VR_B4 b = (op == VRED_OP_MAX) ? VR_F4B(vmfgt_vv)(v, acc, vlmax)
+                                    : VR_F4B(vmflt_vv)(v, acc, vlmax);
+      acc = VR_F4(vmerge_vvm)(b, acc, v, vlmax);
+      idx = VR_U4F(vmerge_vvm)(b, idx, cur, vlmax);
+      cur = VR_U4F(vadd_vx)(cur, vlmax, vlmax);
+    }
+    ibest = VR_N(__vred_argpick)(op, acc, idx, vlmax, init, &best);
+  }
+
+  if (i < n) {
+    const size_t vl = VR_CAT3(vsetvl_e, VRED_SEW, m4)(n - i);
+    VR_U4 idx = VR_U4F(vadd_vx)(VR_U4F(vid_v)(vl), i, vl);
+    VRED_T t;
+    size_t it = VR_N(__vred_argpick)(op, VR_LD4(x + i, vl), idx, vl, init, &t);
+    if ((op == VRED_OP_MAX) ? (t > best) : (t < best))
+      ibest = it;
+  }
+
+  return ibest;
+}
+
+////////////////
+// Public API //
+////////////////
+
+// red[0] + sum(x[0..n-1]), reassociated
+VRED_INLINE VR_V1 VR_N(vred_sum_red)(const VRED_T *x, size_t n, VR_V1 red) {
+  return VR_N(__vred_fold)(VRED_OP_SUM, x, n, red, VRED_TREE_MIN);
+}
+
+// sum(x[0..n-1]), with the folds down to tree_min elements (a power of two)
+VRED_INLINE VRED_T VR_N(vred_sum_tree)(const VRED_T *x, size_t n,
+                                       size_t tree_min) {
+  VR_V1 red = VR_N(__vred_fold)(VRED_OP_SUM, x, n, VR_F1(vfmv_v_f)(0, 1),
+                                tree_min);
+  return VR_CAT5(vfmv_f_s_f, VRED_SEW, m1_f, VRED_SEW, )(red);
+}
+
+VRED_INLINE VRED_T VR_N(vred_sum)(const VRED_T *x, size_t n) {
+  return VR_N(vred_sum_tree)(x, n, VRED_TREE_MIN);
+}
+
+// red[0] + x[0] + ... + x[n-1], in this order
+VRED_INLINE VR_V1 VR_N(vred_osum_red)(const VRED_T *x, size_t n, VR_V1 red) {
+  size_t vl;
+  for (; n > 0; n -= vl) {
+    vl = VR_CAT3(vsetvl_e, VRED_SEW, m8)(n);
+    red = VR_R8(vfredosum_vs)(red, VR_LD8(x, vl), red, vl);
+    x += vl;
+  }
+  return red;
+}
+
+VRED_INLINE VRED_T VR_N(vred_osum)(const VRED_T *x, size_t n) {
+  VR_V1 red = VR_N(vred_osum_red)(x, n, VR_F1(vfmv_v_f)(0, 1));
+  return VR_CAT5(vfmv_f_s_f, VRED_SEW, m1_f, VRED_SEW, )(red);
+}
+
+// max(red[0], x[0..n-1]) and min(red[0], x[0..n-1])
+VRED_INLINE VR_V1 VR_N(vred_max_red)(const VRED_T *x, size_t n, VR_V1 red) {
+  return VR_N(__vred_fold)(VRED_OP_MAX, x, n, red, VRED_TREE_MIN);
+}
+
+VRED_INLINE VR_V1 VR_N(vred_min_red)(const VRED_T *x, size_t n, VR_V1 red) {
+  return VR_N(__vred_fold)(VRED_OP_MIN, x, n, red, VRED_TREE_MIN);
+}
+
+// -inf and +inf for n = 0
+VRED_INLINE VRED_T VR_N(vred_max)(const VRED_T *x, size_t n) {
+  VR_V1 red = VR_N(vred_max_red)(x, n, VR_F1(vfmv_v_f)(-INFINITY, 1));
+  return VR_CAT5(vfmv_f_s_f, VRED_SEW, m1_f, VRED_SEW, )(red);
+}
+
+VRED_INLINE VRED_T VR_N(vred_min)(const VRED_T *x, size_t n) {
+  VR_V1 red = VR_N(vred_min_red)(x, n, VR_F1(vfmv_v_f)(INFINITY, 1));
+  return VR_CAT5(vfmv_f_s_f, VRED_SEW, m1_f, VRED_SEW, )(red);
+}
+
+// Index of the first maximum/minimum of x[0..n-1], 0 for n = 0
+VRED_INLINE size_t VR_N(vred_argmax)(const VRED_T *x, size_t n) {
+  return VR_N(__vred_arg)(VRED_OP_MAX, x, n);
+}
+
+VRED_INLINE size_t VR_N(vred_argmin)(const VRED_T *x, size_t n) {
+  return VR_N(__vred_arg)(VRED_OP_MIN, x, n);
+}
+
+// out[s] = sum(x[off[s]..off[s+1]-1]), for s in [0, nseg)
+// Every segment is reduced as a whole and stored from the vector unit, so the
+// scalar core never waits for the results. Best for segments of a few
+// strips or more; vred_segsum_mask is faster for short ones.
+VRED_INLINE void VR_N(vred_segsum)(const VRED_T *x, const uint32_t *off,
+                                   size_t nseg, VRED_T *out) {
+  for (size_t s = 0; s < nseg; ++s) {
+    VR_V1 red = VR_N(__vred_fold)(VRED_OP_SUM, x + off[s], off[s + 1] - off[s],
+                                  VR_F1(vfmv_v_f)(0, 1), VRED_TREE_MIN);
+    VR_ST1(out + s, red, 1);
+  }
+}
+
+// Segmented sum of x[0..n-1], where head[i] != 0 marks the first element of a
+// segment (the first segment always starts at 0). The sum of the k-th segment
+// is written in out[k], and the number of segments is returned.
+//
+// Every strip is scanned with log2(vl) power-of-two slides (inclusive
+// segmented prefix sum), and the last element of every segment is scattered
+// to out with a masked indexed store. The segment ids come from viota on the
+// head flags. The sum of the segment that is still open at the end of a strip
+// is carried over to the next one.
+VRED_INLINE size_t VR_N(vred_segsum_mask)(const VRED_T *x,
+                                          const uint8_t *head, size_t n,
+                                          VRED_T *out) {
+  // Id of the segment of the current element is base - 1 + heads so far
+  VR_UT base = (n > 0 && head[0]) ? 0 : 1;
+  VRED_T carry = 0;
+  size_t vl;
+
+  for (size_t i = 0; i < n; i += vl) {
+    vl = VR_CAT3(vsetvl_e, VRED_SEW, m4)(n - i);
+
+    VR_H hb = VR_CAT3(vle8_v_u8m, VRED_H8, )(head + i, vl);
+    VR_B4 hm = VR_CAT5(vmsne_vx_u8m, VRED_H8, _b, VRED_MB, )(hb, 0, vl);
+    const VR_U4 zu = VR_U4F(vmv_v_x)(0, vl);
+    const VR_V4 zf = VR_F4(vfmv_v_f)(0, vl);
+    const VR_U4 h = VR_U4F(vmerge_vxm)(hm, zu, 1, vl);
+    VR_V4 xv = VR_LD4(x + i, vl);
+
+    // Inclusive segmented scan: fl[j] is set once a head is seen in the
+    // window that has been summed into v[j]
+    VR_V4 v = xv;
+    VR_U4 fl = h;
+    for (size_t d = 1; d < vl; d *= 2) {
+      VR_B4 open = VR_U4B(vmseq_vx)(fl, 0, vl);
+      v = VR_F4M(vfadd_vv)(open, v, v, VR_F4(vslideup_vx)(zf, v, d, vl), vl);
+      fl = VR_U4F(vor_vv)(fl, VR_U4F(vslideup_vx)(zu, fl, d, vl), vl);
+    }
+    // The elements before the first head continue the previous segment
+    v = VR_F4M(vfadd_vf)(VR_B(vmsbf_m)(hm, vl), v, v, carry, vl);
+
+    // Segment ids, and the last element of every segment
+    VR_U4 id = VR_U4F(vadd_vv)(VR_U4F(viota_m)(hm, vl), h, vl);
+    id = VR_U4F(vadd_vx)(id, base - 1, vl);
+    const VR_UT next = (i + vl < n) ? (head[i + vl] != 0) : 1;
+    VR_B4 last = VR_U4B(vmsne_vx)(VR_U4F(vslide1down_vx)(h, next, vl), 0, vl);
+    VR_U4 boff = VR_U4F(vsll_vx)(id, VRED_LOG2B, vl);
+    VR_CAT5(vsuxei, VRED_SEW, _v_f, VRED_SEW, m4_m)(last, out, boff, v, vl);
+
+    // Sum of the open segment, i.e., of the elements with the last id
+    const size_t nh = VR_B(vpopc_m)(hm, vl);
+    base += nh;
+    if (!next) {
+      VR_B4 other = VR_U4B(vmsne_vx)(id, base - 1, vl);
+      VR_V1 red = VR_F1(vfmv_v_f)(nh ? 0 : carry, 1);
+      red = VR_R4(vfredusum_vs)(red, VR_F4(vfmerge_vfm)(other, xv, 0, vl), red,
+                                vl);
+      carry = VR_CAT5(vfmv_f_s_f, VRED_SEW, m1_f, VRED_SEW, )(red);
+    }
+  }
+
+  return n > 0 ? base : 0;
+}
+
+#undef VRED_T
+#undef VRED_SEW
+#undef VRED_LOG2B
+#undef VRED_MB
+#undef VRED_H8
@@ -0,0 +1,191 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Vector random number generator (header only)
+//
+// Counter-based generator: the i-th 64-bit output of the stream is
+// Philox2x32-10(ctr + i, key) [Salmon et al., SC'11], with the first word in
+// the lower half. The state is the key (the seed) and the counter, which
+// every call advances by the number of outputs it consumed, so that the
+// sequence depends only on the seed and on the starting counter, and not on
+// the vector length. A training loop can restart a stream from any point by
+// setting the counter (e.g., step * n).
+//
+// The register-level functions, for fusion into other kernels, are
+//
+//   vrng_u32m8(s, vl)            32-bit words, one per element
+//   vrng_uniform_f32m8(s, vl)    uniform in [0, 1), 24-bit resolution
+//   vrng_normal_f32m4(s, vl)     standard normal (Box-Muller, common/vmath.h)
+//   vrng_bernoulli_b4(s, t, vl)  mask register for e32/m8, P(1) = t / 65536
+//   vrng_bernoulli_b8(s, t, vl)  same, for e32/m4 and e64/m8
+//
+// and vrng_fill_u32, vrng_uniform_f32, vrng_normal_f32 stripmine them over
+// an array. Stream layout: vrng_u32m8 and vrng_uniform_f32m8 use the two
+// words of each output, vrng_normal_f32m4 turns each output into two normals
+// (cos, sin), and vrng_bernoulli_b* compare each of the four 16-bit halves
+// of an output with the threshold. Odd (or not multiple of four) tails
+// discard the unused words of the last output.
+//
+// Each output is 10 rounds of two multiplications and two XORs on e32
+// vectors, i.e., the mask generation is fully vectorized and never leaves
+// the vector registers. vrng_philox2x32 is the scalar reference.
+
+#ifndef VRNG_H
+#define VRNG_H
+
+#include <riscv_vector.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vmath.h"
+
+typedef struct {
+  uint32_t key;
+  uint64_t ctr;
+} vrng_t;
+
+// Philox2x32 constants
+#define VRNG_PHILOX_M 0xD256D193
+#define VRNG_PHILOX_W 0x9E3779B9
+#ifndef VRNG_ROUNDS
+#define VRNG_ROUNDS 10
+#endif
+
+// Threshold of vrng_bernoulli_b4 for a probability p of a 1
+#define VRNG_BERNOULLI_THR(p) ((uint32_t)((p)*65536.0f + 0.5f))
+
+static inline vrng_t vrng_init(uint32_t seed, uint64_t ctr) {
+  vrng_t s = {seed, ctr};
+  return s;
+}
+
+// Scalar reference: output of the counter ctr
+static inline uint64_t vrng_philox2x32(uint64_t ctr, uint32_t key) {
+  uint32_t x0 = (uint32_t)ctr, x1 = (uint32_t)(ctr >> 32);
+  for (int r = 0; r < VRNG_ROUNDS; ++r) {
+    uint64_t p = (uint64_t)VRNG_PHILOX_M * x0;
+    x0 = (uint32_t)(p >> 32) ^ key ^ x1;
+    x1 = (uint32_t)p;
+    key += VRNG_PHILOX_W;
+  }
+  return ((uint64_t)x1 << 32) | x0;
+}
+
+// n outputs, computed on e32/mL vectors and packed into e64/mW
+#define VRNG_DEFINE_PHILOX(L, W, MB)                                           \
+  static inline vuint64m##W##_t __vrng_philox_u64m##W(vrng_t *s, size_t n) {   \
+    uint32_t lo = (uint32_t)s->ctr, key = s->key;                              \
+    vuint32m##L##_t x0 = vadd_vx_u32m##L(vid_v_u32m##L(n), lo, n);             \
+    vuint32m##L##_t x1 = vmv_v_x_u32m##L((uint32_t)(s->ctr >> 32), n);         \
+    /* Carry of the lower counter word */                                      \
+    vbool##MB##_t c = vmsltu_vx_u32m##L##_b##MB(x0, lo, n);                    \
+    x1 = vadd_vx_u32m##L##_m(c, x1, x1, 1, n);                                 \
+    for (int r = 0; r < VRNG_ROUNDS; ++r) {                                    \
+      vuint32m##L##_t hi = vmulhu_vx_u32m##L(x0, VRNG_PHILOX_M, n);            \
+      hi = vxor_vv_u32m##L(hi, x1, n);                                         \
+      x1 = vmul_vx_u32m##L(x0, VRNG_PHILOX_M, n);                              \
+      x0 = vxor_vx_u32m##L(hi, key, n);                                        \
+      key += VRNG_PHILOX_W;                                                    \
+    }                                                                          \
+    s->ctr += n;                                                               \
+    /* x0 + x1 * 2^32 */                                                       \
+    vuint64m##W##_t p = vwaddu_vv_u64m##W(x0, x1, n);                          \
+    return vwmaccu_vx_u64m##W(p, 0xFFFFFFFF, x1, n);                           \
+  }
+
+VRNG_DEFINE_PHILOX(1, 2, 32)
+VRNG_DEFINE_PHILOX(2, 4, 16)
+VRNG_DEFINE_PHILOX(4, 8, 8)
+
+static inline vuint32m8_t vrng_u32m8(vrng_t *s, size_t vl) {
+  return vreinterpret_v_u64m8_u32m8(__vrng_philox_u64m8(s, (vl + 1) / 2));
+}
+
+static inline vfloat32m8_t vrng_uniform_f32m8(vrng_t *s, size_t vl) {
+  vuint32m8_t u = vsrl_vx_u32m8(vrng_u32m8(s, vl), 8, vl);
+  return vfmul_vf_f32m8(vfcvt_f_xu_v_f32m8(u, vl), 0x1p-24f, vl);
+}
+
+static inline vfloat32m4_t vrng_normal_f32m4(vrng_t *s, size_t vl) {
+  size_t n = (vl + 1) / 2;
+  vuint64m4_t p = __vrng_philox_u64m4(s, n);
+  // u1 in (0, 1], so that log(u1) is finite, and u2 in [0, 1)
+  vuint32m2_t w1 = vsrl_vx_u32m2(vnsrl_wx_u32m2(p, 0, n), 8, n);
+  vuint32m2_t w2 = vsrl_vx_u32m2(vnsrl_wx_u32m2(p, 32, n), 8, n);
+  vfloat32m2_t u1 = vfcvt_f_xu_v_f32m2(vadd_vx_u32m2(w1, 1, n), n);
+  vfloat32m2_t t = vfcvt_f_xu_v_f32m2(w2, n);
+  u1 = vfmul_vf_f32m2(u1, 0x1p-24f, n);
+  t = vfmul_vf_f32m2(t, 0x1p-24f * 6.28318530717958647692f, n);
+  vfloat32m2_t r = vfsqrt_v_f32m2(vfmul_vf_f32m2(vlog_f32m2(u1, n), -2, n), n);
+  vfloat32m2_t z0 = vfmul_vv_f32m2(r, vcos_f32m2(t, n), n);
+  vfloat32m2_t z1 = vfmul_vv_f32m2(r, vsin_f32m2(t, n), n);
+  // Interleave z0 and z1
+  vuint32m2_t b0 = vreinterpret_v_f32m2_u32m2(z0);
+  vuint32m2_t b1 = vreinterpret_v_f32m2_u32m2(z1);
+  vuint64m4_t z = vwmaccu_vx_u64m4(vwaddu_vv_u64m4(b0, b1, n), 0xFFFFFFFF, b1,
+                                   n);
+  return vreinterpret_v_u32m4_f32m4(vreinterpret_v_u64m4_u32m4(z));
+}
+
+// Bernoulli mask with P(1) = thr / 65536, thr in [0, 65536], for the
+// registers with SEW/LMUL = MB (the 16-bit halves are in e16/mH registers)
+#define VRNG_DEFINE_BERNOULLI(MB, H, W)                                        \
+  static inline vbool##MB##_t vrng_bernoulli_b##MB(vrng_t *s, uint32_t thr,    \
+                                                   size_t vl) {                \
+    vuint16m##H##_t h = vreinterpret_v_u64m##W##_u16m##H(                      \
+        __vrng_philox_u64m##W(s, (vl + 3) / 4));                               \
+    if (thr > 0xFFFF)                                                          \
+      return vmset_m_b##MB(vl);                                                \
+    return vmsltu_vx_u16m##H##_b##MB(h, (uint16_t)thr, vl);                    \
+  }
+
+VRNG_DEFINE_BERNOULLI(4, 4, 4)
+VRNG_DEFINE_BERNOULLI(8, 2, 2)
+
+/////////////////
+// Array fills //
+/////////////////
+
+static inline void vrng_fill_u32(vrng_t *s, uint32_t *x, size_t n) {
+  size_t vl;
+  for (size_t i = 0; i < n; i += vl) {
+    vl = vsetvl_e32m8(n - i);
+    vse32_v_u32m8(&x[i], vrng_u32m8(s, vl), vl);
+  }
+}
+
+static inline void vrng_uniform_f32(vrng_t *s, float *x, size_t n) {
+  size_t vl;
+  for (size_t i = 0; i < n; i += vl) {
+    vl = vsetvl_e32m8(n - i);
+    vse32_v_f32m8(&x[i], vrng_uniform_f32m8(s, vl), vl);
+  }
+}
+
+// x[i] = mean + std * N(0, 1)
+static inline void vrng_normal_f32(vrng_t *s, float *x, size_t n, float mean,
+                                   float std) {
+  size_t vl;
+  for (size_t i = 0; i < n; i += vl) {
+    vl = vsetvl_e32m4(n - i);
+    vfloat32m4_t z = vrng_normal_f32m4(s, vl);
+    vse32_v_f32m4(&x[i], vfmadd_vf_f32m4(z, std, vfmv_v_f_f32m4(mean, vl), vl),
+                  vl);
+  }
+}
+
+#endif
@@ -0,0 +1,393 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <riscv_vector.h>
+
+#include "conv2d.h"
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+int64_t conv2d_out_h(const conv2d_params_t *p) {
+  return (p->in_h + 2 * p->pad_h - p->dil_h * (p->k_h - 1) - 1) / p->stride_h +
+         1;
+}
+
+int64_t conv2d_out_w(const conv2d_params_t *p) {
+  return (p->in_w + 2 * p->pad_w - p->dil_w * (p->k_w - 1) - 1) / p->stride_w +
+         1;
+}
+
+// Length of the zero-padded input row used by the DIRECT algorithm
+static int64_t conv2d_direct_row_len(const conv2d_params_t *p) {
+  return conv2d_out_w(p) + p->dil_w * (p->k_w - 1);
+}
+
+static int conv2d_direct_supported(const conv2d_params_t *p) {
+  return p->layout == CONV2D_NCHW && p->stride_w == 1 &&
+         conv2d_direct_row_len(p) <= (int64_t)vsetvlmax_e64m4();
+}
+
+// A 1x1, unit-stride, unpadded convolution is already a matrix multiplication
+// on the input tensor, and does not need the im2col copy
+static int conv2d_is_pointwise(const conv2d_params_t *p) {
+  return p->k_h == 1 && p->k_w == 1 && p->stride_h == 1 && p->stride_w == 1 &&
+         p->pad_h == 0 && p->pad_w == 0;
+}
+
+int64_t conv2d_workspace_size(const conv2d_params_t *p, conv2d_algo_t algo) {
+  if (algo == CONV2D_AUTO)
+    algo = conv2d_select(p);
+  if (algo == CONV2D_DIRECT || conv2d_is_pointwise(p))
+    return 0;
+  // One batch at a time
+  return p->in_ch * p->k_h * p->k_w * conv2d_out_h(p) * conv2d_out_w(p);
+}
+
+conv2d_algo_t conv2d_select(const conv2d_params_t *p) {
+  // The slides cannot emulate a strided window, and NHWC rows interleave the
+  // channels
+  if (!conv2d_direct_supported(p))
+    return CONV2D_IM2COL;
+  // No window to slide, and the matrix multiplication reuses each input row
+  // across multiple output channels without any copy
+  if (conv2d_is_pointwise(p))
+    return CONV2D_IM2COL;
+  // Short output rows leave the lanes idle. The IM2COL algorithm vectorizes
+  // over the whole output plane instead
+  if (conv2d_out_w(p) < CONV2D_DIRECT_MIN_VL)
+    return CONV2D_IM2COL;
+  return CONV2D_DIRECT;
+}
+
+int conv2d(double *o, const double *i, const double *f, double *workspace,
+           const conv2d_params_t *p, conv2d_algo_t algo) {
+  if (algo == CONV2D_AUTO)
+    algo = conv2d_select(p);
+
+  if (algo == CONV2D_DIRECT) {
+    if (!conv2d_direct_supported(p))
+      return -1;
+    conv2d_direct(o, i, f, p);
+  } else {
+    conv2d_im2col(o, i, f, workspace, p);
+  }
+
+  return algo;
+}
+
+////////////
+// DIRECT //
+////////////
+
+// Index of the filter row that links input row ih to output row oh, or -1
+static inline int64_t conv2d_tap_row(int64_t ih, int64_t oh,
+                                     const conv2d_params_t *p) {
+  int64_t d = ih + p->pad_h - oh * p->stride_h;
+  if (d < 0 || d % p->dil_h)
+    return -1;
+  d /= p->dil_h;
+  return d < p->k_h ? d : -1;
+}
+
+// Accumulate one filter tap on output row j of the block
+#define CONV2D_DIRECT_MACC(j)                                                  \
+  if (kh##j >= 0)                                                              \
+    acc##j = vfmacc_vf_f64m4(acc##j, f_[kh##j * p->k_w + kw], tap, vl);
+
+// Sliding-window convolution, generalized from fconv2d_3x3/fconv2d_7x7.
+// CONV2D_DIRECT_BLOCK output rows are accumulated in registers. Every input
+// row that contributes to the block is loaded (and zero-padded) only once;
+// the horizontal filter taps are obtained by sliding it down, and each tap is
+// applied to all the output rows that use it.
+void conv2d_direct(double *o, const double *i, const double *f,
+                   const conv2d_params_t *p) {
+  const int64_t H = p->in_h;
+  const int64_t W = p->in_w;
+  const int64_t Ho = conv2d_out_h(p);
+  const int64_t Wo = conv2d_out_w(p);
+  const int64_t row_len = conv2d_direct_row_len(p);
+  const int64_t pad_w = p->pad_w;
+
+  size_t vl = Wo;
+  vfloat64m4_t acc0, acc1, acc2, acc3;
+  vfloat64m4_t row, tap;
+  vbool16_t pad_r_mask;
+
+  // Mask of the right padding elements of the padded row
+  if (pad_w)
+    pad_r_mask = vmsgeu_vx_u64m4_b16(vid_v_u64m4(row_len), pad_w + W, row_len);
+
+  for (int64_t b = 0; b < p->batch; ++b) {
+    for (int64_t co = 0; co < p->out_ch; ++co) {
+      double *o_ = o + (b * p->out_ch + co) * Ho * Wo;
+
+      for (int64_t oh = 0; oh < Ho; oh += CONV2D_DIRECT_BLOCK) {
+        const int64_t n_rows = MIN(CONV2D_DIRECT_BLOCK, Ho - oh);
+
+        acc0 = vfmv_v_f_f64m4(0, vl);
+        acc1 = vfmv_v_f_f64m4(0, vl);
+        acc2 = vfmv_v_f_f64m4(0, vl);
+        acc3 = vfmv_v_f_f64m4(0, vl);
+
+        // Input rows that contribute to this block of output rows
+        const int64_t ih_first = MAX(oh * p->stride_h - p->pad_h, 0);
+        const int64_t ih_last =
+            MIN((oh + n_rows - 1) * p->stride_h - p->pad_h +
+                    p->dil_h * (p->k_h - 1),
+                H - 1);
+
+        for (int64_t ci = 0; ci < p->in_ch; ++ci) {
+          const double *i_ = i + (b * p->in_ch + ci) * H * W;
+          const double *f_ = f + (co * p->in_ch + ci) * p->k_h * p->k_w;
+
+          for (int64_t ih = ih_first; ih <= ih_last; ++ih) {
+            // Filter row to be used for each output row of the block
+            const int64_t kh0 = conv2d_tap_row(ih, oh + 0, p);
+            const int64_t kh1 = n_rows > 1 ? conv2d_tap_row(ih, oh + 1, p) : -1;
+            const int64_t kh2 = n_rows > 2 ? conv2d_tap_row(ih, oh + 2, p) : -1;
+            const int64_t kh3 = n_rows > 3 ? conv2d_tap_row(ih, oh + 3, p) : -1;
+
+            // Skip the rows that fall between two dilated taps
+            if ((kh0 & kh1 & kh2 & kh3) < 0)
+              continue;
+
+            // Load the input row and pad it with zeroes
+            if (pad_w) {
+              row = vle64_v_f64m4(i_ + ih * W, W);
+              row = vslideup_vx_f64m4(vfmv_v_f_f64m4(0, row_len), row, pad_w,
+                                      row_len);
+              row = vfmerge_vfm_f64m4(pad_r_mask, row, 0, row_len);
+            } else {
+              row = vle64_v_f64m4(i_ + ih * W, row_len);
+            }
+
+            for (int64_t kw = 0; kw < p->k_w; ++kw) {
+              tap = kw ? vslidedown_vx_f64m4(tap, row, kw * p->dil_w, vl) : row;
+              CONV2D_DIRECT_MACC(0)
+              CONV2D_DIRECT_MACC(1)
+              CONV2D_DIRECT_MACC(2)
+              CONV2D_DIRECT_MACC(3)
+            }
+          }
+        }
+
+        vse64_v_f64m4(o_ + (oh + 0) * Wo, acc0, vl);
+        if (n_rows > 1)
+          vse64_v_f64m4(o_ + (oh + 1) * Wo, acc1, vl);
+        if (n_rows > 2)
+          vse64_v_f64m4(o_ + (oh + 2) * Wo, acc2, vl);
+        if (n_rows > 3)
+          vse64_v_f64m4(o_ + (oh + 3) * Wo, acc3, vl);
+      }
+    }
+  }
+}
+
+////////////
+// IM2COL //
+////////////
+
+static void conv2d_zero(double *dst, int64_t len) {
+  size_t avl = len;
+  vfloat64m8_t zero;
+
+  for (size_t vl = vsetvl_e64m8(avl); avl > 0; avl -= vl) {
+    vl = vsetvl_e64m8(avl);
+    zero = vfmv_v_f_f64m8(0, vl);
+    vse64_v_f64m8(dst, zero, vl);
+    dst += vl;
+  }
+}
+
+// Gather len elements, stride elements apart, into a contiguous buffer
+static void conv2d_gather(double *dst, const double *src, int64_t stride,
+                          int64_t len) {
+  size_t avl = len;
+  vfloat64m8_t buf;
+
+  for (size_t vl = vsetvl_e64m8(avl); avl > 0; avl -= vl) {
+    vl = vsetvl_e64m8(avl);
+    if (stride == 1)
+      buf = vle64_v_f64m8(src, vl);
+    else
+      buf = vlse64_v_f64m8(src, stride * sizeof(double), vl);
+    vse64_v_f64m8(dst, buf, vl);
+    dst += vl;
+    src += vl * stride;
+  }
+}
+
+// Range [*lo, *hi) of the output coordinates whose input coordinate
+// o * stride + off falls inside [0, len)
+static void conv2d_valid_range(int64_t *lo, int64_t *hi, int64_t off,
+                               int64_t stride, int64_t len, int64_t out_len) {
+  *lo = off >= 0 ? 0 : (-off + stride - 1) / stride;
+  *hi = (len - 1 - off) < 0 ? 0 : (len - 1 - off) / stride + 1;
+  *lo = MIN(*lo, out_len);
+  *hi = MAX(MIN(*hi, out_len), *lo);
+}
+
+// col = [Ci*Kh*Kw][Ho*Wo], for one batch
+void conv2d_im2col_nchw(double *col, const double *i,
+                        const conv2d_params_t *p) {
+  const int64_t H = p->in_h;
+  const int64_t W = p->in_w;
+  const int64_t Ho = conv2d_out_h(p);
+  const int64_t Wo = conv2d_out_w(p);
+
+  for (int64_t ci = 0; ci < p->in_ch; ++ci) {
+    const double *i_ = i + ci * H * W;
+    for (int64_t kh = 0; kh < p->k_h; ++kh) {
+      for (int64_t kw = 0; kw < p->k_w; ++kw) {
+        const int64_t off_w = kw * p->dil_w - p->pad_w;
+        int64_t ow_lo, ow_hi;
+        conv2d_valid_range(&ow_lo, &ow_hi, off_w, p->stride_w, W, Wo);
+
+        for (int64_t oh = 0; oh < Ho; ++oh) {
+          const int64_t ih = oh * p->stride_h - p->pad_h + kh * p->dil_h;
+          if (ih < 0 || ih >= H) {
+            conv2d_zero(col, Wo);
+          } else {
+            conv2d_zero(col, ow_lo);
+            conv2d_gather(col + ow_lo, i_ + ih * W + ow_lo * p->stride_w + off_w,
+                          p->stride_w, ow_hi - ow_lo);
+            conv2d_zero(col + ow_hi, Wo - ow_hi);
+          }
+          col += Wo;
+        }
+      }
+    }
+  }
+}
+
+// col = [Ho*Wo][Kh*Kw*Ci], for one batch
+void conv2d_im2col_nhwc(double *col, const double *i,
+                        const conv2d_params_t *p) {
+  const int64_t H = p->in_h;
+  const int64_t W = p->in_w;
+  const int64_t Ci = p->in_ch;
+  const int64_t Ho = conv2d_out_h(p);
+  const int64_t Wo = conv2d_out_w(p);
+
+  for (int64_t oh = 0; oh < Ho; ++oh) {
+    for (int64_t ow = 0; ow < Wo; ++ow) {
+      const int64_t off_w = ow * p->stride_w - p->pad_w;
+      // Filter columns that fall inside the input row
+      int64_t kw_lo, kw_hi;
+      conv2d_valid_range(&kw_lo, &kw_hi, off_w, p->dil_w, W, p->k_w);
+
+      for (int64_t kh = 0; kh < p->k_h; ++kh) {
+        const int64_t ih = oh * p->stride_h - p->pad_h + kh * p->dil_h;
+        if (ih < 0 || ih >= H) {
+          conv2d_zero(col, p->k_w * Ci);
+        } else {
+          const double *i_ = i + ih * W * Ci;
+          conv2d_zero(col, kw_lo * Ci);
+          if (p->dil_w == 1) {
+            // The valid part of the window is contiguous in memory
+            conv2d_gather(col + kw_lo * Ci, i_ + (off_w + kw_lo) * Ci, 1,
+                          (kw_hi - kw_lo) * Ci);
+          } else {
+            for (int64_t kw = kw_lo; kw < kw_hi; ++kw)
+              conv2d_gather(col + kw * Ci, i_ + (off_w + kw * p->dil_w) * Ci,
+                            1, Ci);
+          }
+          conv2d_zero(col + kw_hi * Ci, (p->k_w - kw_hi) * Ci);
+        }
+        col += p->k_w * Ci;
+      }
+    }
+  }
+}
+
+// Same 4-row register blocking of fmatmul_4x4, without constraints on the
+// matrix sizes
+void conv2d_gemm(double *c, const double *a, const double *b, int64_t M,
+                 int64_t N, int64_t P) {
+  size_t avl = P;
+  vfloat64m4_t acc0, acc1, acc2, acc3;
+  vfloat64m4_t b_row;
+
+  for (size_t vl = vsetvl_e64m4(avl), p = 0; avl > 0; avl -= vl, p += vl) {
+    vl = vsetvl_e64m4(avl);
+
+    int64_t m = 0;
+    for (; m + 4 <= M; m += 4) {
+      const double *a_ = a + m * N;
+      const double *b_ = b + p;
+
+      acc0 = vfmv_v_f_f64m4(0, vl);
+      acc1 = vfmv_v_f_f64m4(0, vl);
+      acc2 = vfmv_v_f_f64m4(0, vl);
+      acc3 = vfmv_v_f_f64m4(0, vl);
+
+      for (int64_t n = 0; n < N; ++n) {
+        b_row = vle64_v_f64m4(b_, vl);
+        b_ += P;
+        acc0 = vfmacc_vf_f64m4(acc0, a_[0 * N + n], b_row, vl);
+        acc1 = vfmacc_vf_f64m4(acc1, a_[1 * N + n], b_row, vl);
+        acc2 = vfmacc_vf_f64m4(acc2, a_[2 * N + n], b_row, vl);
+        acc3 = vfmacc_vf_f64m4(acc3, a_[3 * N + n], b_row, vl);
+      }
+
+      vse64_v_f64m4(c + (m + 0) * P + p, acc0, vl);
+      vse64_v_f64m4(c + (m + 1) * P + p, acc1, vl);
+      vse64_v_f64m4(c + (m + 2) * P + p, acc2, vl);
+      vse64_v_f64m4(c + (m + 3) * P + p, acc3, vl);
+    }
+
+    // Leftover rows
+    for (; m < M; ++m) {
+      const double *a_ = a + m * N;
+      const double *b_ = b + p;
+
+      acc0 = vfmv_v_f_f64m4(0, vl);
+      for (int64_t n = 0; n < N; ++n) {
+        b_row = vle64_v_f64m4(b_, vl);
+        b_ += P;
+        acc0 = vfmacc_vf_f64m4(acc0, a_[n], b_row, vl);
+      }
+      vse64_v_f64m4(c + m * P + p, acc0, vl);
+    }
+  }
+}
+
+void conv2d_im2col(double *o, const double *i, const double *f,
+                   double *workspace, const conv2d_params_t *p) {
+  const int64_t HWi = p->in_h * p->in_w;
+  const int64_t HWo = conv2d_out_h(p) * conv2d_out_w(p);
+  const int64_t R = p->in_ch * p->k_h * p->k_w;
+  const int pointwise = conv2d_is_pointwise(p);
+
+  for (int64_t b = 0; b < p->batch; ++b) {
+    const double *i_ = i + b * p->in_ch * HWi;
+    double *o_ = o + b * p->out_ch * HWo;
+    const double *col = pointwise ? i_ : workspace;
+
+    if (p->layout == CONV2D_NCHW) {
+      if (!pointwise)
+        conv2d_im2col_nchw(workspace, i_, p);
+      // o[Co][HWo] = f[Co][R] * col[R][HWo]
+      conv2d_gemm(o_, f, col, p->out_ch, R, HWo);
+    } else {
+      if (!pointwise)
+        conv2d_im2col_nhwc(workspace, i_, p);
+      // o[HWo][Co] = col[HWo][R] * f[R][Co]
+      conv2d_gemm(o_, col, f, HWo, R, p->out_ch);
+    }
+  }
+}
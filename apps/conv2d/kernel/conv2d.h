@@ -0,0 +1,98 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Generic 2D convolution layer (float64)
+//
+// Supports arbitrary KhxKw filters, strides, dilations, zero-padding, input
+// and output channels, and batches, in both NCHW and NHWC layouts.
+//
+// NCHW: i = [B][Ci][H][W],  f = [Co][Ci][Kh][Kw], o = [B][Co][Ho][Wo]
+// NHWC: i = [B][H][W][Ci],  f = [Kh][Kw][Ci][Co], o = [B][Ho][Wo][Co]
+//
+// Two algorithms are available:
+// - DIRECT: the sliding-window scheme of fconv2d_3x3/fconv2d_7x7. A block of
+//   output rows is kept in vector registers, each input row is loaded once,
+//   and the filter taps are applied by sliding the row down. NCHW, unit
+//   horizontal stride, and padded rows that fit in one register group only.
+// - IM2COL: the input patches are unrolled in a workspace buffer and the
+//   convolution becomes a matrix multiplication. Works for every shape.
+// conv2d_select() picks one of the two based on the layer shape.
+
+#ifndef CONV2D_H
+#define CONV2D_H
+
+#include <stdint.h>
+
+typedef enum { CONV2D_NCHW = 0, CONV2D_NHWC = 1 } conv2d_layout_t;
+
+typedef enum {
+  CONV2D_AUTO = 0,
+  CONV2D_DIRECT = 1,
+  CONV2D_IM2COL = 2
+} conv2d_algo_t;
+
+typedef struct {
+  int64_t batch;
+  int64_t in_ch;
+  int64_t in_h;
+  int64_t in_w;
+  int64_t out_ch;
+  int64_t k_h;
+  int64_t k_w;
+  int64_t stride_h;
+  int64_t stride_w;
+  int64_t pad_h;
+  int64_t pad_w;
+  int64_t dil_h;
+  int64_t dil_w;
+  conv2d_layout_t layout;
+} conv2d_params_t;
+
+// Number of output rows computed at once by the DIRECT algorithm
+#define CONV2D_DIRECT_BLOCK 4
+// Below this output row length, the DIRECT algorithm cannot fill the lanes
+// and the longer vectors of the IM2COL algorithm are preferred
+#define CONV2D_DIRECT_MIN_VL (4 * NR_LANES)
+
+int64_t conv2d_out_h(const conv2d_params_t *p);
+int64_t conv2d_out_w(const conv2d_params_t *p);
+
+// Size, in elements, of the workspace required by conv2d() with the given
+// algorithm. The workspace is not used by the DIRECT algorithm.
+int64_t conv2d_workspace_size(const conv2d_params_t *p, conv2d_algo_t algo);
+
+// Choose the fastest supported algorithm for the layer
+conv2d_algo_t conv2d_select(const conv2d_params_t *p);
+
+// Run the convolution. With CONV2D_AUTO, the algorithm is chosen by
+// conv2d_select(). Returns the algorithm used, or -1 if the requested
+// algorithm does not support the layer.
+int conv2d(double *o, const double *i, const double *f, double *workspace,
+           const conv2d_params_t *p, conv2d_algo_t algo);
+
+void conv2d_direct(double *o, const double *i, const double *f,
+                   const conv2d_params_t *p);
+void conv2d_im2col(double *o, const double *i, const double *f,
+                   double *workspace, const conv2d_params_t *p);
+
+// Building blocks of the IM2COL algorithm
+void conv2d_im2col_nchw(double *col, const double *i, const conv2d_params_t *p);
+void conv2d_im2col_nhwc(double *col, const double *i, const conv2d_params_t *p);
+// c[MxP] = a[MxN] * b[NxP], no restrictions on M, N, P
+void conv2d_gemm(double *c, const double *a, const double *b, int64_t M,
+                 int64_t N, int64_t P);
+
+#endif
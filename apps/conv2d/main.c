@@ -0,0 +1,122 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel/conv2d.h"
+#include "runtime.h"
+#include "util.h"
+
+#ifndef SPIKE
+#include "printf.h"
+#else
+#include <stdio.h>
+#endif
+
+// Threshold for FP numbers comparison during the final check
+#define THRESHOLD 0.000000001
+
+// Tensors defined in data.S
+extern double i[] __attribute__((aligned(4 * NR_LANES)));
+extern double f[] __attribute__((aligned(4 * NR_LANES)));
+extern double o[] __attribute__((aligned(4 * NR_LANES)));
+extern double workspace[] __attribute__((aligned(4 * NR_LANES)));
+extern double golden_o[] __attribute__((aligned(4 * NR_LANES)));
+// Layer shape defined in data.S
+extern int64_t B, Ci, H, W, Co, K, S, P, D, L;
+
+static const char *algo_name[] = {"auto", "direct", "im2col"};
+
+int verify_tensor(double *tensor, double *golden, int64_t len,
+                  double threshold) {
+  for (int64_t k = 0; k < len; ++k)
+    if (!similarity_check(tensor[k], golden[k], threshold)) {
+      printf("Error: o[%d] = %lf, instead of %lf\n", k, tensor[k], golden[k]);
+      return 1;
+    }
+  return 0;
+}
+
+int main() {
+  printf("\n");
+  printf("============\n");
+  printf("=  CONV2D  =\n");
+  printf("============\n");
+  printf("\n");
+  printf("\n");
+
+  conv2d_params_t p = {.batch = B,
+                       .in_ch = Ci,
+                       .in_h = H,
+                       .in_w = W,
+                       .out_ch = Co,
+                       .k_h = K,
+                       .k_w = K,
+                       .stride_h = S,
+                       .stride_w = S,
+                       .pad_h = P,
+                       .pad_w = P,
+                       .dil_h = D,
+                       .dil_w = D,
+                       .layout = L ? CONV2D_NHWC : CONV2D_NCHW};
+
+  const int64_t Ho = conv2d_out_h(&p);
+  const int64_t Wo = conv2d_out_w(&p);
+  const int64_t o_len = B * Co * Ho * Wo;
+
+  printf("Layout %s, batch %d, %dx%dx%d -> %dx%dx%d, filter %dx%d, stride %d, "
+         "padding %d, dilation %d\n",
+         L ? "NHWC" : "NCHW", B, Ci, H, W, Co, Ho, Wo, K, K, S, P, D);
+
+  int error = 0;
+
+  // Run all the algorithms that support this layer. The automatic choice is
+  // run first
+  for (int algo = CONV2D_AUTO; algo <= CONV2D_IM2COL; ++algo) {
+    memset(o, 0, o_len * sizeof(double));
+
+    start_timer();
+    int used = conv2d(o, i, f, workspace, &p, algo);
+    stop_timer();
+
+    if (used < 0) {
+      printf("[%s] Not supported for this layer.\n", algo_name[algo]);
+      continue;
+    }
+
+    // Performance metrics
+    int64_t runtime = get_timer();
+    float performance = 2.0 * Ci * K * K * o_len / runtime;
+    float utilization = 100 * performance / (2.0 * NR_LANES);
+
+    printf("[%s -> %s] The execution took %d cycles.\n", algo_name[algo],
+           algo_name[used], runtime);
+    printf("[%s -> %s] The performance is %f DPFLOP/cycle (%f%% "
+           "utilization).\n",
+           algo_name[algo], algo_name[used], performance, utilization);
+
+    // Verify correctness
+    if (verify_tensor(o, golden_o, o_len, THRESHOLD)) {
+      printf("[%s -> %s] Fail.\n", algo_name[algo], algo_name[used]);
+      error = 1;
+    } else {
+      printf("[%s -> %s] Passed.\n", algo_name[algo], algo_name[used]);
+    }
+  }
+
+  return error;
+}
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+# Copyright 2022 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# arg1: batch, arg2: input channels, arg3: input height, arg4: input width,
+# arg5: output channels, arg6: filter size, arg7: stride, arg8: padding,
+# arg9: dilation, arg10: layout [nchw|nhwc]
+
+import numpy as np
+import sys
+
+# Reference convolution on NCHW tensors, filter in OIHW format
+def conv2d_nchw(image, kernel, stride, pad, dil):
+  B, Ci, H, W = image.shape
+  Co, _, K, _ = kernel.shape
+  Ho = (H + 2 * pad - dil * (K - 1) - 1) // stride + 1
+  Wo = (W + 2 * pad - dil * (K - 1) - 1) // stride + 1
+  padded = np.pad(image, ((0, 0), (0, 0), (pad, pad), (pad, pad)))
+  output = np.zeros((B, Co, Ho, Wo))
+  for kh in range(K):
+    for kw in range(K):
+      h0 = kh * dil
+      w0 = kw * dil
+      window = padded[:, :, h0:h0 + stride * (Ho - 1) + 1:stride,
+                            w0:w0 + stride * (Wo - 1) + 1:stride]
+      output += np.einsum('bchw,oc->bohw', window, kernel[:, :, kh, kw])
+  return output
+
+def emit(name, array, alignment='8'):
+	print(".global %s" % name)
+	print(".balign " + alignment)
+	print("%s:" % name)
+	bs = array.tobytes()
+	for i in range(0, len(bs), 4):
+		s = ""
+		for n in range(4):
+			s += "%02x" % bs[i+3-n]
+		print("    .word 0x%s" % s)
+
+if len(sys.argv) == 11:
+  B      = int(sys.argv[1])
+  Ci     = int(sys.argv[2])
+  H      = int(sys.argv[3])
+  W      = int(sys.argv[4])
+  Co     = int(sys.argv[5])
+  K      = int(sys.argv[6])
+  stride = int(sys.argv[7])
+  pad    = int(sys.argv[8])
+  dil    = int(sys.argv[9])
+  layout = sys.argv[10]
+else:
+  print("Error. Give me ten arguments: batch, input channels, height, width, output channels, filter size, stride, padding, dilation, layout.")
+  sys.exit()
+
+assert layout in ("nchw", "nhwc"), "Layout not recognized. Available are [nchw|nhwc]"
+
+dtype = np.float64
+
+Ho = (H + 2 * pad - dil * (K - 1) - 1) // stride + 1
+Wo = (W + 2 * pad - dil * (K - 1) - 1) // stride + 1
+assert Ho > 0 and Wo > 0, "The filter does not fit in the padded input"
+
+image  = np.random.rand(B, Ci, H, W).astype(dtype)
+kernel = np.random.rand(Co, Ci, K, K).astype(dtype)
+result = conv2d_nchw(image, kernel, stride, pad, dil).astype(dtype)
+
+if layout == "nhwc":
+  image  = image.transpose(0, 2, 3, 1)
+  kernel = kernel.transpose(2, 3, 1, 0)
+  result = result.transpose(0, 2, 3, 1)
+
+# Workspace for the im2col algorithm (one batch)
+workspace = np.zeros(Ci * K * K * Ho * Wo, dtype=dtype)
+
+print(".section .data,\"aw\",@progbits")
+emit("B", np.array(B, dtype=np.uint64))
+emit("Ci", np.array(Ci, dtype=np.uint64))
+emit("H", np.array(H, dtype=np.uint64))
+emit("W", np.array(W, dtype=np.uint64))
+emit("Co", np.array(Co, dtype=np.uint64))
+emit("K", np.array(K, dtype=np.uint64))
+emit("S", np.array(stride, dtype=np.uint64))
+emit("P", np.array(pad, dtype=np.uint64))
+emit("D", np.array(dil, dtype=np.uint64))
+emit("L", np.array(1 if layout == "nhwc" else 0, dtype=np.uint64))
+emit("i", np.ascontiguousarray(image), 'NR_LANES*4')
+emit("f", np.ascontiguousarray(kernel), 'NR_LANES*4')
+emit("o", np.zeros(result.size, dtype=dtype), 'NR_LANES*4')
+emit("workspace", workspace, 'NR_LANES*4')
+emit("golden_o", np.ascontiguousarray(result), 'NR_LANES*4')
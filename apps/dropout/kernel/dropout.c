@@ -16,7 +16,10 @@
 //
 // Author: Matteo Perotti
 
+#include <math.h>
+
 #include "dropout.h"
+#include "vfuse.h"
 
 // Scalar dropout
 void dropout_gold(const unsigned int n, const float *i, const float scale,
@@ -31,6 +34,80 @@ void dropout_gold(const unsigned int n, const float *i, const float scale,
   }
 }
 
+// Scalar dropout, with the mask stream of vrng_bernoulli_b4: the four 16-bit
+// halves of each Philox output, from the least significant one
+void dropout_rng_gold(const unsigned int n, const float *i, const float scale,
+                      const uint32_t keep, vrng_t *s, float *o) {
+  uint64_t r;
+  for (unsigned int k = 0; k < n; ++k) {
+    if (!(k % 4))
+      r = vrng_philox2x32(s->ctr + k / 4, s->key);
+    o[k] = (r & 0xFFFF) < keep ? (i[k] * scale) : 0;
+    r >>= 16;
+  }
+  s->ctr += (n + 3) / 4;
+}
+
+// The mask is generated in the vector registers, and directly used by the
+// masked multiplication. vl is a multiple of four but in the last strip, so
+// the stream does not depend on the vector length.
+void dropout_rng_vec(const unsigned int n, const float *i, const float scale,
+                     const uint32_t keep, vrng_t *s, float *o) {
+  unsigned int vl;
+
+  vfloat32m8_t vi, vo;
+  vbool4_t vsel_m;
+
+  for (unsigned int avl = n; (vl = vsetvl_e32m8(avl)) > 0; avl -= vl) {
+    // Generate the selection mask
+    vsel_m = vrng_bernoulli_b4(s, keep, vl);
+    // Initialize output vector with zeroes
+    vo = vfmv_v_f_f32m8((float)0, vl);
+    // Load input vector
+    vi = vle32_v_f32m8(i, vl);
+    // Calculate output vector
+    vo = vfmul_vf_f32m8_m(vsel_m, vo, vi, scale, vl);
+    vse32_v_f32m8(o, vo, vl);
+    // Bump pointers
+    i += vl;
+    o += vl;
+  }
+}
+
+// Scalar bias + ReLU + dropout, on rows x len elements
+void dropout_bias_relu_gold(const unsigned int rows, const unsigned int len,
+                            const float *i, const float *bias,
+                            const float scale, const uint32_t keep,
+                            vrng_t *s, float *o) {
+  for (unsigned int r = 0; r < rows; ++r) {
+    for (unsigned int k = 0; k < len; ++k)
+      o[r * len + k] = fmaxf(i[r * len + k] + bias[k], 0);
+    dropout_rng_gold(len, o + r * len, scale, keep, s, o + r * len);
+  }
+}
+
+// Same, as a single fused loop per row: one load of the input (the bias row
+// stays in the cache) and one store per element
+#define VFUSE_SEW 32
+#define VFUSE_LMUL 4
+
+void dropout_bias_relu_vec(const unsigned int rows, const unsigned int len,
+                           const float *i, const float *bias,
+                           const float scale, const uint32_t keep, vrng_t *s,
+                           float *o) {
+  for (unsigned int r = 0; r < rows; ++r) {
+    const float *i_ = i + r * len;
+    float *o_ = o + r * len;
+    VFUSE_FOR(len) {
+      VF_T x = VF_RELU(VF_ADD(VF_LD(i_), VF_LD(bias)));
+      VF_ST(o_, VF_DROPOUT(x, s, keep, scale));
+    }
+  }
+}
+
+#undef VFUSE_SEW
+#undef VFUSE_LMUL
+
 #ifdef INTRINSICS
 void dropout_vec(const unsigned int n, const float *i, const float scale,
                  const uint8_t *sel_ptr, float *o) {
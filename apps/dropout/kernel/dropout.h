@@ -28,6 +28,7 @@
 #undef INTRINSICS
 
 #include "runtime.h"
+#include "vrng.h"
 
 #ifndef SPIKE
 #include "printf.h"
@@ -38,4 +39,23 @@ void dropout_gold(const unsigned int n, const float *i, const float scale,
 void dropout_vec(const unsigned int n, const float *i, const float scale,
                  const uint8_t *sel_ptr, float *o);
 
+// Dropout with the selection mask generated on the fly by common/vrng.h.
+// Each element is kept with probability keep / 65536 (see VRNG_BERNOULLI_THR)
+// and the generator is advanced past the n elements, so that consecutive
+// calls draw fresh masks.
+void dropout_rng_gold(const unsigned int n, const float *i, const float scale,
+                      const uint32_t keep, vrng_t *s, float *o);
+void dropout_rng_vec(const unsigned int n, const float *i, const float scale,
+                     const uint32_t keep, vrng_t *s, float *o);
+
+// o = dropout(relu(i + bias)), on rows x len elements, bias of len elements
+void dropout_bias_relu_gold(const unsigned int rows, const unsigned int len,
+                            const float *i, const float *bias,
+                            const float scale, const uint32_t keep,
+                            vrng_t *s, float *o);
+void dropout_bias_relu_vec(const unsigned int rows, const unsigned int len,
+                           const float *i, const float *bias,
+                           const float scale, const uint32_t keep, vrng_t *s,
+                           float *o);
+
 #endif
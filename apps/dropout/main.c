@@ -21,15 +21,128 @@
 // Compiler support:
 // https://github.com/riscv/riscv-gnu-toolchain/tree/rvv-intrinsic
 
+#include <math.h>
+
 #include "kernel/dropout.h"
 
 extern const unsigned int N;
 extern const float SCALE;
+extern const float P;
+extern const float BIAS[] __attribute__((aligned(4 * NR_LANES)));
+extern const uint32_t SEED;
 extern const float I[] __attribute__((aligned(4 * NR_LANES)));
 extern const uint8_t SEL[] __attribute__((aligned(4 * NR_LANES)));
 extern float o[] __attribute__((aligned(4 * NR_LANES)));
 extern float o_gold[] __attribute__((aligned(4 * NR_LANES)));
 
+// Compare the vector and scalar outputs
+int check(const char *name, const float *x, const float *g, unsigned int n,
+          float tol) {
+  for (unsigned int k = 0; k < n; ++k) {
+    if (!(fabsf(x[k] - g[k]) <= tol * fmaxf(1, fabsf(g[k])))) {
+      printf("Error: %s[%d] = %f != %f\n", name, k, x[k], g[k]);
+      return k ? k : -1;
+    }
+  }
+  return 0;
+}
+
+// On-device masks: two training steps, the second one on a tail that is not
+// a multiple of four elements
+int test_rng() {
+  const uint32_t keep = VRNG_BERNOULLI_THR(1 - P);
+  vrng_t s = vrng_init(SEED, 0), s_gold = s;
+  int err;
+
+  for (int step = 0; step < 2; ++step) {
+    unsigned int n = (step && N > 3) ? N - 3 : N;
+    start_timer();
+    dropout_rng_vec(n, I, SCALE, keep, &s, o);
+    stop_timer();
+    int64_t runtime = get_timer();
+    dropout_rng_gold(n, I, SCALE, keep, &s_gold, o_gold);
+
+    unsigned int kept = 0;
+    for (unsigned int k = 0; k < n; ++k)
+      kept += o_gold[k] != 0;
+    printf("On-device mask, step %d: %d cycles, kept %d/%d elements (p = "
+           "%f).\n",
+           step, runtime, kept, n, P);
+
+    if ((err = check("o", o, o_gold, n, 0)))
+      return err;
+    if (s.ctr != s_gold.ctr) {
+      printf("Error: counter %d != %d\n", (int)s.ctr, (int)s_gold.ctr);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+// Bias + ReLU + dropout in one fused loop (common/vfuse.h), on 4 rows
+int test_fused() {
+  const uint32_t keep = VRNG_BERNOULLI_THR(1 - P);
+  const unsigned int rows = 4, len = N / 4;
+  vrng_t s = vrng_init(SEED, 1 << 20), s_gold = s;
+
+  start_timer();
+  dropout_bias_relu_vec(rows, len, I, BIAS, SCALE, keep, &s, o);
+  stop_timer();
+  int64_t runtime = get_timer();
+  printf("Fused bias + ReLU + dropout: %d cycles.\n", runtime);
+
+  dropout_bias_relu_gold(rows, len, I, BIAS, SCALE, keep, &s_gold, o_gold);
+  return check("o", o, o_gold, rows * len, 0);
+}
+
+// Generic API of common/vrng.h, on an odd number of elements
+int test_vrng() {
+  const unsigned int n = N - 1;
+  vrng_t s = vrng_init(SEED, (uint64_t)0xFFFFFFFF - N / 8);
+  uint32_t *u = (uint32_t *)o;
+  int err;
+
+  // Raw words, across a carry of the lower counter word
+  vrng_t t = s;
+  vrng_fill_u32(&t, u, n);
+  for (unsigned int k = 0; k < n; ++k) {
+    uint64_t r = vrng_philox2x32(s.ctr + k / 2, s.key);
+    uint32_t g = (uint32_t)(r >> (k % 2 ? 32 : 0));
+    if (u[k] != g) {
+      printf("Error: u32[%d] = %x != %x\n", k, u[k], g);
+      return k ? k : -1;
+    }
+  }
+
+  // Uniform, bit-exact
+  t = s;
+  vrng_uniform_f32(&t, o, n);
+  for (unsigned int k = 0; k < n; ++k) {
+    uint64_t r = vrng_philox2x32(s.ctr + k / 2, s.key);
+    o_gold[k] = (float)((uint32_t)(r >> (k % 2 ? 32 : 0)) >> 8) * 0x1p-24f;
+  }
+  if ((err = check("uniform", o, o_gold, n, 0)))
+    return err;
+
+  // Normal, versus the scalar Box-Muller transform
+  t = s;
+  vrng_normal_f32(&t, o, n, 0, 1);
+  double mean = 0, var = 0;
+  for (unsigned int k = 0; k < n; ++k) {
+    uint64_t r = vrng_philox2x32(s.ctr + k / 2, s.key);
+    float u1 = (float)(((uint32_t)r >> 8) + 1) * 0x1p-24f;
+    float u2 = (float)((uint32_t)(r >> 32) >> 8) * 0x1p-24f;
+    float rho = sqrtf(-2 * logf(u1)), th = 6.28318530717958647692f * u2;
+    o_gold[k] = k % 2 ? rho * sinf(th) : rho * cosf(th);
+    mean += o[k];
+    var += o[k] * o[k];
+  }
+  mean /= n;
+  var = var / n - mean * mean;
+  printf("Normal samples: mean %f, variance %f.\n", (float)mean, (float)var);
+  return check("normal", o, o_gold, n, 1e-4);
+}
+
 int main() {
   printf("\n");
   printf("=============\n");
@@ -68,6 +181,11 @@ int main() {
       return k ? k : -1;
     }
   }
+
+  int err;
+  if ((err = test_rng()) || (err = test_fused()) || (err = test_vrng()))
+    return err;
+
   printf("Passed.\n");
 
   return 0;
@@ -47,6 +47,11 @@ else:
 I     = rand_array(N, np.float32)
 SCALE = rand_array(1, np.float32)[0]
 SEL   = rand_sel(N, np.uint8)
+# Bias of the fused kernel, on 4 rows
+BIAS  = rand_array(N // 4, np.float32) - np.float32(0.5)
+# Drop probability and seed of the on-device masks
+P     = np.float32(0.25)
+SEED  = np.random.randint(0, 2**32, dtype=np.uint64)
 
 # Create the empty o matrix
 o = np.zeros(N).astype(np.float32)
@@ -56,6 +61,9 @@ o_gold = o
 print(".section .data,\"aw\",@progbits")
 emit("N", np.array(N, dtype=np.uint64))
 emit("SCALE", np.array(SCALE, dtype=np.float32))
+emit("P", np.array(P, dtype=np.float32))
+emit("SEED", np.array(SEED, dtype=np.uint32))
+emit("BIAS", BIAS, 'NR_LANES*4')
 emit("I", I, 'NR_LANES*4')
 emit("SEL", SEL, 'NR_LANES*4')
 emit("o", o, 'NR_LANES*4')
@@ -167,3 +167,541 @@ void gsl_wavelet_transform_vector(float *data, size_t n, float *buf,
       i = 0;
   }
 }
+
+///////////////////////////////
+// Daubechies wavelet family //
+///////////////////////////////
+
+// Filter coefficients, from I. Daubechies, "Ten Lectures on Wavelets" (as in
+// GSL). g[k] = (-1)^k * h[nc-1-k]. The Daubechies-2 wavelet is the Haar one.
+static const float h_4[4] = {
+    0.48296291314453414337f, 0.83651630373780790557f, 0.22414386804201338102f,
+    -0.12940952255126038117f};
+static const float g_4[4] = {
+    -0.12940952255126038117f, -0.22414386804201338102f, 0.83651630373780790557f,
+    -0.48296291314453414337f};
+static const float h_6[6] = {
+    0.33267055295008261599f, 0.80689150931109257649f, 0.45987750211849157009f,
+    -0.13501102001025458869f, -0.085441273882026661692f,
+    0.035226291885709536602f};
+static const float g_6[6] = {
+    0.035226291885709536602f, 0.085441273882026661692f,
+    -0.13501102001025458869f, -0.45987750211849157009f, 0.80689150931109257649f,
+    -0.33267055295008261599f};
+static const float h_8[8] = {
+    0.23037781330889650086f, 0.71484657055291564708f, 0.63088076792985890788f,
+    -0.027983769416859854211f, -0.18703481171909308407f,
+    0.030841381835560763627f, 0.032883011666885199735f,
+    -0.010597401785069032104f};
+static const float g_8[8] = {
+    -0.010597401785069032104f, -0.032883011666885199735f,
+    0.030841381835560763627f, 0.18703481171909308407f,
+    -0.027983769416859854211f, -0.63088076792985890788f,
+    0.71484657055291564708f, -0.23037781330889650086f};
+static const float h_10[10] = {
+    0.16010239797419291448f, 0.60382926979718967054f, 0.72430852843777292772f,
+    0.13842814590132073150f, -0.24229488706638203186f,
+    -0.032244869584638374648f, 0.077571493840045713523f,
+    -0.0062414902127982742741f, -0.012580751999081999468f,
+    0.0033357252854737712779f};
+static const float g_10[10] = {
+    0.0033357252854737712779f, 0.012580751999081999468f,
+    -0.0062414902127982742741f, -0.077571493840045713523f,
+    -0.032244869584638374648f, 0.24229488706638203186f, 0.13842814590132073150f,
+    -0.72430852843777292772f, 0.60382926979718967054f,
+    -0.16010239797419291448f};
+static const float h_12[12] = {
+    0.11154074335010946362f, 0.49462389039845308567f, 0.75113390802109535067f,
+    0.31525035170919762908f, -0.22626469396543982007f, -0.12976686756726193556f,
+    0.097501605587323049102f, 0.027522865530305728625f,
+    -0.031582039317486029565f, 0.00055384220116149613925f,
+    0.0047772575109455106396f, -0.0010773010853084795648f};
+static const float g_12[12] = {
+    -0.0010773010853084795648f, -0.0047772575109455106396f,
+    0.00055384220116149613925f, 0.031582039317486029565f,
+    0.027522865530305728625f, -0.097501605587323049102f,
+    -0.12976686756726193556f, 0.22626469396543982007f, 0.31525035170919762908f,
+    -0.75113390802109535067f, 0.49462389039845308567f,
+    -0.11154074335010946362f};
+static const float h_14[14] = {
+    0.077852054085009179019f, 0.39653931948191730653f, 0.72913209084623511991f,
+    0.46978228740519312247f, -0.14390600392856497540f, -0.22403618499387498263f,
+    0.071309219266830264750f, 0.080612609151083071912f,
+    -0.038029936935014413579f, -0.016574541630666880654f,
+    0.012550998556099840612f, 0.00042957797292136652113f,
+    -0.0018016407040474909152f, 0.00035371379997452024844f};
+static const float g_14[14] = {
+    0.00035371379997452024844f, 0.0018016407040474909152f,
+    0.00042957797292136652113f, -0.012550998556099840612f,
+    -0.016574541630666880654f, 0.038029936935014413579f,
+    0.080612609151083071912f, -0.071309219266830264750f,
+    -0.22403618499387498263f, 0.14390600392856497540f, 0.46978228740519312247f,
+    -0.72913209084623511991f, 0.39653931948191730653f,
+    -0.077852054085009179019f};
+static const float h_16[16] = {
+    0.054415842243104009955f, 0.31287159091429997065f, 0.67563073629728980680f,
+    0.58535468365420671277f, -0.015829105256349305667f,
+    -0.28401554296154692651f, 0.00047248457391328277036f,
+    0.12874742662047845885f, -0.017369301001807546169f,
+    -0.044088253930794751506f, 0.013981027917398281648f,
+    0.0087460940474057767163f, -0.0048703529934515743104f,
+    -0.00039174037337694704629f, 0.00067544940645056936636f,
+    -0.00011747678412476953373f};
+static const float g_16[16] = {
+    -0.00011747678412476953373f, -0.00067544940645056936636f,
+    -0.00039174037337694704629f, 0.0048703529934515743104f,
+    0.0087460940474057767163f, -0.013981027917398281648f,
+    -0.044088253930794751506f, 0.017369301001807546169f,
+    0.12874742662047845885f, -0.00047248457391328277036f,
+    -0.28401554296154692651f, 0.015829105256349305667f, 0.58535468365420671277f,
+    -0.67563073629728980680f, 0.31287159091429997065f,
+    -0.054415842243104009955f};
+static const float h_18[18] = {
+    0.038077947363878346588f, 0.24383467461259035373f, 0.60482312369011111190f,
+    0.65728807805130053807f, 0.13319738582500757619f, -0.29327378327917490880f,
+    -0.096840783222976460513f, 0.14854074933810638013f,
+    0.030725681479333379212f, -0.067632829061329973675f,
+    0.00025094711483145195758f, 0.022361662123679097205f,
+    -0.0047232047577513972779f, -0.0042815036824634298344f,
+    0.0018476468830562264766f, 0.00023038576352319596720f,
+    -0.00025196318894271013697f, 3.9347320316271599480e-05f};
+static const float g_18[18] = {
+    3.9347320316271599480e-05f, 0.00025196318894271013697f,
+    0.00023038576352319596720f, -0.0018476468830562264766f,
+    -0.0042815036824634298344f, 0.0047232047577513972779f,
+    0.022361662123679097205f, -0.00025094711483145195758f,
+    -0.067632829061329973675f, -0.030725681479333379212f,
+    0.14854074933810638013f, 0.096840783222976460513f, -0.29327378327917490880f,
+    -0.13319738582500757619f, 0.65728807805130053807f, -0.60482312369011111190f,
+    0.24383467461259035373f, -0.038077947363878346588f};
+static const float h_20[20] = {
+    0.026670057900555553586f, 0.18817680007769148902f, 0.52720118893172558648f,
+    0.68845903945360356574f, 0.28117234366057746074f, -0.24984642432731537941f,
+    -0.19594627437737704350f, 0.12736934033579326008f, 0.093057364603572351160f,
+    -0.071394147166397087145f, -0.029457536821875812858f,
+    0.033212674059341001739f, 0.0036065535669561696554f,
+    -0.010733175483330575044f, 0.0013953517470529011657f,
+    0.0019924052951850561171f, -0.00068585669495971162656f,
+    -0.00011646685512928545095f, 9.3588670320069591334e-05f,
+    -1.3264202894521244812e-05f};
+static const float g_20[20] = {
+    -1.3264202894521244812e-05f, -9.3588670320069591334e-05f,
+    -0.00011646685512928545095f, 0.00068585669495971162656f,
+    0.0019924052951850561171f, -0.0013953517470529011657f,
+    -0.010733175483330575044f, -0.0036065535669561696554f,
+    0.033212674059341001739f, 0.029457536821875812858f,
+    -0.071394147166397087145f, -0.093057364603572351160f,
+    0.12736934033579326008f, 0.19594627437737704350f, -0.24984642432731537941f,
+    -0.28117234366057746074f, 0.68845903945360356574f, -0.52720118893172558648f,
+    0.18817680007769148902f, -0.026670057900555553586f};
+
+static int daubechies_init(const float **h1, const float **g1,
+                           const float **h2, const float **g2, size_t *nc,
+                           size_t *offset, size_t member) {
+  switch (member) {
+  case 2:
+    *h1 = ch_2;
+    *g1 = cg_2;
+    break;
+#define DAUBECHIES_CASE(n)                                                     \
+  case n:                                                                      \
+    *h1 = h_##n;                                                               \
+    *g1 = g_##n;                                                               \
+    break;
+    DAUBECHIES_CASE(4)
+    DAUBECHIES_CASE(6)
+    DAUBECHIES_CASE(8)
+    DAUBECHIES_CASE(10)
+    DAUBECHIES_CASE(12)
+    DAUBECHIES_CASE(14)
+    DAUBECHIES_CASE(16)
+    DAUBECHIES_CASE(18)
+    DAUBECHIES_CASE(20)
+#undef DAUBECHIES_CASE
+  default:
+    return -1;
+  }
+
+  // Orthogonal wavelets: the synthesis filters are the analysis ones
+  *h2 = *h1;
+  *g2 = *g1;
+  *nc = member;
+  *offset = 0;
+  return 0;
+}
+
+static int daubechies_centered_init(const float **h1, const float **g1,
+                                    const float **h2, const float **g2,
+                                    size_t *nc, size_t *offset,
+                                    size_t member) {
+  int err = daubechies_init(h1, g1, h2, g2, nc, offset, member);
+  *offset = member >> 1;
+  return err;
+}
+
+static const gsl_wavelet_type daubechies_type = {"daubechies",
+                                                 &daubechies_init};
+static const gsl_wavelet_type daubechies_centered_type = {
+    "daubechies-centered", &daubechies_centered_init};
+
+const gsl_wavelet_type *gsl_wavelet_daubechies = &daubechies_type;
+const gsl_wavelet_type *gsl_wavelet_daubechies_centered =
+    &daubechies_centered_type;
+
+int gsl_wavelet_init(gsl_wavelet *w, const gsl_wavelet_type *T, size_t k) {
+  return T->init(&w->h1, &w->g1, &w->h2, &w->g2, &w->nc, &w->offset, k);
+}
+
+// Number of levels of the transform of n samples
+static size_t dwt_levels(size_t n, size_t levels) {
+  size_t max = 0;
+  while ((n >> max) > 1)
+    ++max;
+  return (levels == 0 || levels > max) ? max : levels;
+}
+
+////////////////////
+// Scalar version //
+////////////////////
+
+// One level on a[0..n-1], as in GSL. The output is built in work and copied
+// back.
+static void dwt_step_generic(const gsl_wavelet *w, float *a, size_t n,
+                             gsl_wavelet_direction dir, float *work) {
+  const size_t nmod = w->nc * n - w->offset; // center support
+  const size_t n1 = n - 1;
+  const size_t nh = n >> 1;
+
+  for (size_t i = 0; i < n; ++i)
+    work[i] = 0;
+
+  if (dir == gsl_wavelet_forward) {
+    for (size_t i = 0, ii = 0; i < n; i += 2, ++ii) {
+      float h = 0, g = 0;
+      const size_t ni = i + nmod;
+      for (size_t k = 0; k < w->nc; ++k) {
+        const size_t jf = n1 & (ni + k);
+        h += w->h1[k] * a[jf];
+        g += w->g1[k] * a[jf];
+      }
+      work[ii] += h;
+      work[ii + nh] += g;
+    }
+  } else {
+    for (size_t i = 0, ii = 0; i < n; i += 2, ++ii) {
+      const float ai = a[ii];
+      const float ai1 = a[ii + nh];
+      const size_t ni = i + nmod;
+      for (size_t k = 0; k < w->nc; ++k) {
+        const size_t jf = n1 & (ni + k);
+        work[jf] += w->h2[k] * ai + w->g2[k] * ai1;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < n; ++i)
+    a[i] = work[i];
+}
+
+void gsl_wavelet_dwt(const gsl_wavelet *w, float *data, size_t n,
+                     size_t levels, gsl_wavelet_direction dir, float *work) {
+  const size_t l = dwt_levels(n, levels);
+
+  if (dir == gsl_wavelet_forward) {
+    for (size_t i = 0; i < l; ++i)
+      dwt_step_generic(w, data, n >> i, dir, work);
+  } else {
+    for (size_t i = l; i > 0; --i)
+      dwt_step_generic(w, data, n >> (i - 1), dir, work);
+  }
+}
+
+void gsl_wavelet2d_dwt(const gsl_wavelet *w, float *data, size_t size1,
+                       size_t size2, size_t levels, gsl_wavelet_direction dir,
+                       float *work) {
+  float *col = work + (size1 > size2 ? size1 : size2);
+
+  for (size_t i = 0; i < size1; ++i)
+    gsl_wavelet_dwt(w, data + i * size2, size2, levels, dir, work);
+
+  for (size_t j = 0; j < size2; ++j) {
+    for (size_t i = 0; i < size1; ++i)
+      col[i] = data[i * size2 + j];
+    gsl_wavelet_dwt(w, col, size1, levels, dir, work);
+    for (size_t i = 0; i < size1; ++i)
+      data[i * size2 + j] = col[i];
+  }
+}
+
+////////////////////
+// Vector version //
+////////////////////
+
+// Periodic index of the sample i, for n a power of two. i can be "negative".
+#define DWT_WRAP(i, n) ((i) & ((n)-1))
+
+// Accumulate the tap k of the filter f on v into acc, if the tap exists.
+// first tracks whether acc is still to be initialized.
+#define DWT_TAP(acc, first, f, k, v, vl)                                       \
+  do {                                                                         \
+    if ((k) >= 0 && (k) < (ptrdiff_t)w->nc) {                                  \
+      acc = first ? vfmul_vf_f32m4(v, f[k], vl)                                \
+                  : vfmacc_vf_f32m4(acc, f[k], v, vl);                         \
+      first = 0;                                                               \
+    }                                                                          \
+  } while (0)
+
+// One forward level: s[j] = sum_k h1[k] * x[2j + k - offset] (periodic), and
+// d[j] with g1, for j in [0, m/2).
+//
+// With k - offset = 2p + r, the tap k multiplies the even (r = 0) or the odd
+// (r = 1) samples, shifted by p. One unit-stride load of 2*vl samples is split
+// into the even and odd vectors with two narrowing shifts. The shifted
+// vectors follow with slide1up/slide1down, whose new element is the only
+// access out of the strip, so the wrap-around costs a masked scalar index.
+static void dwt_fwd_vector(const gsl_wavelet *w, const float *x, size_t m,
+                           float *s, float *d) {
+  const ptrdiff_t off = w->offset;
+  const ptrdiff_t nc = w->nc;
+  // Range of the shifts p
+  const ptrdiff_t pmin = -((off + 1) / 2);
+  const ptrdiff_t pmax = (nc - 1 - off) >> 1;
+  const size_t nh = m >> 1;
+
+  size_t vl;
+  for (size_t j = 0; j < nh; j += vl) {
+    vl = vsetvl_e32m4(nh - j);
+
+    vuint64m8_t pairs = vle64_v_u64m8((const uint64_t *)(x + 2 * j), vl);
+    vfloat32m4_t e0 = vreinterpret_v_u32m4_f32m4(vnsrl_wx_u32m4(pairs, 0, vl));
+    vfloat32m4_t o0 =
+        vreinterpret_v_u32m4_f32m4(vnsrl_wx_u32m4(pairs, 32, vl));
+
+    vfloat32m4_t sv, dv;
+    int first_s = 1, first_d = 1;
+
+    // p = 0 and p > 0
+    vfloat32m4_t e = e0, o = o0;
+    for (ptrdiff_t p = 0; p <= pmax; ++p) {
+      if (p > 0) {
+        const size_t t = 2 * (j + vl - 1 + p);
+        e = vfslide1down_vf_f32m4(e, x[DWT_WRAP(t, m)], vl);
+        o = vfslide1down_vf_f32m4(o, x[DWT_WRAP(t + 1, m)], vl);
+      }
+      DWT_TAP(sv, first_s, w->h1, 2 * p + off, e, vl);
+      DWT_TAP(dv, first_d, w->g1, 2 * p + off, e, vl);
+      DWT_TAP(sv, first_s, w->h1, 2 * p + 1 + off, o, vl);
+      DWT_TAP(dv, first_d, w->g1, 2 * p + 1 + off, o, vl);
+    }
+
+    // p < 0
+    e = e0;
+    o = o0;
+    for (ptrdiff_t p = -1; p >= pmin; --p) {
+      const size_t t = 2 * j + 2 * p;
+      e = vfslide1up_vf_f32m4(e, x[DWT_WRAP(t, m)], vl);
+      o = vfslide1up_vf_f32m4(o, x[DWT_WRAP(t + 1, m)], vl);
+      DWT_TAP(sv, first_s, w->h1, 2 * p + off, e, vl);
+      DWT_TAP(dv, first_d, w->g1, 2 * p + off, e, vl);
+      DWT_TAP(sv, first_s, w->h1, 2 * p + 1 + off, o, vl);
+      DWT_TAP(dv, first_d, w->g1, 2 * p + 1 + off, o, vl);
+    }
+
+    vse32_v_f32m4(s + j, sv, vl);
+    vse32_v_f32m4(d + j, dv, vl);
+  }
+}
+
+// One backward level: x[2q + r] = sum_p h2[2p + r + offset] * s[q - p] +
+// g2[2p + r + offset] * d[q - p] (periodic), for q in [0, m/2).
+//
+// The even and odd outputs are computed as two vectors, from the shifted
+// s and d, and interleaved by a widening add and multiply-accumulate
+// (e + o * 2^32) into a single unit-stride store.
+static void dwt_inv_vector(const gsl_wavelet *w, const float *s,
+                           const float *d, size_t m, float *x) {
+  const ptrdiff_t off = w->offset;
+  const ptrdiff_t nc = w->nc;
+  // Range of the shifts p, for both parities
+  const ptrdiff_t pmin = -((off + 1) / 2);
+  const ptrdiff_t pmax = (nc - 1 - off) >> 1;
+  const size_t nh = m >> 1;
+
+  size_t vl;
+  for (size_t q = 0; q < nh; q += vl) {
+    vl = vsetvl_e32m4(nh - q);
+
+    const vfloat32m4_t s0 = vle32_v_f32m4(s + q, vl);
+    const vfloat32m4_t d0 = vle32_v_f32m4(d + q, vl);
+
+    vfloat32m4_t xe, xo;
+    int first_e = 1, first_o = 1;
+
+    // p = 0 and p > 0: s[q - p] is s0 slid up
+    vfloat32m4_t sp = s0, dp = d0;
+    for (ptrdiff_t p = 0; p <= pmax; ++p) {
+      if (p > 0) {
+        const size_t t = q - p;
+        sp = vfslide1up_vf_f32m4(sp, s[DWT_WRAP(t, nh)], vl);
+        dp = vfslide1up_vf_f32m4(dp, d[DWT_WRAP(t, nh)], vl);
+      }
+      DWT_TAP(xe, first_e, w->h2, 2 * p + off, sp, vl);
+      DWT_TAP(xe, first_e, w->g2, 2 * p + off, dp, vl);
+      DWT_TAP(xo, first_o, w->h2, 2 * p + 1 + off, sp, vl);
+      DWT_TAP(xo, first_o, w->g2, 2 * p + 1 + off, dp, vl);
+    }
+
+    // p < 0
+    sp = s0;
+    dp = d0;
+    for (ptrdiff_t p = -1; p >= pmin; --p) {
+      const size_t t = q + vl - 1 - p;
+      sp = vfslide1down_vf_f32m4(sp, s[DWT_WRAP(t, nh)], vl);
+      dp = vfslide1down_vf_f32m4(dp, d[DWT_WRAP(t, nh)], vl);
+      DWT_TAP(xe, first_e, w->h2, 2 * p + off, sp, vl);
+      DWT_TAP(xe, first_e, w->g2, 2 * p + off, dp, vl);
+      DWT_TAP(xo, first_o, w->h2, 2 * p + 1 + off, sp, vl);
+      DWT_TAP(xo, first_o, w->g2, 2 * p + 1 + off, dp, vl);
+    }
+
+    const vuint32m4_t ue = vreinterpret_v_f32m4_u32m4(xe);
+    const vuint32m4_t uo = vreinterpret_v_f32m4_u32m4(xo);
+    vuint64m8_t pairs = vwaddu_vv_u64m8(ue, uo, vl);
+    pairs = vwmaccu_vx_u64m8(pairs, 0xFFFFFFFF, uo, vl);
+    vse64_v_u64m8((uint64_t *)(x + 2 * q), pairs, vl);
+  }
+}
+
+// Same as dwt_fwd_vector on the columns of the [m x cols] image x, with
+// whole rows as vectors: s and d are [m/2 x cols]. All the images have cols
+// elements per row.
+static void dwt_fwd_cols_vector(const gsl_wavelet *w, const float *x, size_t m,
+                                size_t cols, float *s, float *d) {
+  const ptrdiff_t off = w->offset;
+  const size_t nmod = w->nc * m - off;
+
+  for (size_t j = 0; j < (m >> 1); ++j) {
+    size_t vl;
+    for (size_t c = 0; c < cols; c += vl) {
+      vl = vsetvl_e32m4(cols - c);
+      vfloat32m4_t sv, dv;
+      for (size_t k = 0; k < w->nc; ++k) {
+        const float *row = x + DWT_WRAP(2 * j + nmod + k, m) * cols + c;
+        vfloat32m4_t v = vle32_v_f32m4(row, vl);
+        sv = k ? vfmacc_vf_f32m4(sv, w->h1[k], v, vl)
+               : vfmul_vf_f32m4(v, w->h1[k], vl);
+        dv = k ? vfmacc_vf_f32m4(dv, w->g1[k], v, vl)
+               : vfmul_vf_f32m4(v, w->g1[k], vl);
+      }
+      vse32_v_f32m4(s + j * cols + c, sv, vl);
+      vse32_v_f32m4(d + j * cols + c, dv, vl);
+    }
+  }
+}
+
+// Same as dwt_inv_vector on the columns, with whole rows as vectors
+static void dwt_inv_cols_vector(const gsl_wavelet *w, const float *s,
+                                const float *d, size_t m, size_t cols,
+                                float *x) {
+  const ptrdiff_t off = w->offset;
+  const ptrdiff_t nc = w->nc;
+  const ptrdiff_t pmin = -((off + 1) / 2);
+  const ptrdiff_t pmax = (nc - 1 - off) >> 1;
+  const size_t nh = m >> 1;
+
+  for (size_t q = 0; q < nh; ++q) {
+    size_t vl;
+    for (size_t c = 0; c < cols; c += vl) {
+      vl = vsetvl_e32m4(cols - c);
+      vfloat32m4_t xe, xo;
+      int first_e = 1, first_o = 1;
+      for (ptrdiff_t p = pmin; p <= pmax; ++p) {
+        const size_t row = DWT_WRAP(q - p, nh) * cols + c;
+        vfloat32m4_t sp = vle32_v_f32m4(s + row, vl);
+        vfloat32m4_t dp = vle32_v_f32m4(d + row, vl);
+        DWT_TAP(xe, first_e, w->h2, 2 * p + off, sp, vl);
+        DWT_TAP(xe, first_e, w->g2, 2 * p + off, dp, vl);
+        DWT_TAP(xo, first_o, w->h2, 2 * p + 1 + off, sp, vl);
+        DWT_TAP(xo, first_o, w->g2, 2 * p + 1 + off, dp, vl);
+      }
+      vse32_v_f32m4(x + 2 * q * cols + c, xe, vl);
+      vse32_v_f32m4(x + (2 * q + 1) * cols + c, xo, vl);
+    }
+  }
+}
+
+// Multi-level transform along one axis: rows (cols == 0) or columns of an
+// image with cols elements per row. The approximation of the level i goes to
+// out if it is the last level, otherwise to the first (i odd) or the second
+// half of work.
+static void dwt_axis_vector(const gsl_wavelet *w, const float *in, float *out,
+                            size_t n, size_t cols, size_t levels,
+                            gsl_wavelet_direction dir, float *work,
+                            float *work2) {
+  const size_t l = dwt_levels(n, levels);
+  const size_t r = cols ? cols : 1;
+
+  // Nothing to transform
+  if (l == 0) {
+    size_t vl;
+    for (size_t i = 0; i < n * r; i += vl) {
+      vl = vsetvl_e32m8(n * r - i);
+      vse32_v_f32m8(out + i, vle32_v_f32m8(in + i, vl), vl);
+    }
+    return;
+  }
+
+  if (dir == gsl_wavelet_forward) {
+    const float *src = in;
+    for (size_t i = 1; i <= l; ++i) {
+      const size_t m = n >> (i - 1);
+      float *s = (i == l) ? out : (i & 1) ? work : work2;
+      if (cols)
+        dwt_fwd_cols_vector(w, src, m, cols, s, out + (m >> 1) * r);
+      else
+        dwt_fwd_vector(w, src, m, s, out + (m >> 1));
+      src = s;
+    }
+  } else {
+    const float *s = in;
+    for (size_t i = l; i > 0; --i) {
+      const size_t m = n >> (i - 1);
+      float *x = (i == 1) ? out : (i & 1) ? work2 : work;
+      if (cols)
+        dwt_inv_cols_vector(w, s, in + (m >> 1) * r, m, cols, x);
+      else
+        dwt_inv_vector(w, s, in + (m >> 1), m, x);
+      s = x;
+    }
+  }
+}
+
+void gsl_wavelet_dwt_vector(const gsl_wavelet *w, const float *in, float *out,
+                            size_t n, size_t levels, gsl_wavelet_direction dir,
+                            float *work) {
+  dwt_axis_vector(w, in, out, n, 0, levels, dir, work, work + n / 2);
+}
+
+// The two axes commute. Forward: rows from in to a temporary image, then
+// columns to out. Backward: columns from in to the temporary image, then
+// rows to out. The column levels ping-pong between the rest of work and the
+// temporary image, which is no longer needed after the first level.
+void gsl_wavelet2d_dwt_vector(const gsl_wavelet *w, const float *in,
+                              float *out, size_t size1, size_t size2,
+                              size_t levels, gsl_wavelet_direction dir,
+                              float *work) {
+  float *tmp = work;
+  float *rest = work + size1 * size2;
+
+  if (dir == gsl_wavelet_forward) {
+    for (size_t i = 0; i < size1; ++i)
+      dwt_axis_vector(w, in + i * size2, tmp + i * size2, size2, 0, levels,
+                      dir, rest, rest + size2 / 2);
+    dwt_axis_vector(w, tmp, out, size1, size2, levels, dir, rest, tmp);
+  } else {
+    dwt_axis_vector(w, in, tmp, size1, size2, levels, dir, rest, tmp);
+    for (size_t i = 0; i < size1; ++i)
+      dwt_axis_vector(w, tmp + i * size2, out + i * size2, size2, 0, levels,
+                      dir, rest, rest + size2 / 2);
+  }
+}
@@ -40,9 +40,12 @@ typedef struct {
 } gsl_wavelet_type;
 
 typedef struct {
-  // Pointers to the filters
+  // Pointers to the filters (analysis)
   const float *h1;
   const float *g1;
+  // Pointers to the filters (synthesis)
+  const float *h2;
+  const float *g2;
   // Number of filter components
   size_t nc;
   // Offset for center support
@@ -54,6 +57,51 @@ typedef struct {
   int n;
 } gsl_wavelet_workspace;
 
+// Daubechies wavelets with 2 (Haar) to 20 filter components, even. The
+// centered versions shift the filters by nc/2, to center their support.
+extern const gsl_wavelet_type *gsl_wavelet_daubechies;
+extern const gsl_wavelet_type *gsl_wavelet_daubechies_centered;
+
+// Set up w as the member k of the wavelet family T. Return 0 on success, -1 if
+// k is not a member of the family.
+int gsl_wavelet_init(gsl_wavelet *w, const gsl_wavelet_type *T, size_t k);
+
+// Multi-level DWT of n = 2^j samples, with periodic boundaries. The result
+// has the same layout as GSL's: the final approximation first, then the
+// details, from the coarsest to the finest level. levels is the number of
+// levels to compute (0 or more than log2(n): all of them). The backward
+// transform inverts the forward one with the same number of levels.
+//
+// Scalar version, in place, as in GSL. work holds n elements.
+void gsl_wavelet_dwt(const gsl_wavelet *w, float *data, size_t n,
+                     size_t levels, gsl_wavelet_direction dir, float *work);
+// Vector version, from in to out (in != out). The details are written to
+// their final position in out, and the approximations ping-pong between out
+// and the two halves of work, so no level is copied back. work holds
+// GSL_WAVELET_WORK_SIZE(n) elements.
+void gsl_wavelet_dwt_vector(const gsl_wavelet *w, const float *in, float *out,
+                            size_t n, size_t levels, gsl_wavelet_direction dir,
+                            float *work);
+#define GSL_WAVELET_WORK_SIZE(n) (3 * (n) / 4)
+
+// Separable 2D DWT of a [size1 x size2] row-major image (sizes powers of
+// two): the 1D transform of every row, then of every column ("standard"
+// form). Every axis is transformed with min(levels, log2(size)) levels.
+//
+// Scalar version, in place. The vector version goes from in to out
+// (in != out); it transforms the columns with whole rows as vectors, so that
+// all of its memory accesses are unit-stride. Both take work with
+// GSL_WAVELET2D_WORK_SIZE(size1, size2) elements.
+void gsl_wavelet2d_dwt(const gsl_wavelet *w, float *data, size_t size1,
+                       size_t size2, size_t levels, gsl_wavelet_direction dir,
+                       float *work);
+void gsl_wavelet2d_dwt_vector(const gsl_wavelet *w, const float *in,
+                              float *out, size_t size1, size_t size2,
+                              size_t levels, gsl_wavelet_direction dir,
+                              float *work);
+#define GSL_WAVELET2D_WORK_SIZE(size1, size2)                                  \
+  ((3 * (size1) / 2 + 1) * (size2))
+
 void gsl_wavelet_transform(float *data, size_t n, float *buf,
                            int first_iter_only);
 void gsl_wavelet_transform_vector(float *data, size_t n, float *buf,
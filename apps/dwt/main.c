@@ -46,6 +46,71 @@ extern float data_s[] __attribute__((aligned(4 * NR_LANES)));
 extern float data_v[] __attribute__((aligned(4 * NR_LANES)));
 extern float buf[] __attribute__((aligned(4 * NR_LANES)));
 
+// Daubechies tests
+extern uint64_t SIZE1;
+extern uint64_t SIZE2;
+extern float data_in[] __attribute__((aligned(4 * NR_LANES)));
+extern float data_g[] __attribute__((aligned(4 * NR_LANES)));
+extern float data_o[] __attribute__((aligned(4 * NR_LANES)));
+extern float data_r[] __attribute__((aligned(4 * NR_LANES)));
+extern float work[] __attribute__((aligned(4 * NR_LANES)));
+
+int check(const char *name, const float *o, const float *g) {
+  for (uint32_t i = 0; i < DWT_LEN; ++i) {
+    if (!similarity_check(o[i], g[i], THRESHOLD)) {
+      printf("Error (%s) at index %d. %f != %f\n", name, i, o[i], g[i]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Forward vector transform against the scalar one, and backward vector
+// transform against the input, in 1D and 2D
+int test_daubechies(const gsl_wavelet_type *T, size_t member, size_t levels) {
+  gsl_wavelet w;
+  int64_t runtime;
+  int err = 0;
+
+  if (gsl_wavelet_init(&w, T, member)) {
+    printf("Error: %s-%d is not a valid wavelet\n", T->name, member);
+    return 1;
+  }
+
+  // 1D
+  memcpy(data_g, data_in, DWT_LEN * sizeof(float));
+  gsl_wavelet_dwt(&w, data_g, DWT_LEN, levels, gsl_wavelet_forward, work);
+  start_timer();
+  gsl_wavelet_dwt_vector(&w, data_in, data_o, DWT_LEN, levels,
+                         gsl_wavelet_forward, work);
+  stop_timer();
+  runtime = get_timer();
+  gsl_wavelet_dwt_vector(&w, data_o, data_r, DWT_LEN, levels,
+                         gsl_wavelet_backward, work);
+  printf("%s-%d, %d levels: 1D forward %d cycles\n", T->name, member, levels,
+         runtime);
+  err |= check("1D forward", data_o, data_g);
+  err |= check("1D backward", data_r, data_in);
+
+  // 2D
+  memcpy(data_g, data_in, DWT_LEN * sizeof(float));
+  gsl_wavelet2d_dwt(&w, data_g, SIZE1, SIZE2, levels, gsl_wavelet_forward,
+                    work);
+  start_timer();
+  gsl_wavelet2d_dwt_vector(&w, data_in, data_o, SIZE1, SIZE2, levels,
+                           gsl_wavelet_forward, work);
+  stop_timer();
+  runtime = get_timer();
+  gsl_wavelet2d_dwt_vector(&w, data_o, data_r, SIZE1, SIZE2, levels,
+                           gsl_wavelet_backward, work);
+  printf("%s-%d, %d levels: 2D forward %d cycles\n", T->name, member, levels,
+         runtime);
+  err |= check("2D forward", data_o, data_g);
+  err |= check("2D backward", data_r, data_in);
+
+  return err;
+}
+
 int main() {
   printf("\n");
   printf("=========\n");
@@ -139,6 +204,17 @@ int main() {
       printf("Error at index %d. %f != %f\n", i, data_v[i], data_s[i]);
     }
   }
+
+  // Daubechies wavelets, on a [SIZE1 x SIZE2] image in 2D. The levels are
+  // one, or all of them (0).
+  printf("Daubechies DWT...\n");
+  for (size_t levels = 0; levels < 2; ++levels) {
+    error |= test_daubechies(gsl_wavelet_daubechies, 2, levels);
+    error |= test_daubechies(gsl_wavelet_daubechies, 4, levels);
+    error |= test_daubechies(gsl_wavelet_daubechies, 20, levels);
+    error |= test_daubechies(gsl_wavelet_daubechies_centered, 6, levels);
+    error |= test_daubechies(gsl_wavelet_daubechies_centered, 20, levels);
+  }
   if (!error)
     printf("Test result: PASS. No errors.\n");
 #endif
@@ -50,9 +50,22 @@ data = np.random.rand(NDWT).astype(dtype);
 # Buffer
 buf = np.zeros(int(NDWT/2), dtype=dtype)
 
+# Buffers of the Daubechies tests. The 2D tests see the samples as an image
+# of [size1 x size2], size1 <= size2.
+size1 = 1 << (int(np.log2(NDWT)) // 2)
+size2 = NDWT // size1
+work_len = (3 * size1 // 2 + 1) * size2
+
 # Create the file
 print(".section .data,\"aw\",@progbits")
 emit("DWT_LEN", np.array(NDWT, dtype=np.uint64))
 emit("data_s", data, 'NR_LANES*4')
 emit("data_v", data, 'NR_LANES*4')
 emit("buf", buf, 'NR_LANES*4')
+emit("SIZE1", np.array(size1, dtype=np.uint64))
+emit("SIZE2", np.array(size2, dtype=np.uint64))
+emit("data_in", data, 'NR_LANES*4')
+emit("data_g", np.zeros(NDWT, dtype=dtype), 'NR_LANES*4')
+emit("data_o", np.zeros(NDWT, dtype=dtype), 'NR_LANES*4')
+emit("data_r", np.zeros(NDWT, dtype=dtype), 'NR_LANES*4')
+emit("work", np.zeros(work_len, dtype=dtype), 'NR_LANES*4')
@@ -34,10 +34,26 @@ void fconv2d_7x7(double *o, double *i, double *f, int64_t R, int64_t C,
 void fconv2d_7x7_block(double *o, double *i, double *f, int64_t R, int64_t C,
                        int64_t n_, int64_t F);
 
+// Winograd F(mxm, 3x3), with m = 2 or m = 4. R and C must be multiples of m
+void fconv2d_3x3_winograd(double *o, double *i, double *f, int64_t R,
+                          int64_t C, int64_t F, int64_t m);
+void fconv2d_3x3_winograd_f32(float *o, float *i, float *f, int64_t R,
+                              int64_t C, int64_t F, int64_t m);
+
+// fp16 image and filter, fp32 output
+void fconv2d_f16(float *o, const _Float16 *i, const _Float16 *f, int64_t R,
+                 int64_t C, int64_t F);
+
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 
 // Threshold for FP numbers comparison during the final check
 #define THRESHOLD 0.000000000001
 // #define THRESHOLD 0
+// Threshold for the float32 Winograd results, checked against the float64
+// golden_o
+#define WINOGRAD_THRESHOLD_F32 0.0001
+// Threshold for the fp16-input results, checked against a float64 golden
+// model computed on the same fp16 inputs
+#define THRESHOLD_F16 0.001
 
 #endif
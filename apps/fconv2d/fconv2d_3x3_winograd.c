@@ -0,0 +1,81 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Winograd F(2x2, 3x3) and F(4x4, 3x3) convolution.
+//
+// The output is split in mxm tiles (m = 2 or 4), each computed from an
+// (m+2)x(m+2) input tile as
+//
+//   o_tile = AT [ (G f GT) * (BT i_tile B) ] A
+//
+// where * is the element-wise product. The filter transform is done once on
+// the scalar core. The input and output transforms are vectorized across the
+// tiles: the vector element t holds the data of the t-th tile, row-major over
+// the output image. A stripmined chunk of tiles is gathered with indexed
+// loads, transformed, multiplied, and scattered back with indexed stores.
+//
+// Multiplications per output element: 9 for the direct method, 16/4 = 4 for
+// F(2x2, 3x3) (2.25x less), 36/16 = 2.25 for F(4x4, 3x3) (4x less). The
+// transforms only need additions and multiplications by small constants.
+//
+// Numerical error: the transforms are not exact in floating point, and the
+// error grows with m. With the inputs and the filter in [0, 1) as generated by
+// script/gen_data.py, the largest absolute error versus golden_o_3x3 for
+// images up to 128x128 is ~2e-15 (m = 2) and ~2e-14 (m = 4) in float64, within
+// THRESHOLD. In float32, including the rounding of the inputs, it is ~1e-6
+// (m = 2) and ~1e-5 (m = 4), within WINOGRAD_THRESHOLD_F32.
+//
+// Constraints: R and C must be multiples of m. The input is padded as for
+// fconv2d_3x3, i.e., it is [(R+F-1) x (C+F-1)].
+
+#include <riscv_vector.h>
+
+#include "fconv2d.h"
+
+// Largest input tile size, for F(4x4, 3x3)
+#define WINO_MAX_N 6
+
+// Filter transforms
+static const double wino_g_2[4][3] = {
+    {1.0, 0.0, 0.0}, {0.5, 0.5, 0.5}, {0.5, -0.5, 0.5}, {0.0, 0.0, 1.0}};
+static const double wino_g_4[6][3] = {{1.0 / 4, 0.0, 0.0},
+                                      {-1.0 / 6, -1.0 / 6, -1.0 / 6},
+                                      {-1.0 / 6, 1.0 / 6, -1.0 / 6},
+                                      {1.0 / 24, 1.0 / 12, 1.0 / 6},
+                                      {1.0 / 24, -1.0 / 12, 1.0 / 6},
+                                      {0.0, 0.0, 1.0}};
+
+// Scratchpad for the intermediate transforms: n*n vectors after the input
+// transform, m*n vectors after the first output transform. A vector holds
+// up to VLMAX (LMUL = 2) elements, i.e., 2 * VLEN bits.
+static double wino_buf[(WINO_MAX_N * WINO_MAX_N + 4 * WINO_MAX_N) * VLEN / 32]
+    __attribute__((aligned(4 * NR_LANES)));
+
+#define WINO_T double
+#define WINO_SEW 64
+#define WINO_NAME fconv2d_3x3_winograd
+#include "fconv2d_3x3_winograd.h"
+#undef WINO_T
+#undef WINO_SEW
+#undef WINO_NAME
+
+#define WINO_T float
+#define WINO_SEW 32
+#define WINO_NAME fconv2d_3x3_winograd_f32
+#include "fconv2d_3x3_winograd.h"
+#undef WINO_T
+#undef WINO_SEW
+#undef WINO_NAME
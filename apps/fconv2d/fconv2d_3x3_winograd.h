@@ -0,0 +1,220 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Winograd F(mxm, 3x3) convolution, type-generic body.
+// This file is included by fconv2d_3x3_winograd.c once per data type, with
+// WINO_T (element type), WINO_SEW (element width) and WINO_NAME (function
+// name) defined.
+
+#define _WINO_CAT3(a, b, c) a##b##c
+#define WINO_CAT3(a, b, c) _WINO_CAT3(a, b, c)
+#define _WINO_CAT5(a, b, c, d, e) a##b##c##d##e
+#define WINO_CAT5(a, b, c, d, e) _WINO_CAT5(a, b, c, d, e)
+
+#define VFLOAT WINO_CAT3(vfloat, WINO_SEW, m2_t)
+#define VUINT WINO_CAT3(vuint, WINO_SEW, m2_t)
+#define VSETVL WINO_CAT3(vsetvl_e, WINO_SEW, m2)
+#define VLE WINO_CAT5(vle, WINO_SEW, _v_f, WINO_SEW, m2)
+#define VSE WINO_CAT5(vse, WINO_SEW, _v_f, WINO_SEW, m2)
+#define VLUXEI WINO_CAT5(vluxei, WINO_SEW, _v_f, WINO_SEW, m2)
+#define VSUXEI WINO_CAT5(vsuxei, WINO_SEW, _v_f, WINO_SEW, m2)
+#define VFADD WINO_CAT3(vfadd_vv_f, WINO_SEW, m2)
+#define VFSUB WINO_CAT3(vfsub_vv_f, WINO_SEW, m2)
+#define VFMUL WINO_CAT3(vfmul_vf_f, WINO_SEW, m2)
+#define VFMACC WINO_CAT3(vfmacc_vf_f, WINO_SEW, m2)
+#define VID WINO_CAT3(vid_v_u, WINO_SEW, m2)
+#define VADD WINO_CAT3(vadd_vx_u, WINO_SEW, m2)
+#define VDIVU WINO_CAT3(vdivu_vx_u, WINO_SEW, m2)
+#define VMUL WINO_CAT3(vmul_vx_u, WINO_SEW, m2)
+#define VMACC WINO_CAT3(vmacc_vx_u, WINO_SEW, m2)
+#define VNMSAC WINO_CAT3(vnmsac_vx_u, WINO_SEW, m2)
+
+// Transforms on named vectors. BT is used for the input (once along the
+// columns, once along the rows), AT for the output.
+
+// F(2x2, 3x3)
+#define WINO_BT4(y0, y1, y2, y3, x0, x1, x2, x3)                               \
+  y0 = VFSUB(x0, x2, vl);                                                      \
+  y1 = VFADD(x1, x2, vl);                                                      \
+  y2 = VFSUB(x2, x1, vl);                                                      \
+  y3 = VFSUB(x1, x3, vl);
+
+#define WINO_AT4(y0, y1, x0, x1, x2, x3)                                       \
+  y0 = VFADD(VFADD(x0, x1, vl), x2, vl);                                       \
+  y1 = VFSUB(VFSUB(x1, x2, vl), x3, vl);
+
+// F(4x4, 3x3)
+#define WINO_BT6(y0, y1, y2, y3, y4, y5, x0, x1, x2, x3, x4, x5)               \
+  y0 = VFMACC(VFMACC(x4, 4, x0, vl), -5, x2, vl);                              \
+  y1 = VFMACC(VFADD(x3, x4, vl), -4, VFADD(x1, x2, vl), vl);                   \
+  y2 = VFMACC(VFSUB(x4, x3, vl), 4, VFSUB(x1, x2, vl), vl);                    \
+  y3 = VFMACC(VFSUB(x4, x2, vl), -2, VFSUB(x1, x3, vl), vl);                   \
+  y4 = VFMACC(VFSUB(x4, x2, vl), 2, VFSUB(x1, x3, vl), vl);                    \
+  y5 = VFMACC(VFMACC(x5, 4, x1, vl), -5, x3, vl);
+
+#define WINO_AT6(y0, y1, y2, y3, x0, x1, x2, x3, x4, x5)                       \
+  s12 = VFADD(x1, x2, vl);                                                     \
+  d12 = VFSUB(x1, x2, vl);                                                     \
+  s34 = VFADD(x3, x4, vl);                                                     \
+  d34 = VFSUB(x3, x4, vl);                                                     \
+  y0 = VFADD(VFADD(x0, s12, vl), s34, vl);                                     \
+  y1 = VFMACC(d12, 2, d34, vl);                                                \
+  y2 = VFMACC(s12, 4, s34, vl);                                                \
+  y3 = VFMACC(VFADD(d12, x5, vl), 8, d34, vl);
+
+void WINO_NAME(WINO_T *o, WINO_T *i, WINO_T *f, int64_t R, int64_t C,
+               int64_t F, int64_t m) {
+  const int64_t n = m + 2;
+  const int64_t ldi = C + F - 1;
+  const int64_t tiles_per_row = C / m;
+  const int64_t tiles = (R / m) * tiles_per_row;
+  const double(*G)[3] = (m == 4) ? wino_g_4 : wino_g_2;
+
+  // Transformed filter U = G f G^T, computed once on the scalar core
+  WINO_T u[WINO_MAX_N][WINO_MAX_N];
+  for (int64_t r = 0; r < n; ++r)
+    for (int64_t c = 0; c < n; ++c) {
+      double acc = 0;
+      for (int64_t k = 0; k < 3; ++k)
+        for (int64_t l = 0; l < 3; ++l)
+          acc += G[r][k] * f[k * F + l] * G[c][l];
+      u[r][c] = acc;
+    }
+
+  // Intermediate transforms, n*n (and m*n) vectors of vl tiles
+  WINO_T *e_buf = (WINO_T *)wino_buf;
+  WINO_T *z_buf = e_buf + WINO_MAX_N * WINO_MAX_N * VSETVL(tiles);
+
+  VFLOAT x0, x1, x2, x3, x4, x5;
+  VFLOAT y0, y1, y2, y3, y4, y5;
+  VFLOAT s12, d12, s34, d34;
+  VUINT t_idx, i_off, o_off;
+
+  // Stripmine on the tiles. Each element of a vector belongs to one tile
+  size_t vl;
+  for (int64_t t = 0; t < tiles; t += vl) {
+    vl = VSETVL(tiles - t);
+
+    // Byte offset of the top-left corner of each tile, in i and in o
+    t_idx = VADD(VID(vl), t, vl);
+    VUINT t_row = VDIVU(t_idx, tiles_per_row, vl);
+    VUINT t_col = VNMSAC(t_idx, tiles_per_row, t_row, vl);
+    i_off = VMUL(t_col, m * sizeof(WINO_T), vl);
+    i_off = VMACC(i_off, m * ldi * sizeof(WINO_T), t_row, vl);
+    o_off = VMUL(t_col, m * sizeof(WINO_T), vl);
+    o_off = VMACC(o_off, m * C * sizeof(WINO_T), t_row, vl);
+
+    // 1) Gather the input tiles, row by row, and transform along the columns
+    for (int64_t k = 0; k < n; ++k) {
+      WINO_T *i_ = i + k * ldi;
+      WINO_T *e_ = e_buf + k * n * vl;
+      x0 = VLUXEI(i_ + 0, i_off, vl);
+      x1 = VLUXEI(i_ + 1, i_off, vl);
+      x2 = VLUXEI(i_ + 2, i_off, vl);
+      x3 = VLUXEI(i_ + 3, i_off, vl);
+      if (m == 4) {
+        x4 = VLUXEI(i_ + 4, i_off, vl);
+        x5 = VLUXEI(i_ + 5, i_off, vl);
+        WINO_BT6(y0, y1, y2, y3, y4, y5, x0, x1, x2, x3, x4, x5)
+        VSE(e_ + 4 * vl, y4, vl);
+        VSE(e_ + 5 * vl, y5, vl);
+      } else {
+        WINO_BT4(y0, y1, y2, y3, x0, x1, x2, x3)
+      }
+      VSE(e_ + 0 * vl, y0, vl);
+      VSE(e_ + 1 * vl, y1, vl);
+      VSE(e_ + 2 * vl, y2, vl);
+      VSE(e_ + 3 * vl, y3, vl);
+    }
+
+    // 2) Transform along the rows, multiply by U, and apply the output
+    // transform along the rows
+    for (int64_t c = 0; c < n; ++c) {
+      WINO_T *e_ = e_buf + c * vl;
+      WINO_T *z_ = z_buf + c * vl;
+      x0 = VLE(e_ + 0 * n * vl, vl);
+      x1 = VLE(e_ + 1 * n * vl, vl);
+      x2 = VLE(e_ + 2 * n * vl, vl);
+      x3 = VLE(e_ + 3 * n * vl, vl);
+      if (m == 4) {
+        x4 = VLE(e_ + 4 * n * vl, vl);
+        x5 = VLE(e_ + 5 * n * vl, vl);
+        WINO_BT6(y0, y1, y2, y3, y4, y5, x0, x1, x2, x3, x4, x5)
+        y0 = VFMUL(y0, u[0][c], vl);
+        y1 = VFMUL(y1, u[1][c], vl);
+        y2 = VFMUL(y2, u[2][c], vl);
+        y3 = VFMUL(y3, u[3][c], vl);
+        y4 = VFMUL(y4, u[4][c], vl);
+        y5 = VFMUL(y5, u[5][c], vl);
+        WINO_AT6(x0, x1, x2, x3, y0, y1, y2, y3, y4, y5)
+        VSE(z_ + 2 * n * vl, x2, vl);
+        VSE(z_ + 3 * n * vl, x3, vl);
+      } else {
+        WINO_BT4(y0, y1, y2, y3, x0, x1, x2, x3)
+        y0 = VFMUL(y0, u[0][c], vl);
+        y1 = VFMUL(y1, u[1][c], vl);
+        y2 = VFMUL(y2, u[2][c], vl);
+        y3 = VFMUL(y3, u[3][c], vl);
+        WINO_AT4(x0, x1, y0, y1, y2, y3)
+      }
+      VSE(z_ + 0 * n * vl, x0, vl);
+      VSE(z_ + 1 * n * vl, x1, vl);
+    }
+
+    // 3) Output transform along the columns, and scatter the output tiles
+    for (int64_t r = 0; r < m; ++r) {
+      WINO_T *z_ = z_buf + r * n * vl;
+      WINO_T *o_ = o + r * C;
+      x0 = VLE(z_ + 0 * vl, vl);
+      x1 = VLE(z_ + 1 * vl, vl);
+      x2 = VLE(z_ + 2 * vl, vl);
+      x3 = VLE(z_ + 3 * vl, vl);
+      if (m == 4) {
+        x4 = VLE(z_ + 4 * vl, vl);
+        x5 = VLE(z_ + 5 * vl, vl);
+        WINO_AT6(y0, y1, y2, y3, x0, x1, x2, x3, x4, x5)
+        VSUXEI(o_ + 2, o_off, y2, vl);
+        VSUXEI(o_ + 3, o_off, y3, vl);
+      } else {
+        WINO_AT4(y0, y1, x0, x1, x2, x3)
+      }
+      VSUXEI(o_ + 0, o_off, y0, vl);
+      VSUXEI(o_ + 1, o_off, y1, vl);
+    }
+  }
+}
+
+#undef WINO_BT4
+#undef WINO_AT4
+#undef WINO_BT6
+#undef WINO_AT6
+#undef VFLOAT
+#undef VUINT
+#undef VSETVL
+#undef VLE
+#undef VSE
+#undef VLUXEI
+#undef VSUXEI
+#undef VFADD
+#undef VFSUB
+#undef VFMUL
+#undef VFMACC
+#undef VID
+#undef VADD
+#undef VDIVU
+#undef VMUL
+#undef VMACC
+#undef VNMSAC
@@ -21,6 +21,7 @@
 #include <string.h>
 
 #include "fconv2d.h"
+#include "parallel.h"
 #include "runtime.h"
 #include "util.h"
 
@@ -43,6 +44,25 @@ extern int64_t M;
 extern int64_t N;
 extern int64_t F;
 
+// fp16 image and filter, fp32 output, defined in data.S
+extern _Float16 i_f16[] __attribute__((aligned(4 * NR_LANES)));
+extern _Float16 f_f16[] __attribute__((aligned(4 * NR_LANES)));
+extern float o_f32[] __attribute__((aligned(4 * NR_LANES)));
+extern float golden_o_f32[] __attribute__((aligned(4 * NR_LANES)));
+
+// 3x3 image, filter, and golden output for the Winograd kernels, defined in
+// data.S
+extern double i_3x3[] __attribute__((aligned(4 * NR_LANES))); // [ (M+2)*(N+2) ]
+extern double f_3x3[] __attribute__((aligned(4 * NR_LANES))); // [ 3*3 ]
+extern double golden_o_3x3[] __attribute__((aligned(4 * NR_LANES))); // [ M*N ]
+
+// Single-precision copies for the float32 Winograd kernel
+#define MAX_DIM 128
+float i_wino[(MAX_DIM + 2) * (MAX_DIM + 2)]
+    __attribute__((aligned(4 * NR_LANES)));
+float f_wino[3 * 3] __attribute__((aligned(4 * NR_LANES)));
+float o_wino[MAX_DIM * MAX_DIM] __attribute__((aligned(4 * NR_LANES)));
+
 // Verify the matrices
 int verify_matrix(double *matrix, double *golden_matrix, int64_t R, int64_t C,
                   double threshold) {
@@ -57,6 +77,32 @@ int verify_matrix(double *matrix, double *golden_matrix, int64_t R, int64_t C,
   return 0;
 }
 
+int verify_matrix_f32(float *matrix, float *golden_matrix, int64_t R,
+                      int64_t C, double threshold) {
+  for (int r = 0; r < R; ++r)
+    for (int c = 0; c < C; ++c)
+      if (!similarity_check(matrix[c + C * r], golden_matrix[c + C * r],
+                            threshold)) {
+        printf("Error: o[%d][%d] = %lf, instead of %lf\n", r, c,
+               (double)matrix[c + C * r], (double)golden_matrix[c + C * r]);
+        return 1;
+      }
+  return 0;
+}
+
+int verify_matrix_wino(float *matrix, double *golden_matrix, int64_t R,
+                       int64_t C, double threshold) {
+  for (int r = 0; r < R; ++r)
+    for (int c = 0; c < C; ++c)
+      if (!similarity_check(matrix[c + C * r], golden_matrix[c + C * r],
+                            threshold)) {
+        printf("Error: o[%d][%d] = %lf, instead of %lf\n", r, c,
+               (double)matrix[c + C * r], golden_matrix[c + C * r]);
+        return 1;
+      }
+  return 0;
+}
+
 void print_matrix(double const *matrix, uint64_t num_rows,
                   uint64_t num_columns) {
   printf("0x%8X\n", (uint64_t)matrix);
@@ -68,7 +114,56 @@ void print_matrix(double const *matrix, uint64_t num_rows,
   }
 }
 
+// Multi-tile scaling: every tile computes a contiguous block of output rows.
+// It uses the 3x3 data, so it runs whatever F is.
+void fconv2d_rows(uint64_t r0, uint64_t r1, void *arg) {
+  fconv2d_3x3(o + r0 * N, i_3x3 + r0 * (N + 2), f_3x3, r1 - r0, N, 3);
+}
+
+// Run the 3x3 fconv2d on 1 to nr_tiles tiles. All the harts call it.
+int scaling() {
+  // The other tiles wait here until hart 0 is done with its own measurements
+  start_barrier();
+
+  uint64_t hartid = get_hartid();
+  int64_t runtime_1 = 0;
+  int error = 0;
+
+  if (hartid == 0)
+    printf("Scaling on %d tiles:\n", get_nr_tiles());
+
+  for (uint64_t t = 1; t <= get_nr_tiles(); ++t) {
+    if (hartid == 0) {
+      memset(o, 0, M * N * sizeof(double));
+      start_timer();
+    }
+    // The kernel works on blocks of 4 output rows
+    parallel_for(M, 4, t, fconv2d_rows, NULL);
+    if (hartid != 0)
+      continue;
+    stop_timer();
+
+    int64_t runtime = get_timer();
+    if (t == 1)
+      runtime_1 = runtime;
+    printf("%d tiles: %d cycles, speedup %f, %f DPFLOP/cycle.\n", t, runtime,
+           (float)runtime_1 / runtime, 2.0 * 3 * 3 * M * N / runtime);
+
+    // The other tiles wrote o behind the back of our D$
+    dcache_invalidate(o, M * N * sizeof(double));
+    if (verify_matrix(o, golden_o_3x3, M, N, THRESHOLD))
+      error = 1;
+  }
+
+  return error;
+}
+
 int main() {
+  // The other tiles only take part in the multi-tile part, and stay parked
+  // in scaling() until hart 0 gets there
+  if (get_hartid() != 0)
+    return scaling();
+
   printf("\n");
   printf("=============\n");
   printf("=  FCONV2D  =\n");
@@ -104,5 +199,82 @@ int main() {
     printf("Passed.\n");
   }
 
+  // fp16 inputs, fp32 accumulation
+  printf("fp16 -> fp32:\n");
+  start_timer();
+  fconv2d_f16(o_f32, i_f16, f_f16, M, N, F);
+  stop_timer();
+  runtime = get_timer();
+  performance = 2.0 * F * F * M * N / runtime;
+  // The widening MACs write two fp32 results per 64-bit lane per cycle
+  utilization = 100 * performance / (4.0 * NR_LANES);
+  printf("The execution took %d cycles.\n", runtime);
+  printf("The performance is %f FLOP/cycle (%f%% utilization).\n", performance,
+         utilization);
+  printf("Verifying result...\n");
+  if (verify_matrix_f32(o_f32, golden_o_f32, M, N, THRESHOLD_F16)) {
+    printf("Fail.\n");
+    error = 1;
+  } else {
+    printf("Passed.\n");
+  }
+
+  // Winograd F(2x2, 3x3) and F(4x4, 3x3), in float64 and float32, on their
+  // own 3x3 filter and image, whatever F is
+  if (M > MAX_DIM || N > MAX_DIM || M % 4 || N % 4) {
+    printf("Error: Winograd needs M, N <= %d, and multiples of 4 (the largest "
+           "tile).\n",
+           MAX_DIM);
+    error = 1;
+  } else {
+    for (int64_t k = 0; k < (M + 2) * (N + 2); ++k)
+      i_wino[k] = i_3x3[k];
+    for (int64_t k = 0; k < 3 * 3; ++k)
+      f_wino[k] = f_3x3[k];
+
+    for (int64_t m = 2; m <= 4; m += 2) {
+      printf("Winograd F(%dx%d, 3x3), float64:\n", m, m);
+      memset(o, 0, M * N * sizeof(double));
+      start_timer();
+      fconv2d_3x3_winograd(o, i_3x3, f_3x3, M, N, 3, m);
+      stop_timer();
+      runtime = get_timer();
+      // Same FLOP count as the direct method, to compare the runtimes
+      performance = 2.0 * 3 * 3 * M * N / runtime;
+      printf("The execution took %d cycles.\n", runtime);
+      printf("The equivalent performance is %f DPFLOP/cycle.\n", performance);
+      printf("Verifying result...\n");
+      if (verify_matrix(o, golden_o_3x3, M, N, THRESHOLD)) {
+        printf("Fail.\n");
+        error = 1;
+      } else {
+        printf("Passed.\n");
+      }
+
+      printf("Winograd F(%dx%d, 3x3), float32:\n", m, m);
+      start_timer();
+      fconv2d_3x3_winograd_f32(o_wino, i_wino, f_wino, M, N, 3, m);
+      stop_timer();
+      runtime = get_timer();
+      performance = 2.0 * 3 * 3 * M * N / runtime;
+      printf("The execution took %d cycles.\n", runtime);
+      printf("The equivalent performance is %f SPFLOP/cycle.\n", performance);
+      printf("Verifying result...\n");
+      if (verify_matrix_wino(o_wino, golden_o_3x3, M, N,
+                             WINOGRAD_THRESHOLD_F32)) {
+        printf("Fail.\n");
+        error = 1;
+      } else {
+        printf("Passed.\n");
+      }
+    }
+  }
+
+  // Also after a failure, to release the other tiles
+  if (get_nr_tiles() > 1 && scaling())
+    error = 1;
+
   return error;
 }
+
+PARALLEL_MAIN
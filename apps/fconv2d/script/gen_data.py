@@ -61,6 +61,8 @@ def emit(name, array, alignment='8'):
 	print(".balign " + alignment)
 	print("%s:" % name)
 	bs = array.tobytes()
+	# Pad to a whole number of words (e.g., for 8-bit and 16-bit arrays)
+	bs += bytes(-len(bs) % 4)
 	for i in range(0, len(bs), 4):
 		s = ""
 		for n in range(4):
@@ -102,6 +104,17 @@ empty_o = np.zeros((M, N)).astype(dtype)
 # Calculate the output matrix
 result = convolve2D(gen_filter, image, padding).astype(dtype)
 
+# fp16 variant: fp16 image and filter, fp32 output
+image_f16 = image.astype(np.float16)
+filter_f16 = gen_filter.astype(np.float16)
+empty_o_f32 = np.zeros((M, N)).astype(np.float32)
+result_f32 = convolve2D(filter_f16.astype(dtype), image_f16.astype(dtype), padding).astype(np.float32)
+
+# 3x3 image and filter for the Winograd kernels, independent of f
+image_3x3 = np.random.rand(M + 2, N + 2).astype(dtype);
+filter_3x3 = np.random.rand(3, 3).astype(dtype);
+result_3x3 = convolve2D(filter_3x3, image_3x3, 1).astype(dtype)
+
 # Print information on file
 print(".section .data,\"aw\",@progbits")
 emit("M", np.array(M, dtype=np.uint64))
@@ -111,3 +124,10 @@ emit("i", image, 'NR_LANES*4')
 emit("f", gen_filter, 'NR_LANES*4')
 emit("o", empty_o, 'NR_LANES*4')
 emit("golden_o", result, 'NR_LANES*4')
+emit("i_f16", image_f16, 'NR_LANES*4')
+emit("f_f16", filter_f16, 'NR_LANES*4')
+emit("o_f32", empty_o_f32, 'NR_LANES*4')
+emit("golden_o_f32", result_f32, 'NR_LANES*4')
+emit("i_3x3", image_3x3, 'NR_LANES*4')
+emit("f_3x3", filter_3x3, 'NR_LANES*4')
+emit("golden_o_3x3", result_3x3, 'NR_LANES*4')
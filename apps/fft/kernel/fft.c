@@ -19,6 +19,7 @@
 // Original scalar code by: Giuseppe Tagliavini
 
 #include <math.h>
+#include <stddef.h>
 #include <stdlib.h>
 
 #include "fft.h"
@@ -746,3 +747,167 @@ void fft_r2dif_vec(float *samples_re, float *samples_im,
   vsuxei32_v_f32m1(samples_re + vl, bindex, lower_wing_re, vl);
   vsuxei32_v_f32m1(samples_im + vl, bindex, lower_wing_im, vl);
 }
+
+////////////////////////////////
+// Inverse and real-input FFT //
+////////////////////////////////
+
+// Scale a real vector in place. Used to normalize the inverse transforms.
+static void fft_scale_vec(float *v, float scale, size_t len) {
+  size_t avl = len;
+  vfloat32m8_t vbuf;
+
+  for (size_t vl = vsetvl_e32m8(avl); avl > 0; avl -= vl) {
+    vl = vsetvl_e32m8(avl);
+    vbuf = vle32_v_f32m8(v, vl);
+    vbuf = vfmul_vf_f32m8(vbuf, scale, vl);
+    vse32_v_f32m8(v, vbuf, vl);
+    v += vl;
+  }
+}
+
+// Inverse complex FFT with the same twiddle plan as fft_r2dif_vec.
+// IFFT(x) = swap(FFT(swap(x))) / N, where swap() exchanges the real and the
+// imaginary parts. Since real and imaginary parts live in separate buffers,
+// the swap is just an exchange of the pointers and comes for free.
+void ifft_r2dif_vec(float *samples_re, float *samples_im,
+                    const float *twiddles_re, const float *twiddles_im,
+                    const uint8_t **mask_addr_vec, const uint32_t *index_ptr,
+                    size_t n_fft) {
+  fft_r2dif_vec(samples_im, samples_re, twiddles_re, twiddles_im,
+                mask_addr_vec, index_ptr, n_fft);
+  fft_scale_vec(samples_re, 1.0f / n_fft, n_fft);
+  fft_scale_vec(samples_im, 1.0f / n_fft, n_fft);
+}
+
+// Real-input FFT on n_real samples. The real sequence is packed into an
+// (n_real / 2)-point complex sequence z[n] = x[2n] + j x[2n+1], transformed
+// with the (n_real / 2)-point twiddle plan, and split into the first
+// n_real / 2 + 1 bins of the real spectrum:
+//   X[k] = E[k] + W^k O[k], with E[k] = (Z[k] + conj(Z[M-k])) / 2
+//                                O[k] = (Z[k] - conj(Z[M-k])) / 2j
+// rtwiddles_re/im contain W^k = exp(-2*pi*j*k/n_real), k in [0, n_real/2).
+// buf_re/buf_im are n_real / 2 elements long, out_re/out_im n_real / 2 + 1.
+void rfft_r2dif_vec(const float *x, float *buf_re, float *buf_im,
+                    float *out_re, float *out_im, const float *twiddles_re,
+                    const float *twiddles_im, const float *rtwiddles_re,
+                    const float *rtwiddles_im, const uint8_t **mask_addr_vec,
+                    const uint32_t *index_ptr, size_t n_real) {
+  size_t m = n_real >> 1;
+  size_t avl;
+  vfloat32m2_t a_re, a_im, b_re, b_im, w_re, w_im;
+  vfloat32m2_t e_re, e_im, o_re, o_im, x_re, x_im;
+
+  // Pack even and odd samples into the real and imaginary parts
+  avl = m;
+  for (size_t vl = vsetvl_e32m2(avl), i = 0; avl > 0; avl -= vl, i += vl) {
+    vl = vsetvl_e32m2(avl);
+    a_re = vlse32_v_f32m2(x + 2 * i, 2 * sizeof(float), vl);
+    a_im = vlse32_v_f32m2(x + 2 * i + 1, 2 * sizeof(float), vl);
+    vse32_v_f32m2(buf_re + i, a_re, vl);
+    vse32_v_f32m2(buf_im + i, a_im, vl);
+  }
+
+  // Half-length complex FFT
+  fft_r2dif_vec(buf_re, buf_im, twiddles_re, twiddles_im, mask_addr_vec,
+                index_ptr, m);
+
+  // DC and Nyquist bins are purely real
+  out_re[0] = buf_re[0] + buf_im[0];
+  out_im[0] = 0;
+  out_re[m] = buf_re[0] - buf_im[0];
+  out_im[m] = 0;
+
+  // Split the remaining bins. Z[M-k] is fetched backwards with a negative
+  // stride, so that no explicit reversal is needed.
+  avl = m - 1;
+  for (size_t vl = vsetvl_e32m2(avl), k = 1; avl > 0; avl -= vl, k += vl) {
+    vl = vsetvl_e32m2(avl);
+
+    a_re = vle32_v_f32m2(buf_re + k, vl);
+    b_re = vlse32_v_f32m2(buf_re + m - k, -(ptrdiff_t)sizeof(float), vl);
+    a_im = vle32_v_f32m2(buf_im + k, vl);
+    b_im = vlse32_v_f32m2(buf_im + m - k, -(ptrdiff_t)sizeof(float), vl);
+    w_re = vle32_v_f32m2(rtwiddles_re + k, vl);
+    w_im = vle32_v_f32m2(rtwiddles_im + k, vl);
+
+    // 2E and 2O
+    e_re = vfadd_vv_f32m2(a_re, b_re, vl);
+    e_im = vfsub_vv_f32m2(a_im, b_im, vl);
+    o_re = vfadd_vv_f32m2(a_im, b_im, vl);
+    o_im = vfsub_vv_f32m2(b_re, a_re, vl);
+
+    // 2X = 2E + W * 2O
+    x_re = vfmacc_vv_f32m2(e_re, w_re, o_re, vl);
+    x_re = vfnmsac_vv_f32m2(x_re, w_im, o_im, vl);
+    x_im = vfmacc_vv_f32m2(e_im, w_re, o_im, vl);
+    x_im = vfmacc_vv_f32m2(x_im, w_im, o_re, vl);
+
+    x_re = vfmul_vf_f32m2(x_re, 0.5f, vl);
+    x_im = vfmul_vf_f32m2(x_im, 0.5f, vl);
+    vse32_v_f32m2(out_re + k, x_re, vl);
+    vse32_v_f32m2(out_im + k, x_im, vl);
+  }
+}
+
+// Inverse of rfft_r2dif_vec. Takes the n_real / 2 + 1 bins of a real spectrum
+// and reconstructs the n_real real samples into x. The complex sequence
+//   Z[k] = E[k] + j O[k], with E[k] = (X[k] + conj(X[M-k])) / 2
+//                              O[k] = (X[k] - conj(X[M-k])) / 2 * W^-k
+// is inverse-transformed with the same (n_real / 2)-point twiddle plan.
+void irfft_r2dif_vec(const float *in_re, const float *in_im, float *buf_re,
+                     float *buf_im, float *x, const float *twiddles_re,
+                     const float *twiddles_im, const float *rtwiddles_re,
+                     const float *rtwiddles_im, const uint8_t **mask_addr_vec,
+                     const uint32_t *index_ptr, size_t n_real) {
+  size_t m = n_real >> 1;
+  size_t avl;
+  vfloat32m2_t a_re, a_im, b_re, b_im, w_re, w_im;
+  vfloat32m2_t e_re, e_im, d_re, d_im, z_re, z_im;
+
+  // Merge the bins. X[M] is part of the input, so X[M-k] is valid for k == 0
+  avl = m;
+  for (size_t vl = vsetvl_e32m2(avl), k = 0; avl > 0; avl -= vl, k += vl) {
+    vl = vsetvl_e32m2(avl);
+
+    a_re = vle32_v_f32m2(in_re + k, vl);
+    b_re = vlse32_v_f32m2(in_re + m - k, -(ptrdiff_t)sizeof(float), vl);
+    a_im = vle32_v_f32m2(in_im + k, vl);
+    b_im = vlse32_v_f32m2(in_im + m - k, -(ptrdiff_t)sizeof(float), vl);
+    w_re = vle32_v_f32m2(rtwiddles_re + k, vl);
+    w_im = vle32_v_f32m2(rtwiddles_im + k, vl);
+
+    // 2E and 2D, with D = X[k] - conj(X[M-k])
+    e_re = vfadd_vv_f32m2(a_re, b_re, vl);
+    e_im = vfsub_vv_f32m2(a_im, b_im, vl);
+    d_re = vfsub_vv_f32m2(a_re, b_re, vl);
+    d_im = vfadd_vv_f32m2(a_im, b_im, vl);
+
+    // 2Z = 2E + j * conj(W) * 2D
+    z_re = vfnmsac_vv_f32m2(e_re, w_re, d_im, vl);
+    z_re = vfmacc_vv_f32m2(z_re, w_im, d_re, vl);
+    z_im = vfmacc_vv_f32m2(e_im, w_re, d_re, vl);
+    z_im = vfmacc_vv_f32m2(z_im, w_im, d_im, vl);
+
+    z_re = vfmul_vf_f32m2(z_re, 0.5f, vl);
+    z_im = vfmul_vf_f32m2(z_im, 0.5f, vl);
+    vse32_v_f32m2(buf_re + k, z_re, vl);
+    vse32_v_f32m2(buf_im + k, z_im, vl);
+  }
+
+  // Half-length inverse complex FFT (swap trick, normalization fused below)
+  fft_r2dif_vec(buf_im, buf_re, twiddles_re, twiddles_im, mask_addr_vec,
+                index_ptr, m);
+
+  // Normalize and interleave the real and imaginary parts back
+  avl = m;
+  for (size_t vl = vsetvl_e32m2(avl), i = 0; avl > 0; avl -= vl, i += vl) {
+    vl = vsetvl_e32m2(avl);
+    z_re = vle32_v_f32m2(buf_re + i, vl);
+    z_im = vle32_v_f32m2(buf_im + i, vl);
+    z_re = vfmul_vf_f32m2(z_re, 1.0f / m, vl);
+    z_im = vfmul_vf_f32m2(z_im, 1.0f / m, vl);
+    vsse32_v_f32m2(x + 2 * i, 2 * sizeof(float), z_re, vl);
+    vsse32_v_f32m2(x + 2 * i + 1, 2 * sizeof(float), z_im, vl);
+  }
+}
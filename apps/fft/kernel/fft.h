@@ -11,6 +11,20 @@ void fft_r2dif_vec(float *samples_re, float *samples_im,
                    const float *twiddles_re, const float *twiddles_im,
                    const uint8_t **mask_addr_vec, const uint32_t *index_ptr,
                    size_t n_fft);
+void ifft_r2dif_vec(float *samples_re, float *samples_im,
+                    const float *twiddles_re, const float *twiddles_im,
+                    const uint8_t **mask_addr_vec, const uint32_t *index_ptr,
+                    size_t n_fft);
+void rfft_r2dif_vec(const float *x, float *buf_re, float *buf_im,
+                    float *out_re, float *out_im, const float *twiddles_re,
+                    const float *twiddles_im, const float *rtwiddles_re,
+                    const float *rtwiddles_im, const uint8_t **mask_addr_vec,
+                    const uint32_t *index_ptr, size_t n_real);
+void irfft_r2dif_vec(const float *in_re, const float *in_im, float *buf_re,
+                     float *buf_im, float *x, const float *twiddles_re,
+                     const float *twiddles_im, const float *rtwiddles_re,
+                     const float *rtwiddles_im, const uint8_t **mask_addr_vec,
+                     const uint32_t *index_ptr, size_t n_real);
 static inline v2s cplxmuls(v2s x, v2s y);
 static inline v2f cplxmuls_float(v2f x, v2f y);
 static inline v2s cplxmulsdiv2(v2s x, v2s y);
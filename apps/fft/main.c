@@ -53,9 +53,27 @@ v2f samples_vec[MAX_NFFT]
 extern v2f gold_out[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
 signed short SwapTable[MAX_NFFT]
     __attribute__((aligned(32 * NR_LANES), section(".l2")));
+extern float samples_reim_s[]
+    __attribute__((aligned(32 * NR_LANES), section(".l2")));
+
+// Real FFT on 2 * NFFT samples, computed with the NFFT-point complex plan
+extern float rfft_samples[]
+    __attribute__((aligned(32 * NR_LANES), section(".l2")));
+extern float rfft_twiddle_reim[]
+    __attribute__((aligned(32 * NR_LANES), section(".l2")));
+extern float rfft_gold_reim[]
+    __attribute__((aligned(32 * NR_LANES), section(".l2")));
+float rfft_buf_reim[2 * MAX_NFFT]
+    __attribute__((aligned(32 * NR_LANES), section(".l2")));
+float rfft_out_reim[2 * (MAX_NFFT + 1)]
+    __attribute__((aligned(32 * NR_LANES), section(".l2")));
+float rfft_x[2 * MAX_NFFT]
+    __attribute__((aligned(32 * NR_LANES), section(".l2")));
 
 // Threshold for FP numbers comparison during the final check
 #define THRESHOLD 1
+// Threshold for the inverse and real FFT checks
+#define RFFT_THRESHOLD 0.01
 
 int main() {
   printf("\n");
@@ -241,6 +259,72 @@ int main() {
     }
   }
 
+  ////////////////////////////
+  // Vector inverse DIF FFT //
+  ////////////////////////////
+
+  start_timer();
+  ifft_r2dif_vec(samples_reim, samples_reim + NFFT, twiddle_vec_reim,
+                 twiddle_vec_reim + ((NFFT >> 1) * (31 - __builtin_clz(NFFT))),
+                 mask_addr_vec, index_ptr, NFFT);
+  stop_timer();
+  runtime = get_timer();
+  printf("The vector IFFT execution took %d cycles.\n", runtime);
+
+  // The inverse transform should give back the original samples
+  for (unsigned int i = 0; i < 2 * NFFT; ++i) {
+    if (!similarity_check(samples_reim[i], samples_reim_s[i],
+                          RFFT_THRESHOLD)) {
+      printf("IFFT error at index %d\n", i);
+      error = 1;
+    }
+  }
+
+  /////////////////////
+  // Vector real FFT //
+  /////////////////////
+
+  printf("Real FFT on %d points\n", 2 * NFFT);
+
+  float *rfft_out_re = rfft_out_reim;
+  float *rfft_out_im = rfft_out_reim + NFFT + 1;
+
+  start_timer();
+  rfft_r2dif_vec(rfft_samples, rfft_buf_reim, rfft_buf_reim + NFFT,
+                 rfft_out_re, rfft_out_im, twiddle_vec_reim,
+                 twiddle_vec_reim + ((NFFT >> 1) * (31 - __builtin_clz(NFFT))),
+                 rfft_twiddle_reim, rfft_twiddle_reim + NFFT, mask_addr_vec,
+                 index_ptr, 2 * NFFT);
+  stop_timer();
+  runtime = get_timer();
+  printf("The vector RFFT execution took %d cycles.\n", runtime);
+
+  for (unsigned int i = 0; i < 2 * (NFFT + 1); ++i) {
+    if (!similarity_check(rfft_out_reim[i], rfft_gold_reim[i],
+                          RFFT_THRESHOLD)) {
+      printf("RFFT error at index %d\n", i);
+      error = 1;
+    }
+  }
+
+  start_timer();
+  irfft_r2dif_vec(rfft_out_re, rfft_out_im, rfft_buf_reim,
+                  rfft_buf_reim + NFFT, rfft_x, twiddle_vec_reim,
+                  twiddle_vec_reim +
+                      ((NFFT >> 1) * (31 - __builtin_clz(NFFT))),
+                  rfft_twiddle_reim, rfft_twiddle_reim + NFFT, mask_addr_vec,
+                  index_ptr, 2 * NFFT);
+  stop_timer();
+  runtime = get_timer();
+  printf("The vector IRFFT execution took %d cycles.\n", runtime);
+
+  for (unsigned int i = 0; i < 2 * NFFT; ++i) {
+    if (!similarity_check(rfft_x[i], rfft_samples[i], RFFT_THRESHOLD)) {
+      printf("IRFFT error at index %d\n", i);
+      error = 1;
+    }
+  }
+
   if (!error)
     printf("\n");
   if (!error)
@@ -54,7 +54,7 @@ def setupTwiddlesLUT(Twiddles_vec, Nfft):
     for idx, twi in enumerate(it):
       Phi = Theta * idx;
       twi[...]['re'] = np.cos(Phi)
-      twi[...]['im'] = np.sin(Phi)
+      twi[...]['im'] = -np.sin(Phi)
 
 # For this first trial, let's suppose to have in memory all the
 # Twiddle factors, for each stage, already ordered, in contiguous
@@ -64,7 +64,7 @@ def setupTwiddlesLUT_dif_vec(Twiddles_vec, Nfft):
   stages = int(np.log2(Nfft))
   Theta = (2 * np.pi) / Nfft;
   # Twiddle factors ([[twi0_re, twi0_im], [twi1_re, twi1_im]])
-  twi = [[np.cos(i * Theta), np.sin(i * Theta)] for i in range(int(Nfft/2))]
+  twi = [[np.cos(i * Theta), -np.sin(i * Theta)] for i in range(int(Nfft/2))]
   # Write the Twiddle factors
   for s in range(stages):
     for t in range(int(Nfft/2)):
@@ -84,6 +84,14 @@ def setupInput(samples, Nfft, dyn):
       samp[...]['re'] = np.random.rand(1)
       samp[...]['im'] = np.random.rand(1)
 
+# Twiddles for the split step of a real FFT on 2*Nfft samples
+# that uses an Nfft-point complex FFT: W^k = exp(-2*pi*j*k/(2*Nfft))
+def setupTwiddlesLUT_rfft(Nfft):
+  Theta = np.pi / Nfft;
+  twi_re = np.array([ np.cos(i * Theta) for i in range(Nfft)])
+  twi_im = np.array([-np.sin(i * Theta) for i in range(Nfft)])
+  return twi_re, twi_im
+
 def emit(name, array, alignment='8'):
 	print(".global %s" % name)
 	print(".balign " + alignment)
@@ -140,6 +148,19 @@ setupInput(samples, NFFT, FFT2_SAMPLE_DYN)
 gold_out = np.fft.fft(samples['re'] + 1j * samples['im'])
 #print(gold_out)
 
+# Real input for the real FFT (2*NFFT samples, NFFT-point complex plan)
+rfft_samples = np.random.rand(2 * NFFT)
+rfft_twiddle_re, rfft_twiddle_im = setupTwiddlesLUT_rfft(NFFT)
+rfft_gold = np.fft.rfft(rfft_samples)
+
+rfft_twiddle_reim            = np.empty(2 * NFFT, dtype=dtype)
+rfft_twiddle_reim[   0:NFFT] = rfft_twiddle_re
+rfft_twiddle_reim[NFFT:    ] = rfft_twiddle_im
+
+rfft_gold_reim              = np.empty(2 * (NFFT + 1), dtype=dtype)
+rfft_gold_reim[   0:NFFT+1] = np.real(rfft_gold)
+rfft_gold_reim[NFFT+1:    ] = np.imag(rfft_gold)
+
 # Serialize the complex array
 samples_s    = serialize_cmplx(samples['re'] + 1j * samples['im'], NFFT, dtype)
 twiddle_s    = serialize_cmplx(twiddle['re'] + 1j * twiddle['im'], NFFT, dtype)
@@ -167,3 +188,6 @@ emit("twiddle", twiddle_s.astype(dtype), 'NR_LANES*4')
 emit("twiddle_vec", twiddle_v_s.astype(dtype), 'NR_LANES*4')
 emit("twiddle_vec_reim", twiddle_vec_reim.astype(dtype), 'NR_LANES*4')
 emit("gold_out", gold_out_s.astype(dtype), 'NR_LANES*4')
+emit("rfft_samples", rfft_samples.astype(dtype), 'NR_LANES*4')
+emit("rfft_twiddle_reim", rfft_twiddle_reim.astype(dtype), 'NR_LANES*4')
+emit("rfft_gold_reim", rfft_gold_reim.astype(dtype), 'NR_LANES*4')
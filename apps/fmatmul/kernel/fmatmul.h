@@ -44,6 +44,10 @@ void fmatmul_vec_16x16_slice_init();
 void fmatmul_vec_16x16(double *c, const double *a, const double *b,
                        unsigned long int n, unsigned long int p);
 
+// fp16 inputs, fp32 accumulation
+void fmatmul_f16(float *c, const _Float16 *a, const _Float16 *b,
+                 unsigned long int m, unsigned long int n, unsigned long int p);
+
 #define DELTA 0.000001
 
 extern int64_t event_trigger;
@@ -0,0 +1,71 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Reduced-precision matmul: fp16 inputs, fp32 accumulation.
+// The rows of B are loaded at e16 and multiplied with vfwmacc.vf, which
+// widens the products to e32 and accumulates them without rounding the
+// intermediate products to fp16.
+
+#include <riscv_vector.h>
+
+#include "fmatmul.h"
+
+// Number of rows of C computed at once
+#define F16_BLOCK 4
+
+void fmatmul_f16(float *c, const _Float16 *a, const _Float16 *b,
+                 const unsigned long int M, const unsigned long int N,
+                 const unsigned long int P) {
+  vfloat32m4_t acc0, acc1, acc2, acc3;
+  vfloat16m2_t b_row;
+
+  // Stripmine on the columns of C
+  size_t vl;
+  for (unsigned long int j = 0; j < P; j += vl) {
+    vl = vsetvl_e16m2(P - j);
+
+    unsigned long int i = 0;
+    // Blocks of F16_BLOCK rows: every row of B is reused F16_BLOCK times
+    for (; i + F16_BLOCK <= M; i += F16_BLOCK) {
+      const _Float16 *a_ = a + i * N;
+      acc0 = vfmv_v_f_f32m4(0, vl);
+      acc1 = vfmv_v_f_f32m4(0, vl);
+      acc2 = vfmv_v_f_f32m4(0, vl);
+      acc3 = vfmv_v_f_f32m4(0, vl);
+      for (unsigned long int k = 0; k < N; ++k) {
+        b_row = vle16_v_f16m2(b + k * P + j, vl);
+        acc0 = vfwmacc_vf_f32m4(acc0, a_[0 * N + k], b_row, vl);
+        acc1 = vfwmacc_vf_f32m4(acc1, a_[1 * N + k], b_row, vl);
+        acc2 = vfwmacc_vf_f32m4(acc2, a_[2 * N + k], b_row, vl);
+        acc3 = vfwmacc_vf_f32m4(acc3, a_[3 * N + k], b_row, vl);
+      }
+      vse32_v_f32m4(c + (i + 0) * P + j, acc0, vl);
+      vse32_v_f32m4(c + (i + 1) * P + j, acc1, vl);
+      vse32_v_f32m4(c + (i + 2) * P + j, acc2, vl);
+      vse32_v_f32m4(c + (i + 3) * P + j, acc3, vl);
+    }
+
+    // Leftover rows
+    for (; i < M; ++i) {
+      acc0 = vfmv_v_f_f32m4(0, vl);
+      for (unsigned long int k = 0; k < N; ++k) {
+        b_row = vle16_v_f16m2(b + k * P + j, vl);
+        acc0 = vfwmacc_vf_f32m4(acc0, a[i * N + k], b_row, vl);
+      }
+      vse32_v_f32m4(c + i * P + j, acc0, vl);
+    }
+  }
+}
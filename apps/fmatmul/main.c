@@ -22,6 +22,7 @@
 #include <string.h>
 
 #include "kernel/fmatmul.h"
+#include "parallel.h"
 #include "runtime.h"
 #include "util.h"
 
@@ -40,6 +41,13 @@ extern double b[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
 extern double c[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
 // Gold results
 extern double g[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+// fp16 inputs, fp32 output
+extern _Float16 a_f16[]
+    __attribute__((aligned(32 * NR_LANES), section(".l2")));
+extern _Float16 b_f16[]
+    __attribute__((aligned(32 * NR_LANES), section(".l2")));
+extern float c_f32[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+extern float g_f32[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
 
 #define THRESHOLD 0.001
 
@@ -57,7 +65,79 @@ int verify_matrix(double *result, double *gold, size_t R, size_t C,
   return 0;
 }
 
+int verify_matrix_f32(float *result, float *gold, size_t R, size_t C,
+                      double threshold) {
+  for (uint64_t i = 0; i < R; ++i) {
+    for (uint64_t j = 0; j < C; ++j) {
+      uint64_t idx = i * C + j;
+      if (!similarity_check(result[idx], gold[idx], threshold)) {
+        return (i + j) == 0 ? -1 : idx;
+      }
+    }
+  }
+  return 0;
+}
+
+// Multi-tile scaling: every tile computes a contiguous block of rows of C
+void fmatmul_rows(uint64_t r0, uint64_t r1, void *arg) {
+  fmatmul(c + r0 * P, a + r0 * N, b, r1 - r0, N, P);
+}
+
+// Run the full-size fmatmul on 1 to nr_tiles tiles. All the harts call it.
+int scaling() {
+  // The other tiles wait here until hart 0 is done with its own measurements
+  start_barrier();
+
+  uint64_t hartid = get_hartid();
+  int64_t runtime_1 = 0;
+  int error = 0;
+
+  if (hartid == 0) {
+    printf("\n");
+    printf("------------------------------------------------------------\n");
+    printf("Scaling a (%d x %d) x (%d x %d) matmul on %d tiles...\n", M, N, N,
+           P, get_nr_tiles());
+    printf("------------------------------------------------------------\n");
+    printf("\n");
+  }
+
+  for (uint64_t t = 1; t <= get_nr_tiles(); ++t) {
+    if (hartid == 0) {
+      memset(c, 0, M * P * sizeof(double));
+      start_timer();
+    }
+    // Blocks of 16 rows fit all the kernels of fmatmul()
+    parallel_for(M, 16, t, fmatmul_rows, NULL);
+    if (hartid != 0)
+      continue;
+    stop_timer();
+
+    int64_t runtime = get_timer();
+    if (t == 1)
+      runtime_1 = runtime;
+    printf("%d tiles: %d cycles, speedup %f, %f FLOP/cycle.\n", t, runtime,
+           (float)runtime_1 / runtime, 2.0 * M * N * P / runtime);
+
+    // The other tiles wrote C behind the back of our D$
+    dcache_invalidate(c, M * P * sizeof(double));
+    int err = verify_matrix(c, g, M, P, THRESHOLD);
+    if (err != 0) {
+      printf("Error code %d\n", err);
+      error = err;
+    }
+  }
+
+  return error;
+}
+
 int main() {
+  // The other tiles only take part in the multi-tile part, and stay parked
+  // in scaling() until hart 0 gets there
+  if (get_hartid() != 0)
+    return scaling();
+
+  int error = 0;
+
   printf("\n");
   printf("=============\n");
   printf("=  FMATMUL  =\n");
@@ -96,16 +176,54 @@ int main() {
     // Verify the result only for s == M (to keep it simple)
     if (s == M) {
       printf("Verifying result...\n");
-      int error = verify_matrix(c, g, s, s, THRESHOLD);
+      error = verify_matrix(c, g, s, s, THRESHOLD);
       if (error != 0) {
         printf("Error code %d\n", error);
         printf("c[%d]=%d\n", error, c[error]);
-        return error;
       } else {
         printf("Passed.\n");
       }
     }
   }
 
-  return 0;
+  printf("\n");
+  printf("------------------------------------------------------------\n");
+  printf("Calculating a (%d x %d) x (%d x %d) fp16 -> fp32 matmul...\n", M, N,
+         N, P);
+  printf("------------------------------------------------------------\n");
+  printf("\n");
+
+  start_timer();
+  fmatmul_f16(c_f32, a_f16, b_f16, M, N, P);
+  stop_timer();
+
+  int64_t runtime = get_timer();
+  float performance = 2.0 * M * N * P / runtime;
+  // The widening MACs write two fp32 results per 64-bit lane per cycle
+  float utilization = 100 * performance / (4.0 * NR_LANES);
+
+  printf("The execution took %d cycles.\n", runtime);
+  printf("The performance is %f FLOP/cycle (%f%% utilization).\n",
+         performance, utilization);
+
+  printf("Verifying result...\n");
+  int err = verify_matrix_f32(c_f32, g_f32, M, P, THRESHOLD);
+  if (err != 0) {
+    printf("Error code %d\n", err);
+    if (error == 0)
+      error = err;
+  } else {
+    printf("Passed.\n");
+  }
+
+  // Also after a failure, to release the other tiles
+  if (get_nr_tiles() > 1) {
+    err = scaling();
+    if (error == 0)
+      error = err;
+  }
+
+  return error;
 }
+
+PARALLEL_MAIN
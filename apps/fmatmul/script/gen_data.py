@@ -29,6 +29,8 @@ def emit(name, array, alignment='8'):
   print(".balign " + alignment)
   print("%s:" % name)
   bs = array.tobytes()
+  # Pad to a whole number of words (e.g., for 8-bit and 16-bit arrays)
+  bs += bytes(-len(bs) % 4)
   for i in range(0, len(bs), 4):
     s = ""
     for n in range(4):
@@ -57,6 +59,12 @@ C = np.zeros([M, P], dtype=dtype)
 # Golden result matrix
 G = np.matmul(A, B).astype(dtype)
 
+# fp16 variant: fp16 inputs, fp32 output
+A_f16 = A.astype(np.float16)
+B_f16 = B.astype(np.float16)
+C_f32 = np.zeros([M, P], dtype=np.float32)
+G_f32 = np.matmul(A_f16.astype(dtype), B_f16.astype(dtype)).astype(np.float32)
+
 # Create the file
 print(".section .data,\"aw\",@progbits")
 emit("M", np.array(M, dtype=np.uint64))
@@ -66,3 +74,7 @@ emit("a", A, 'NR_LANES*4')
 emit("b", B, 'NR_LANES*4')
 emit("c", C, 'NR_LANES*4')
 emit("g", G, 'NR_LANES*4')
+emit("a_f16", A_f16, 'NR_LANES*4')
+emit("b_f16", B_f16, 'NR_LANES*4')
+emit("c_f32", C_f32, 'NR_LANES*4')
+emit("g_f32", G_f32, 'NR_LANES*4')
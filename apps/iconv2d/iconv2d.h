@@ -42,6 +42,10 @@ void iconv2d_7x7(int64_t *o, int64_t *i, int64_t *f, int64_t M, int64_t N,
 void iconv2d_7x7_block(int64_t *o, int64_t *i, int64_t *f, int64_t R, int64_t C,
                        int64_t n_, int64_t F);
 
+// int8 image and filter, int32 output
+void iconv2d_i8(int32_t *o, const int8_t *i, const int8_t *f, int64_t R,
+                int64_t C, int64_t F);
+
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 
 #endif
@@ -0,0 +1,70 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Reduced-precision 2D convolution: int8 image and filter, int32 output.
+//
+// As in iconv2d_3x3, 4 output rows are computed at once. Each of the 4+F-1
+// input rows of the block is loaded once per filter column (at e8, shifted by
+// the column index), sign-extended to e16, and accumulated into all the
+// output rows it contributes to with vwmacc.vx, which widens the products to
+// int32. Any odd F is supported. R must be a multiple of 4.
+
+#include <riscv_vector.h>
+
+#include "iconv2d.h"
+
+void iconv2d_i8(int32_t *o, const int8_t *i, const int8_t *f, int64_t R,
+                int64_t C, int64_t F) {
+  const int64_t ldi = C + F - 1;
+  vint32m4_t acc0, acc1, acc2, acc3;
+  vint16m2_t row;
+
+  // Stripmine on the output columns
+  size_t vl;
+  for (int64_t c = 0; c < C; c += vl) {
+    vl = vsetvl_e16m2(C - c);
+
+    // Iterate over blocks of 4 output rows
+    for (int64_t r = 0; r < R; r += 4) {
+      acc0 = vmv_v_x_i32m4(0, vl);
+      acc1 = vmv_v_x_i32m4(0, vl);
+      acc2 = vmv_v_x_i32m4(0, vl);
+      acc3 = vmv_v_x_i32m4(0, vl);
+
+      // Input row q of the block feeds the output row b with the filter row
+      // q - b, if in [0, F)
+      for (int64_t q = 0; q < F + 3; ++q) {
+        const int8_t *i_ = i + (r + q) * ldi + c;
+        for (int64_t l = 0; l < F; ++l) {
+          row = vsext_vf2_i16m2(vle8_v_i8m1(i_ + l, vl), vl);
+          if (q < F)
+            acc0 = vwmacc_vx_i32m4(acc0, f[q * F + l], row, vl);
+          if (q >= 1 && q - 1 < F)
+            acc1 = vwmacc_vx_i32m4(acc1, f[(q - 1) * F + l], row, vl);
+          if (q >= 2 && q - 2 < F)
+            acc2 = vwmacc_vx_i32m4(acc2, f[(q - 2) * F + l], row, vl);
+          if (q >= 3)
+            acc3 = vwmacc_vx_i32m4(acc3, f[(q - 3) * F + l], row, vl);
+        }
+      }
+
+      vse32_v_i32m4(o + (r + 0) * C + c, acc0, vl);
+      vse32_v_i32m4(o + (r + 1) * C + c, acc1, vl);
+      vse32_v_i32m4(o + (r + 2) * C + c, acc2, vl);
+      vse32_v_i32m4(o + (r + 3) * C + c, acc3, vl);
+    }
+  }
+}
@@ -41,6 +41,11 @@ extern int64_t golden_o[] __attribute__((aligned(4 * NR_LANES))); // [ M*N ]
 extern int64_t M;
 extern int64_t N;
 extern int64_t F;
+// int8 image and filter, int32 output
+extern int8_t i_i8[] __attribute__((aligned(4 * NR_LANES)));
+extern int8_t f_i8[] __attribute__((aligned(4 * NR_LANES)));
+extern int32_t o_i32[] __attribute__((aligned(4 * NR_LANES)));
+extern int32_t golden_o_i32[] __attribute__((aligned(4 * NR_LANES)));
 
 // Verify the matrices
 int verify_matrix(int64_t *matrix, int64_t *golden_matrix, int64_t R,
@@ -55,6 +60,18 @@ int verify_matrix(int64_t *matrix, int64_t *golden_matrix, int64_t R,
   return 0;
 }
 
+int verify_matrix_i32(int32_t *matrix, int32_t *golden_matrix, int64_t R,
+                      int64_t C) {
+  for (int r = 0; r < R; ++r)
+    for (int c = 0; c < C; ++c)
+      if (matrix[c + C * r] != golden_matrix[c + C * r]) {
+        printf("Error: o[%d][%d] = %d, instead of %d\n", r, c,
+               matrix[c + C * r], golden_matrix[c + C * r]);
+        return 1;
+      }
+  return 0;
+}
+
 void print_matrix(int64_t const *matrix, uint64_t num_rows,
                   uint64_t num_columns) {
   printf("0x%8X\n", (uint64_t)matrix);
@@ -104,5 +121,25 @@ int main() {
     printf("Passed.\n");
   }
 
+  // int8 inputs, int32 accumulation
+  printf("int8 -> int32:\n");
+  start_timer();
+  iconv2d_i8(o_i32, i_i8, f_i8, M, N, F);
+  stop_timer();
+  runtime = get_timer();
+  performance = 2.0 * F * F * M * N / runtime;
+  // The widening MACs write two int32 results per 64-bit lane per cycle
+  utilization = 100 * performance / (4.0 * NR_LANES);
+  printf("The execution took %d cycles.\n", runtime);
+  printf("The performance is %f OP/cycle (%f%% utilization).\n", performance,
+         utilization);
+  printf("Verifying result...\n");
+  if (verify_matrix_i32(o_i32, golden_o_i32, M, N)) {
+    printf("Fail.\n");
+    error = 1;
+  } else {
+    printf("Passed.\n");
+  }
+
   return error;
 }
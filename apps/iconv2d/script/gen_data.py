@@ -61,6 +61,8 @@ def emit(name, array, alignment='8'):
 	print(".balign " + alignment)
 	print("%s:" % name)
 	bs = array.tobytes()
+	# Pad to a whole number of words (e.g., for 8-bit and 16-bit arrays)
+	bs += bytes(-len(bs) % 4)
 	for i in range(0, len(bs), 4):
 		s = ""
 		for n in range(4):
@@ -104,6 +106,12 @@ empty_o = np.zeros((M, N)).astype(np.int64)
 # Calculate the output matrix
 result = np.around(convolve2D(gen_filter, image, padding)).astype(np.int64)
 
+# int8 variant: int8 image and filter, int32 output
+image_i8 = np.random.randint(-128, 128, M_pad * N_pad).astype(np.int8).reshape(M_pad, N_pad)
+filter_i8 = np.random.randint(-128, 128, F * F).astype(np.int8).reshape(F, F)
+empty_o_i32 = np.zeros((M, N)).astype(np.int32)
+result_i32 = np.around(convolve2D(filter_i8.astype(np.int64), image_i8.astype(np.int64), padding)).astype(np.int32)
+
 # Print information on file
 print(".section .data,\"aw\",@progbits")
 emit("M", np.array(M, dtype=np.uint64))
@@ -113,3 +121,7 @@ emit("i", image, 'NR_LANES*4')
 emit("f", gen_filter, 'NR_LANES*4')
 emit("o", empty_o, 'NR_LANES*4')
 emit("golden_o", result, 'NR_LANES*4')
+emit("i_i8", image_i8, 'NR_LANES*4')
+emit("f_i8", filter_i8, 'NR_LANES*4')
+emit("o_i32", empty_o_i32, 'NR_LANES*4')
+emit("golden_o_i32", result_i32, 'NR_LANES*4')
@@ -0,0 +1,71 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Reduced-precision matmul: int8 inputs, int32 accumulation.
+// RVV has no quad-widening MAC, so every row of B is loaded at e8 and
+// sign-extended to e16 once, and then multiplied with vwmacc.vx, which
+// widens the e16 products to e32. The sign extension is amortized over the
+// I8_BLOCK rows of C that reuse the same row of B.
+
+#include <riscv_vector.h>
+
+#include "imatmul.h"
+
+// Number of rows of C computed at once
+#define I8_BLOCK 4
+
+void imatmul_i8(int32_t *c, const int8_t *a, const int8_t *b,
+                const unsigned long int M, const unsigned long int N,
+                const unsigned long int P) {
+  vint32m4_t acc0, acc1, acc2, acc3;
+  vint16m2_t b_row;
+
+  // Stripmine on the columns of C
+  size_t vl;
+  for (unsigned long int j = 0; j < P; j += vl) {
+    vl = vsetvl_e16m2(P - j);
+
+    unsigned long int i = 0;
+    for (; i + I8_BLOCK <= M; i += I8_BLOCK) {
+      const int8_t *a_ = a + i * N;
+      acc0 = vmv_v_x_i32m4(0, vl);
+      acc1 = vmv_v_x_i32m4(0, vl);
+      acc2 = vmv_v_x_i32m4(0, vl);
+      acc3 = vmv_v_x_i32m4(0, vl);
+      for (unsigned long int k = 0; k < N; ++k) {
+        b_row = vsext_vf2_i16m2(vle8_v_i8m1(b + k * P + j, vl), vl);
+        acc0 = vwmacc_vx_i32m4(acc0, a_[0 * N + k], b_row, vl);
+        acc1 = vwmacc_vx_i32m4(acc1, a_[1 * N + k], b_row, vl);
+        acc2 = vwmacc_vx_i32m4(acc2, a_[2 * N + k], b_row, vl);
+        acc3 = vwmacc_vx_i32m4(acc3, a_[3 * N + k], b_row, vl);
+      }
+      vse32_v_i32m4(c + (i + 0) * P + j, acc0, vl);
+      vse32_v_i32m4(c + (i + 1) * P + j, acc1, vl);
+      vse32_v_i32m4(c + (i + 2) * P + j, acc2, vl);
+      vse32_v_i32m4(c + (i + 3) * P + j, acc3, vl);
+    }
+
+    // Leftover rows
+    for (; i < M; ++i) {
+      acc0 = vmv_v_x_i32m4(0, vl);
+      for (unsigned long int k = 0; k < N; ++k) {
+        b_row = vsext_vf2_i16m2(vle8_v_i8m1(b + k * P + j, vl), vl);
+        acc0 = vwmacc_vx_i32m4(acc0, a[i * N + k], b_row, vl);
+      }
+      vse32_v_i32m4(c + i * P + j, acc0, vl);
+    }
+  }
+}
@@ -40,6 +40,11 @@ extern int64_t b[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
 extern int64_t c[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
 // Gold results
 extern int64_t g[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+// int8 inputs, int32 output
+extern int8_t a_i8[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+extern int8_t b_i8[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+extern int32_t c_i32[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
+extern int32_t g_i32[] __attribute__((aligned(32 * NR_LANES), section(".l2")));
 
 // Verify the matrix
 int verify_matrix(int64_t *result, int64_t *gold, size_t R, size_t C) {
@@ -54,6 +59,18 @@ int verify_matrix(int64_t *result, int64_t *gold, size_t R, size_t C) {
   return 0;
 }
 
+int verify_matrix_i32(int32_t *result, int32_t *gold, size_t R, size_t C) {
+  for (uint64_t i = 0; i < R; ++i) {
+    for (uint64_t j = 0; j < C; ++j) {
+      uint64_t idx = i * C + j;
+      if (result[idx] != gold[idx]) {
+        return (i + j) == 0 ? -1 : idx;
+      }
+    }
+  }
+  return 0;
+}
+
 int main() {
   printf("\n");
   printf("=============\n");
@@ -105,5 +122,35 @@ int main() {
     }
   }
 
+  printf("\n");
+  printf("------------------------------------------------------------\n");
+  printf("Calculating a (%d x %d) x (%d x %d) int8 -> int32 matmul...\n", M, N,
+         N, P);
+  printf("------------------------------------------------------------\n");
+  printf("\n");
+
+  start_timer();
+  imatmul_i8(c_i32, a_i8, b_i8, M, N, P);
+  stop_timer();
+
+  int64_t runtime = get_timer();
+  float performance = 2.0 * M * N * P / runtime;
+  // The widening MACs write two int32 results per 64-bit lane per cycle
+  float utilization = 100 * performance / (4.0 * NR_LANES);
+
+  printf("The execution took %d cycles.\n", runtime);
+  printf("The performance is %f OP/cycle (%f%% utilization).\n", performance,
+         utilization);
+
+  printf("Verifying result...\n");
+  int error = verify_matrix_i32(c_i32, g_i32, M, P);
+  if (error != 0) {
+    printf("Error code %d\n", error);
+    printf("c[%d]=%d\n", error, c_i32[error]);
+    return error;
+  } else {
+    printf("Passed.\n");
+  }
+
   return 0;
 }
@@ -29,6 +29,8 @@ def emit(name, array, alignment='8'):
   print(".balign " + alignment)
   print("%s:" % name)
   bs = array.tobytes()
+  # Pad to a whole number of words (e.g., for 8-bit and 16-bit arrays)
+  bs += bytes(-len(bs) % 4)
   for i in range(0, len(bs), 4):
     s = ""
     for n in range(4):
@@ -60,6 +62,12 @@ C = np.zeros([M, P], dtype=dtype)
 # Golden result matrix
 G = np.matmul(A, B).astype(dtype)
 
+# int8 variant: int8 inputs, int32 output
+A_i8 = np.random.randint(-128, 128, size=(M, N)).astype(np.int8)
+B_i8 = np.random.randint(-128, 128, size=(N, P)).astype(np.int8)
+C_i32 = np.zeros([M, P], dtype=np.int32)
+G_i32 = np.matmul(A_i8.astype(np.int64), B_i8.astype(np.int64)).astype(np.int32)
+
 # Create the file
 print(".section .data,\"aw\",@progbits")
 emit("M", np.array(M, dtype=np.uint64))
@@ -69,3 +77,7 @@ emit("a", A, 'NR_LANES*4')
 emit("b", B, 'NR_LANES*4')
 emit("c", C, 'NR_LANES*4')
 emit("g", G, 'NR_LANES*4')
+emit("a_i8", A_i8, 'NR_LANES*4')
+emit("b_i8", B_i8, 'NR_LANES*4')
+emit("c_i32", C_i32, 'NR_LANES*4')
+emit("g_i32", G_i32, 'NR_LANES*4')
@@ -0,0 +1,111 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Microbenchmark of the scalar/vector coherence. Ara's stores invalidate the
+// lines they write in Ariane's D$, unless the invalidation filter knows that
+// Ariane never read them. For each scenario, the app overwrites a buffer with
+// vector stores, reports the cycles, the lines written, and the invalidations
+// sent to the D$, and reads back the buffer with scalar loads:
+// - "cached": Ariane read the buffer before, so every line is invalidated;
+// - "strided": same, with a store per element, but every line is invalidated
+//   only once;
+// - "uncached": Ariane never read the buffer before, so most invalidations
+//   are skipped (the filter aliases memory regions).
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+#include "util.h"
+
+#ifndef SPIKE
+#include "printf.h"
+#else
+#include <stdio.h>
+#endif
+
+// Elements per buffer
+#define N 4096
+
+uint64_t buf[N] __attribute__((aligned(4 * NR_LANES)));
+uint64_t out[N] __attribute__((aligned(4 * NR_LANES)));
+
+int error = 0;
+
+// Store val to x, with unit-stride or (8-byte) strided stores. Ara issues a
+// write burst per element for strided stores.
+void vstore(uint64_t *x, uint64_t val, int strided) {
+  size_t vl;
+  for (size_t i = 0; i < N; i += vl) {
+    asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(N - i));
+    asm volatile("vmv.v.x v8, %0" ::"r"(val));
+    if (strided)
+      asm volatile("vsse64.v v8, (%0), %1" ::"r"(&x[i]),
+                   "r"(sizeof(uint64_t)));
+    else
+      asm volatile("vse64.v v8, (%0)" ::"r"(&x[i]));
+  }
+}
+
+// Check, with scalar loads, that x is val
+void check(const char *name, const uint64_t *x, uint64_t val) {
+  for (int64_t i = 0; i < N; ++i)
+    if (x[i] != val) {
+      printf("Error (%s): [%d] = %lx != %lx\n", name, i, x[i], val);
+      error = 1;
+      return;
+    }
+}
+
+void run(const char *name, uint64_t *x, uint64_t val, int strided) {
+  uint64_t lines = get_inval_lines(), issued = get_inval_issued();
+  start_timer();
+  vstore(x, val, strided);
+  stop_timer();
+  int64_t runtime = get_timer();
+  lines = get_inval_lines() - lines;
+  issued = get_inval_issued() - issued;
+  printf("%-8s: %d cycles, %d lines written, %d invalidations issued\n", name,
+         runtime, lines, issued);
+  check(name, x, val);
+}
+
+int main() {
+  printf("\n");
+  printf("===========\n");
+  printf("=  INVAL  =\n");
+  printf("===========\n");
+  printf("\n");
+  printf("\n");
+
+  // Ariane caches the buffer. The D$ does not allocate on stores, so read it.
+  uint64_t sum = 0;
+  for (int64_t i = 0; i < N; ++i)
+    sum += buf[i];
+  printf("Warm-up checksum: %lx\n", sum);
+
+  HW_CNT_READY;
+  run("cached", buf, 1, 0);
+  run("strided", buf, 2, 1);
+  // Ariane never read out
+  run("uncached", out, 3, 0);
+  HW_CNT_NOT_READY;
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+
+  return error;
+}
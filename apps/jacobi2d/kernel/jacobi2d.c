@@ -236,6 +236,146 @@ void j2d_kernel_asm_v(uint64_t r, uint64_t c, DATA_TYPE *A, DATA_TYPE *B) {
   }
 }
 
+// Temporal blocking (wavefront) version of j2d_v.
+//
+// The sweeps are grouped in passes of up to T sweeps. In each pass, every
+// column strip streams down the grid once, and a sliding window of three
+// rows per sweep level is kept in the vector registers: at step s, the level
+// k produces its row s - k + 1 from the window of the level k - 1. Only the
+// rows of the last level are stored, so the grid is loaded and stored once
+// per T sweeps instead of once per sweep.
+//
+// The columns of level k depend on the columns of level k - 1 at distance 1,
+// so each strip is loaded with a halo of T columns on both sides and the
+// results are correct only in its central part, which is stored with a mask.
+// The halos are recomputed by the neighboring strips.
+//
+// To have the same result as j2d_v, the boundaries of level k are taken from
+// the array that j2d_v would use (A for the even sweeps, B for the odd ones),
+// and the number of passes is even, so that the result ends up in A. The
+// interior of B is left with an intermediate result.
+//
+// T is clamped to J2D_TB_MAX_T and to VLMAX/4, so that at least half of the
+// lanes of a strip produce useful results.
+
+#define J2D_TB_MAX_T 8
+
+static inline vfloat64m1_t j2d_tb_stencil(vfloat64m1_t top, vfloat64m1_t mid,
+                                          vfloat64m1_t bot, size_t vl) {
+  vfloat64m1_t x;
+  x = vfadd_vv_f64m1(mid, top, vl);
+  x = vfadd_vv_f64m1(x, bot, vl);
+  x = vfadd_vv_f64m1(x, vfslide1up_vf_f64m1(mid, 0, vl), vl);
+  x = vfadd_vv_f64m1(x, vfslide1down_vf_f64m1(mid, 0, vl), vl);
+  return vfmul_vf_f64m1(x, 0.2, vl);
+}
+
+// Row m of the level k: interior rows are computed from the window of the
+// level k - 1 (or loaded from src for k == 0), boundary rows are loaded. The
+// boundary columns within the strip are restored from the array of the level
+// (A if the global sweep index g is even, B otherwise).
+#define J2D_TB_ROW(x, k, g, top, mid, bot, src, m)                             \
+  do {                                                                         \
+    const DATA_TYPE *b_ = bd[(g)&1] + (m)*c;                                   \
+    if ((m) == 0 || (m) == (int64_t)r - 1) {                                   \
+      x = vle64_v_f64m1(b_ + ws, vl);                                          \
+    } else {                                                                   \
+      x = (k) ? j2d_tb_stencil(top, mid, bot, vl)                              \
+              : vle64_v_f64m1((src) + (m)*c + ws, vl);                         \
+      if (ws == 0)                                                             \
+        x = vfmerge_vfm_f64m1(m_left, x, b_[0], vl);                           \
+      if (we == c)                                                             \
+        x = vfmerge_vfm_f64m1(m_right, x, b_[c - 1], vl);                      \
+    }                                                                          \
+  } while (0)
+
+// Step s of the level k: produce the row s - k + 1 and push it into the
+// window w<k>, or store it if k is the last level of the pass
+#define J2D_TB_LEVEL(k, w, p)                                                  \
+  if ((k) <= T) {                                                              \
+    const int64_t m = s - (k) + 1;                                             \
+    if ((k) == T) {                                                            \
+      if (m > 0 && m < (int64_t)r - 1)                                         \
+        vse64_v_f64m1_m(store, dst + m * c + ws,                               \
+                        j2d_tb_stencil(p##_0, p##_1, p##_2, vl), vl);          \
+    } else if (m >= 0 && m < (int64_t)r) {                                     \
+      vfloat64m1_t x;                                                          \
+      J2D_TB_ROW(x, k, (k) + k0, p##_0, p##_1, p##_2, src, m);                \
+      w##_0 = w##_1;                                                           \
+      w##_1 = w##_2;                                                           \
+      w##_2 = x;                                                               \
+    }                                                                          \
+  }
+
+// One pass of T sweeps, from the level k0 in src to the level k0 + T in dst
+static void j2d_tb_pass(uint64_t r, uint64_t c, DATA_TYPE *A, DATA_TYPE *B,
+                        const DATA_TYPE *src, DATA_TYPE *dst, uint64_t k0,
+                        uint64_t T) {
+  const DATA_TYPE *bd[2] = {A, B};
+  vfloat64m1_t w0_0, w0_1, w0_2, w1_0, w1_1, w1_2, w2_0, w2_1, w2_2;
+  vfloat64m1_t w3_0, w3_1, w3_2, w4_0, w4_1, w4_2, w5_0, w5_1, w5_2;
+  vfloat64m1_t w6_0, w6_1, w6_2, w7_0, w7_1, w7_2;
+  vbool64_t m_left, m_right, store;
+
+  // Central columns per strip
+  const uint64_t width = vsetvlmax_e64m1() - 2 * T;
+
+  for (uint64_t j = 1; j < c - 1; j += width) {
+    // Central columns [j, je), strip with halos [ws, we)
+    const uint64_t je = (j + width < c - 1) ? j + width : c - 1;
+    const uint64_t ws = (j > T) ? j - T : 0;
+    const uint64_t we = (je + T < c) ? je + T : c;
+    const size_t vl = vsetvl_e64m1(we - ws);
+
+    vuint64m1_t id = vid_v_u64m1(vl);
+    m_left = vmseq_vx_u64m1_b64(id, 0, vl);
+    m_right = vmseq_vx_u64m1_b64(id, c - 1 - ws, vl);
+    store = vmandnot_mm_b64(vmsltu_vx_u64m1_b64(id, je - ws, vl),
+                            vmsltu_vx_u64m1_b64(id, j - ws, vl), vl);
+
+    // Wavefront over the rows: the level k produces its row s - k + 1
+    for (int64_t s = -1; s < (int64_t)(r - 2 + T); ++s) {
+      J2D_TB_LEVEL(0, w0, w0)
+      J2D_TB_LEVEL(1, w1, w0)
+      J2D_TB_LEVEL(2, w2, w1)
+      J2D_TB_LEVEL(3, w3, w2)
+      J2D_TB_LEVEL(4, w4, w3)
+      J2D_TB_LEVEL(5, w5, w4)
+      J2D_TB_LEVEL(6, w6, w5)
+      J2D_TB_LEVEL(7, w7, w6)
+      J2D_TB_LEVEL(8, w7, w7)
+    }
+  }
+}
+
+void j2d_tb_v(uint64_t r, uint64_t c, DATA_TYPE *A, DATA_TYPE *B,
+              uint64_t tsteps, uint64_t T) {
+  const uint64_t sweeps = 2 * tsteps;
+  if (T > J2D_TB_MAX_T)
+    T = J2D_TB_MAX_T;
+  if (T > vsetvlmax_e64m1() / 4)
+    T = vsetvlmax_e64m1() / 4;
+  if (T < 1)
+    T = 1;
+  if (!sweeps)
+    return;
+
+  // Even number of passes, as balanced as possible
+  uint64_t passes = (sweeps + T - 1) / T;
+  passes += passes & 1;
+  const uint64_t base = sweeps / passes, rem = sweeps % passes;
+
+  uint64_t k0 = 0;
+  for (uint64_t p = 0; p < passes; ++p) {
+    const uint64_t t = base + (p < rem);
+    if (p & 1)
+      j2d_tb_pass(r, c, A, B, B, A, k0, t);
+    else
+      j2d_tb_pass(r, c, A, B, A, B, k0, t);
+    k0 += t;
+  }
+}
+
 // Debug
 inline void output_printfile(uint64_t r, uint64_t c, DATA_TYPE *A) {
   for (uint32_t i = 0; i < r; i++)
@@ -101,6 +101,8 @@ void j2d_v(uint64_t r, uint64_t c, DATA_TYPE *A, DATA_TYPE *B, uint64_t tsteps);
 void j2d_kernel_v(uint64_t r, uint64_t c, DATA_TYPE *A, DATA_TYPE *B);
 void j2d_kernel_opt_v(uint64_t r, uint64_t c, DATA_TYPE *A, DATA_TYPE *B);
 void j2d_kernel_asm_v(uint64_t r, uint64_t c, DATA_TYPE *A, DATA_TYPE *B);
+void j2d_tb_v(uint64_t r, uint64_t c, DATA_TYPE *A, DATA_TYPE *B,
+              uint64_t tsteps, uint64_t T);
 
 int check_result(uint64_t r, uint64_t c, DATA_TYPE *A_s, DATA_TYPE *B_s,
                  DATA_TYPE *A_v, DATA_TYPE *B_v);
@@ -96,6 +96,13 @@ extern DATA_TYPE A_s[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
 extern DATA_TYPE B_s[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
 extern DATA_TYPE A_v[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
 extern DATA_TYPE B_v[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern DATA_TYPE A_0[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern DATA_TYPE B_0[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern DATA_TYPE A_t[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+extern DATA_TYPE B_t[] __attribute__((aligned(4 * NR_LANES), section(".l2")));
+
+// Sweeps fused by the temporal blocking runs
+static const uint64_t tb_steps[] = {1, 2, 4, 8};
 
 int main() {
   printf("\n");
@@ -113,6 +120,10 @@ int main() {
   DATA_TYPE *A_fixed_v = A_v + mtx_offset;
   DATA_TYPE *B_fixed_s = B_s + mtx_offset;
   DATA_TYPE *B_fixed_v = B_v + mtx_offset;
+  DATA_TYPE *A_fixed_0 = A_0 + mtx_offset;
+  DATA_TYPE *B_fixed_0 = B_0 + mtx_offset;
+  DATA_TYPE *A_fixed_t = A_t + mtx_offset;
+  DATA_TYPE *B_fixed_t = B_t + mtx_offset;
 
   // Check that the matrices are aligned on the actual output data
   // NR_LANES can be maximum 16 here
@@ -178,6 +189,37 @@ int main() {
                A_fixed_v[i * C + j]);
         error = 1;
       }
+
+  // Temporal blocking, fusing T sweeps per pass over the grid
+  for (uint64_t k = 0; k < sizeof(tb_steps) / sizeof(tb_steps[0]); ++k) {
+    const uint64_t T = tb_steps[k];
+    memcpy(A_fixed_t, A_fixed_0, R * C * sizeof(DATA_TYPE));
+    memcpy(B_fixed_t, B_fixed_0, R * C * sizeof(DATA_TYPE));
+
+    printf("Processing the vector benchmark with temporal blocking (T = %d)\n",
+           T);
+    start_timer();
+    j2d_tb_v(R, C, A_fixed_t, B_fixed_t, TSTEPS, T);
+    stop_timer();
+    runtime = get_timer();
+    // Effective performance: the halo columns recomputed by neighboring
+    // strips are not counted
+    performance = (2.0 * TSTEPS * 5.0 * (R - 1) * (C - 1) / runtime);
+    utilization = 100.0 * performance / NR_LANES;
+    printf("Vector jacobi2d (T = %d) cycle count: %d\n", T, runtime);
+    printf("The performance is %f DPFLOP/cycle (%f%% utilization).\n",
+           performance, utilization);
+
+    for (uint32_t i = 0; i < R; i++)
+      for (uint32_t j = 0; j < C; j++)
+        if (!similarity_check(A_fixed_s[i * C + j], A_fixed_t[i * C + j],
+                              THRESHOLD)) {
+          printf("Error (T = %d): [%d, %d], %f, %f\n", T, i, j,
+                 A_fixed_s[i * C + j], A_fixed_t[i * C + j]);
+          error = 1;
+        }
+  }
+
   if (!error)
     printf("Check successful: no errors.\n");
 
@@ -15,7 +15,7 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-# arg1: vector size, arg2: filter size
+# arg1: rows, arg2: columns, arg3: time steps (optional)
 
 import numpy as np
 import sys
@@ -35,17 +35,16 @@ def emit(name, array, alignment='8'):
 ## SCRIPT ##
 ############
 
-if len(sys.argv) == 3:
+if len(sys.argv) == 3 or len(sys.argv) == 4:
   R = int(sys.argv[1])
   C = int(sys.argv[2])
+  TSTEPS = int(sys.argv[3]) if len(sys.argv) == 4 else 1
 else:
-  print("Error. Give me one argument: the number of vector elements.")
+  print("Error. Give me two or three arguments: the number of rows, the number of columns, and the number of time steps (optional).")
   sys.exit()
 
 dtype = np.float64
 
-TSTEPS = 1
-
 # Fill in the extra data to align the matrices to 4*NrLanes in SW
 maxNrLanes   = 16
 maxAlignment = 4*maxNrLanes              # [B]
@@ -66,3 +65,8 @@ emit("A_v", A, 'NR_LANES*4')
 emit("B_v", B, 'NR_LANES*4')
 emit("A_s", A, 'NR_LANES*4')
 emit("B_s", B, 'NR_LANES*4')
+# Initial grids for the temporal blocking runs
+emit("A_0", A, 'NR_LANES*4')
+emit("B_0", B, 'NR_LANES*4')
+emit("A_t", A, 'NR_LANES*4')
+emit("B_t", B, 'NR_LANES*4')
@@ -179,6 +179,105 @@ void run_vector_short_m4(int *wall, int *result_v, uint32_t cols, uint32_t rows,
   }
 }
 
+// Strip-mined version for any number of columns, which processes up to T rows
+// per pass over the columns (T <= PATHFINDER_MAX_T).
+//
+// The columns are split in strips of VLMAX elements. In each pass, the level
+// k (1 <= k <= T) updates the row t0 + k, lagging one strip behind the level
+// k - 1: at step s, it updates the strip j = s - k from the strip j of the
+// row t0 + k - 1, which is still in the vector registers. The boundary
+// elements are carried in scalars: the left one is the last element of the
+// strip j - 1 of the previous level, and the right one is the first element
+// of its strip j + 1, just produced at the same step. So, every strip of the
+// row is loaded and stored once per pass, and no scalar memory access is
+// needed to patch the boundaries.
+//
+// The rows are updated in place in result_v, since the level T stores the
+// strip s - T after the level 0 has loaded the strip s.
+
+static inline vint32m2_t pf_row(vint32m2_t x, int left, int right,
+                                const int *wall, size_t vl) {
+  vint32m2_t w = vle32_v_i32m2(wall, vl);
+  vint32m2_t m = vmin_vv_i32m2(x, vslide1up_vx_i32m2(x, left, vl), vl);
+  m = vmin_vv_i32m2(m, vslide1down_vx_i32m2(x, right, vl), vl);
+  return vadd_vv_i32m2(w, m, vl);
+}
+
+// Last element of the strip
+static inline int pf_last(vint32m2_t x, size_t vl) {
+  return vmv_x_s_i32m2_i32(vslidedown_vx_i32m2(x, x, vl - 1, 1));
+}
+
+// Step s of the level k: update the strip j = s - k of the row t0 + k from
+// the strips j (p<k-1>) and j + 1 (c<k-1>) of the level k - 1 into out, then
+// slide the window of the level k - 1 by one strip
+#define PF_LEVEL(k, km, out)                                                   \
+  if ((k) <= T) {                                                              \
+    const int64_t j = s - (k);                                                 \
+    if (j >= 0 && j < ns) {                                                    \
+      const size_t n = j * vlmax;                                              \
+      const size_t vl = (cols - n < vlmax) ? cols - n : vlmax;                 \
+      const int right = (j + 1 < ns) ? vmv_x_s_i32m2_i32(c##km) : neutral;     \
+      vint32m2_t x = pf_row(p##km, l##km, right, &wall[(t0 + (k)) * cols + n], \
+                            vl);                                               \
+      l##km = pf_last(p##km, vl);                                              \
+      if ((k) == T)                                                            \
+        vse32_v_i32m2(&result_v[n], x, vl);                                    \
+      else                                                                     \
+        out = x;                                                               \
+    }                                                                          \
+    if (j + 1 >= 0 && j + 1 < ns)                                              \
+      p##km = c##km;                                                           \
+  }
+
+// One pass of T rows, from the row t0 in src to the row t0 + T in result_v
+static void pf_pass(int *wall, int *result_v, const int *src, uint32_t cols,
+                    uint32_t t0, uint32_t T) {
+  const int neutral = 0x7fffffff;
+  const size_t vlmax = vsetvlmax_e32m2();
+  const int64_t ns = (cols + vlmax - 1) / vlmax;
+
+  vint32m2_t p0, c0, p1, c1, p2, c2, p3, c3;
+  int l0 = neutral, l1 = neutral, l2 = neutral, l3 = neutral;
+
+  for (int64_t s = 0; s < ns + T; ++s) {
+    if (s < ns) {
+      const size_t n = s * vlmax;
+      const size_t vl = (cols - n < vlmax) ? cols - n : vlmax;
+      c0 = vle32_v_i32m2(&src[n], vl);
+    }
+    PF_LEVEL(1, 0, c1)
+    PF_LEVEL(2, 1, c2)
+    PF_LEVEL(3, 2, c3)
+    PF_LEVEL(4, 3, c3)
+  }
+}
+
+void run_vector_wavefront(int *wall, int *result_v, uint32_t cols,
+                          uint32_t rows, uint32_t num_runs, uint32_t T) {
+  if (T > PATHFINDER_MAX_T)
+    T = PATHFINDER_MAX_T;
+  if (T < 1)
+    T = 1;
+
+  for (uint32_t j = 0; j < num_runs; j++) {
+    // A single row is already the result
+    if (rows == 1) {
+      size_t vl;
+      for (uint32_t n = 0; n < cols; n += vl) {
+        vl = vsetvl_e32m2(cols - n);
+        vse32_v_i32m2(&result_v[n], vle32_v_i32m2(&wall[n], vl), vl);
+      }
+    }
+
+    // The first pass starts from the first row of the wall
+    for (uint32_t t = 0; t < rows - 1; t += T) {
+      const uint32_t tp = (rows - 1 - t < T) ? rows - 1 - t : T;
+      pf_pass(wall, result_v, t ? result_v : wall, cols, t, tp);
+    }
+  }
+}
+
 /*
 // This function is optimized for program sizes that satisfy:
 // cols < (m * L * 128) / (2**sew)
@@ -13,11 +13,16 @@
 #include <stdio.h>
 #endif
 
+// Rows processed per pass by run_vector_wavefront
+#define PATHFINDER_MAX_T 4
+
 int *run(int *wall, int *result_s, int *src, uint32_t cols, uint32_t rows,
          uint32_t num_runs);
 void run_vector(int *wall, int *result_v, uint32_t cols, uint32_t rows,
                 uint32_t num_runs);
 void run_vector_short_m4(int *wall, int *result_v, uint32_t cols, uint32_t rows,
                          uint32_t num_runs, int neutral_value);
+void run_vector_wavefront(int *wall, int *result_v, uint32_t cols,
+                          uint32_t rows, uint32_t num_runs, uint32_t T);
 
 #endif
@@ -68,9 +68,10 @@ int main() {
 #endif
 
   if (cols > NR_LANES * 128) {
-    printf("Using the base algorithm.\n");
+    printf("Using the wavefront algorithm.\n");
     start_timer();
-    run_vector(wall, result_v, cols, rows, num_runs);
+    run_vector_wavefront(wall, result_v, cols, rows, num_runs,
+                         PATHFINDER_MAX_T);
     stop_timer();
   } else {
     printf("Using the optimized algorithm.\n");
@@ -83,6 +84,16 @@ int main() {
 
 #ifdef CHECK
   error = verify_result(s_ptr, result_v, cols);
+
+  // Check the wavefront algorithm for every number of rows per pass
+  for (uint32_t T = 1; T <= PATHFINDER_MAX_T; ++T) {
+    memset(result_v, 0, cols * sizeof(int));
+    start_timer();
+    run_vector_wavefront(wall, result_v, cols, rows, num_runs, T);
+    stop_timer();
+    printf("Wavefront (T = %d) vector code cycles: %d\n", T, get_timer());
+    error |= verify_result(s_ptr, result_v, cols);
+  }
 #else
   error = 0;
 #endif
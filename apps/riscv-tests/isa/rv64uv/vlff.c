@@ -75,6 +75,26 @@ void TEST_CASE8(void) {
              0x0000000000000000);
 }
 
+// First address that faults after a readable region. The load below starts
+// two elements before it, so only its first two elements can be read.
+#ifdef __SPIKE__
+// Spike's default memory ends at 0x1_0000_0000
+#define FOF_FAULT_ADDR 0x100000000UL
+#else
+// Ara's SoC: the UART region ends at 0xC000_1000, and the crossbar answers the
+// unmapped hole after it with DECERR
+#define FOF_FAULT_ADDR 0xC0001000UL
+#endif
+
+// The fault lands after the first element: no trap, and vl is trimmed
+void TEST_CASE9(void) {
+  uint64_t vl;
+  VSET(16, e32, m1);
+  __asm__ volatile("vle32ff.v v1, (%0)" ::"r"(FOF_FAULT_ADDR - 8));
+  __asm__ volatile("csrr %0, vl" : "=r"(vl));
+  XCMP(9, vl, 2);
+}
+
 int main(void) {
   INIT_CHECK();
   enable_vec();
@@ -87,5 +107,6 @@ int main(void) {
   TEST_CASE6();
   TEST_CASE7();
   TEST_CASE8();
+  TEST_CASE9();
   EXIT_CHECK();
 }
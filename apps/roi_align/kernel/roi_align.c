@@ -479,6 +479,234 @@ int64_t CropAndResizePerBox_BHWC_vec(
   return 0;
 }
 
+// Batched RoIAlign on NHWC data: the image is [batch][height][width][depth]
+// and the crops are [box][crop_height][crop_width][depth].
+//
+// The work is split in two phases:
+// 1) The bilinear coordinates of all the boxes are computed at once, with
+//    vectors of boxes. For every crop row, the element offsets of the top and
+//    bottom image rows and the vertical weight are stored in the workspace.
+//    For every crop column, the same is done with the left and right pixels
+//    and the horizontal weight. A weight of -1 marks the sample points that
+//    fall out of the image.
+// 2) For every box, a crop row is a contiguous vector of crop_width * depth
+//    elements, which spans the columns and the channels. The four taps are
+//    gathered with indexed loads, and the indices only depend on the box, so
+//    they are built once and reused for all the crop rows. When the channels
+//    alone fill a vector, the taps are loaded with unit-stride loads instead.
+//
+// So, the throughput scales with boxes x channels, and no per-pixel scalar
+// coordinate computation is left on the scalar core.
+//
+// ws holds ROI_ALIGN_WS_SIZE() 32-bit words.
+
+// Coordinates of the sample points of the boxes along one axis (0 for y, 1
+// for x), stored as [box][crop_size]. The offset of a pixel is
+// box_index * batch_elems + index * index_elems.
+static void roi_align_coords(const float *boxes_data, const int *box_index_data,
+                             const int n_boxes, const int axis,
+                             const int image_size, const int crop_size,
+                             const int32_t batch_elems,
+                             const int32_t index_elems, int32_t *lo,
+                             int32_t *hi, float *lerp) {
+  const ptrdiff_t box_stride = 4 * sizeof(float);
+  const ptrdiff_t out_stride = crop_size * sizeof(int32_t);
+  const float max = image_size - 1;
+  size_t vl;
+
+  for (int b0 = 0; b0 < n_boxes; b0 += vl) {
+    vl = vsetvl_e32m4(n_boxes - b0);
+
+    vfloat32m4_t c1 =
+        vlse32_v_f32m4(&boxes_data[4 * b0 + axis], box_stride, vl);
+    vfloat32m4_t c2 =
+        vlse32_v_f32m4(&boxes_data[4 * b0 + axis + 2], box_stride, vl);
+    vint32m4_t base =
+        vmul_vx_i32m4(vle32_v_i32m4(&box_index_data[b0], vl), batch_elems, vl);
+
+    // Same operations as the scalar code. The compiler may contract the
+    // scalar ones into FMAs, so the coordinates match only within the
+    // verification tolerance. The interpolation is continuous across pixel
+    // boundaries, so a coordinate rounded to the other pixel only changes
+    // the output by a rounding error.
+    vfloat32m4_t start, scale;
+    if (crop_size > 1) {
+      start = vfmul_vf_f32m4(c1, max, vl);
+      scale = vfmul_vf_f32m4(vfsub_vv_f32m4(c2, c1, vl), max, vl);
+      scale = vfdiv_vf_f32m4(scale, crop_size - 1, vl);
+    } else {
+      start = vfmul_vf_f32m4(vfadd_vv_f32m4(c1, c2, vl), 0.5, vl);
+      start = vfmul_vf_f32m4(start, max, vl);
+    }
+
+    for (int i = 0; i < crop_size; ++i) {
+      vfloat32m4_t in = start;
+      if (crop_size > 1)
+        in = vfadd_vv_f32m4(start, vfmul_vf_f32m4(scale, i, vl), vl);
+
+      // Out of the image: sample the pixel 0, with weight -1
+      vbool8_t out = vmor_mm_b8(vmflt_vf_f32m4_b8(in, 0, vl),
+                                vmfgt_vf_f32m4_b8(in, max, vl), vl);
+      in = vfmerge_vfm_f32m4(out, in, 0, vl);
+
+      // in >= 0, so floor(in) == trunc(in), and ceil(in) == floor(in) + 1
+      // unless in is an integer
+      vint32m4_t i0 = vfcvt_rtz_x_f_v_i32m4(in, vl);
+      vfloat32m4_t w = vfsub_vv_f32m4(in, vfcvt_f_x_v_f32m4(i0, vl), vl);
+      vint32m4_t i1 =
+          vadd_vx_i32m4_m(vmfgt_vf_f32m4_b8(w, 0, vl), i0, i0, 1, vl);
+      w = vfmerge_vfm_f32m4(out, w, -1, vl);
+
+      i0 = vmacc_vx_i32m4(base, index_elems, i0, vl);
+      i1 = vmacc_vx_i32m4(base, index_elems, i1, vl);
+      vsse32_v_i32m4(&lo[b0 * crop_size + i], out_stride, i0, vl);
+      vsse32_v_i32m4(&hi[b0 * crop_size + i], out_stride, i1, vl);
+      vsse32_v_f32m4(&lerp[b0 * crop_size + i], out_stride, w, vl);
+    }
+  }
+}
+
+int64_t CropAndResize_BHWC_batched_vec(
+    const float *image_data, const int batch_size, const int depth,
+    const int image_height, const int image_width,
+
+    const float *boxes_data, const int *box_index_data, const int start_box,
+    const int limit_box,
+
+    float *crops_data, const int crop_height, const int crop_width,
+    const float extrapolation_value, int32_t *ws) {
+
+  const int n_boxes = limit_box - start_box;
+  const int row_elements = crop_width * depth;
+  const int crop_elements = crop_height * row_elements;
+
+  for (int b = start_box; b < limit_box; ++b) {
+    const int b_in = box_index_data[b];
+    if (b_in < 0 || b_in >= batch_size) {
+      printf("Error: batch_index %d out of range [0, %d)\n", b_in, batch_size);
+      return -1;
+    }
+  }
+
+  // Workspace
+  int32_t *y_top = ws;
+  int32_t *y_bottom = y_top + n_boxes * crop_height;
+  float *y_lerp = (float *)(y_bottom + n_boxes * crop_height);
+  int32_t *x_left = (int32_t *)(y_lerp + n_boxes * crop_height);
+  int32_t *x_right = x_left + n_boxes * crop_width;
+  float *x_lerp = (float *)(x_right + n_boxes * crop_width);
+  uint32_t *e_x = (uint32_t *)(x_lerp + n_boxes * crop_width);
+  uint32_t *e_d = e_x + row_elements;
+
+  // Phase 1: coordinates of all the boxes
+  roi_align_coords(boxes_data + 4 * start_box, box_index_data + start_box,
+                   n_boxes, 0, image_height, crop_height,
+                   image_height * image_width * depth, image_width * depth,
+                   y_top, y_bottom, y_lerp);
+  roi_align_coords(boxes_data + 4 * start_box, box_index_data + start_box,
+                   n_boxes, 1, image_width, crop_width, 0, depth, x_left,
+                   x_right, x_lerp);
+
+  const size_t vlmax = vsetvlmax_e32m4();
+  size_t vl;
+
+  // Phase 2: crop rows
+  if (depth >= (int)vlmax) {
+    // Unit-stride loads along the channels, for every sample point
+    for (int b = 0; b < n_boxes; ++b) {
+      float *crop = crops_data + (start_box + b) * crop_elements;
+      for (int y = 0; y < crop_height; ++y) {
+        const float wy = y_lerp[b * crop_height + y];
+        const float *top = image_data + y_top[b * crop_height + y];
+        const float *bottom = image_data + y_bottom[b * crop_height + y];
+        for (int x = 0; x < crop_width; ++x) {
+          const float wx = x_lerp[b * crop_width + x];
+          const int32_t l = x_left[b * crop_width + x];
+          const int32_t r = x_right[b * crop_width + x];
+          float *out = crop + y * row_elements + x * depth;
+          for (int d = 0; d < depth; d += vl) {
+            vl = vsetvl_e32m4(depth - d);
+            if (wy < 0 || wx < 0) {
+              vse32_v_f32m4(out + d, vfmv_v_f_f32m4(extrapolation_value, vl),
+                            vl);
+              continue;
+            }
+            vfloat32m4_t tl = vle32_v_f32m4(top + l + d, vl);
+            vfloat32m4_t tr = vle32_v_f32m4(top + r + d, vl);
+            vfloat32m4_t t = vfsub_vv_f32m4(tr, tl, vl);
+            t = vfmadd_vf_f32m4(t, wx, tl, vl);
+            vfloat32m4_t bl = vle32_v_f32m4(bottom + l + d, vl);
+            vfloat32m4_t br = vle32_v_f32m4(bottom + r + d, vl);
+            vfloat32m4_t bt = vfsub_vv_f32m4(br, bl, vl);
+            bt = vfmadd_vf_f32m4(bt, wx, bl, vl);
+            vfloat32m4_t res = vfsub_vv_f32m4(bt, t, vl);
+            res = vfmadd_vf_f32m4(res, wy, t, vl);
+            vse32_v_f32m4(out + d, res, vl);
+          }
+        }
+      }
+    }
+    return 0;
+  }
+
+  // Column (byte offset in the per-box x tables) and channel of every
+  // element of a crop row
+  for (int x = 0; x < crop_width; ++x) {
+    for (int d = 0; d < depth; d += vl) {
+      vl = vsetvl_e32m4(depth - d);
+      vse32_v_u32m4(&e_x[x * depth + d],
+                    vmv_v_x_u32m4(x * sizeof(int32_t), vl), vl);
+      vse32_v_u32m4(&e_d[x * depth + d], vadd_vx_u32m4(vid_v_u32m4(vl), d, vl),
+                    vl);
+    }
+  }
+
+  for (int b = 0; b < n_boxes; ++b) {
+    float *crop = crops_data + (start_box + b) * crop_elements;
+    for (int e = 0; e < row_elements; e += vl) {
+      vl = vsetvl_e32m4(row_elements - e);
+
+      // Tap indices and horizontal weights, shared by all the crop rows
+      vuint32m4_t ex = vle32_v_u32m4(&e_x[e], vl);
+      vuint32m4_t ed = vle32_v_u32m4(&e_d[e], vl);
+      vuint32m4_t il = vluxei32_v_u32m4(
+          (const uint32_t *)&x_left[b * crop_width], ex, vl);
+      vuint32m4_t ir = vluxei32_v_u32m4(
+          (const uint32_t *)&x_right[b * crop_width], ex, vl);
+      il = vsll_vx_u32m4(vadd_vv_u32m4(il, ed, vl), 2, vl);
+      ir = vsll_vx_u32m4(vadd_vv_u32m4(ir, ed, vl), 2, vl);
+      vfloat32m4_t wx = vluxei32_v_f32m4(&x_lerp[b * crop_width], ex, vl);
+      vbool8_t x_out = vmflt_vf_f32m4_b8(wx, 0, vl);
+
+      for (int y = 0; y < crop_height; ++y) {
+        const float wy = y_lerp[b * crop_height + y];
+        float *out = crop + y * row_elements + e;
+        if (wy < 0) {
+          vse32_v_f32m4(out, vfmv_v_f_f32m4(extrapolation_value, vl), vl);
+          continue;
+        }
+        const float *top = image_data + y_top[b * crop_height + y];
+        const float *bottom = image_data + y_bottom[b * crop_height + y];
+
+        vfloat32m4_t tl = vluxei32_v_f32m4(top, il, vl);
+        vfloat32m4_t tr = vluxei32_v_f32m4(top, ir, vl);
+        vfloat32m4_t t = vfsub_vv_f32m4(tr, tl, vl);
+        t = vfmacc_vv_f32m4(tl, wx, t, vl);
+        vfloat32m4_t bl = vluxei32_v_f32m4(bottom, il, vl);
+        vfloat32m4_t br = vluxei32_v_f32m4(bottom, ir, vl);
+        vfloat32m4_t bt = vfsub_vv_f32m4(br, bl, vl);
+        bt = vfmacc_vv_f32m4(bl, wx, bt, vl);
+        vfloat32m4_t res = vfsub_vv_f32m4(bt, t, vl);
+        res = vfmadd_vf_f32m4(res, wy, t, vl);
+        res = vfmerge_vfm_f32m4(x_out, res, extrapolation_value, vl);
+        vse32_v_f32m4(out, res, vl);
+      }
+    }
+  }
+
+  return 0;
+}
+
 // Normalized image
 void init_image(float *vec, size_t size) {
   for (unsigned long int i = 0; i < size; ++i)
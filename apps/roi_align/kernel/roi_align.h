@@ -56,6 +56,22 @@ int64_t CropAndResizePerBox_BHWC_vec(
     float *crops_data, const int crop_height, const int crop_width,
     const float extrapolation_value);
 
+// Batched version on NHWC images and crops, vectorized across the boxes (for
+// the coordinates) and across the crop columns and channels (for the
+// interpolation). ws is a workspace of ROI_ALIGN_WS_SIZE() 32-bit words.
+int64_t CropAndResize_BHWC_batched_vec(
+    const float *image_data, const int batch_size, const int depth,
+    const int image_height, const int image_width,
+
+    const float *boxes_data, const int *box_index_data, const int start_box,
+    const int limit_box,
+
+    float *crops_data, const int crop_height, const int crop_width,
+    const float extrapolation_value, int32_t *ws);
+
+#define ROI_ALIGN_WS_SIZE(n_boxes, depth, crop_height, crop_width)             \
+  (3 * (n_boxes) * ((crop_height) + (crop_width)) + 2 * (crop_width) * (depth))
+
 // Normalized image
 void init_image(float *vec, size_t size);
 
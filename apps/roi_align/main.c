@@ -35,6 +35,9 @@ extern float boxes_data[];
 extern int box_index_data[];
 extern float crops_data[];
 extern float crops_data_vec[];
+extern float image_data_nhwc[];
+extern float crops_data_nhwc[];
+extern int32_t ws[];
 
 // Compare the vector and scalar implementation.
 // Return 0 if no error is found
@@ -123,5 +126,37 @@ int main() {
     printf("Passed.\n");
   }
 
+  // Batched NHWC benchmark
+  printf("Starting batched NHWC vector benchmark...\n");
+  start_timer();
+  CropAndResize_BHWC_batched_vec(image_data_nhwc, BATCH_SIZE, DEPTH,
+                                 IMAGE_HEIGHT, IMAGE_WIDTH, boxes_data,
+                                 box_index_data, 0, N_BOXES, crops_data_nhwc,
+                                 CROP_HEIGHT, CROP_WIDTH, EXTRAPOLATION_VALUE,
+                                 ws);
+  stop_timer();
+  runtime_v = get_timer();
+  printf("Batched NHWC vector benchmark complete.\n");
+
+  printf("The execution took %d cycles.\n", runtime_v);
+  printf("Vector speedup is %f times over the scalar implementation.\n",
+         (float)runtime_s / runtime_v);
+
+  // Check against the scalar BCHW crops
+  for (uint64_t b = 0; b < N_BOXES; ++b)
+    for (uint64_t y = 0; y < CROP_HEIGHT; ++y)
+      for (uint64_t x = 0; x < CROP_WIDTH; ++x)
+        for (uint64_t d = 0; d < DEPTH; ++d) {
+          uint64_t s = ((b * DEPTH + d) * CROP_HEIGHT + y) * CROP_WIDTH + x;
+          uint64_t v = ((b * CROP_HEIGHT + y) * CROP_WIDTH + x) * DEPTH + d;
+          if (!similarity_check_32b(crops_data[s], crops_data_nhwc[v], DELTA)) {
+            printf("Failed. Box %d, (%d, %d), channel %d: %x != %x\n", b, y, x,
+                   d, *((uint32_t *)&crops_data[s]),
+                   *((uint32_t *)&crops_data_nhwc[v]));
+            return 1;
+          }
+        }
+  printf("Passed.\n");
+
   return 0;
 }
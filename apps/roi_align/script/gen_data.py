@@ -74,6 +74,11 @@ dims           = (n_boxes, depth, crop_h, crop_w)
 crops_data     = rand_matrix(dims)
 crops_data_vec = rand_matrix(dims)
 
+# NHWC copy of the image, output crops, and workspace of the batched kernel
+image_data_nhwc = np.ascontiguousarray(image_data.transpose(0, 2, 3, 1))
+crops_data_nhwc = rand_matrix((n_boxes, crop_h, crop_w, depth))
+ws = np.zeros(3 * n_boxes * (crop_h + crop_w) + 2 * crop_w * depth, dtype=np.int32)
+
 # Print information on file
 print(".section .data,\"aw\",@progbits")
 emit("BATCH_SIZE", np.array(batch_size, dtype=np.uint64))
@@ -88,3 +93,6 @@ emit("boxes_data", boxes_data, 'NR_LANES*4')
 emit("box_index_data", box_index_data, 'NR_LANES*4')
 emit("crops_data", np.concatenate(crops_data), 'NR_LANES*4')
 emit("crops_data_vec", np.concatenate(crops_data_vec), 'NR_LANES*4')
+emit("image_data_nhwc", image_data_nhwc, 'NR_LANES*4')
+emit("crops_data_nhwc", crops_data_nhwc, 'NR_LANES*4')
+emit("ws", ws, 'NR_LANES*4')
@@ -22,6 +22,8 @@
 #include "riscv_vector.h"
 
 #include "../softmax/lib/exp.h"
+#include "vfuse.h"
+#include "vmath.h"
 
 // Our fdiv cannot receive any X in input
 // The following macro is just a trick and should NOT be used
@@ -30,26 +32,23 @@
 // Scalar implmentation inspired by OpenCV softmax:
 // https://github.com/opencv/opencv/blob/master/modules/dnn/src/layers/softmax_layer.cpp
 void softmax(const float *i, const float *o, const float *buf,
-             uint64_t channels, uint64_t innerSize) {
+             uint64_t outerSize, uint64_t channels, uint64_t innerSize) {
 
   // OpenCV names
   float *srcPtr = (float *)i;
   float *bufPtr = (float *)buf;
   float *dstPtr = (float *)o;
 
-  // Batch size == 1
-  size_t outerSize = 1;
-
   // Steps
   size_t outerStep = channels * innerSize;
   size_t cnStep = innerSize;
 
-  // Compute max along axis
   for (size_t outerDim = 0; outerDim < outerSize; outerDim++) {
 
     size_t srcOffset = outerDim * outerStep;
     size_t bufOffset = outerDim * cnStep;
 
+    // Compute max along axis
     memcpy(bufPtr + bufOffset, srcPtr + srcOffset, innerSize * sizeof(float));
 
     for (size_t cnDim = 1; cnDim < channels; cnDim++) {
@@ -60,49 +59,34 @@ void softmax(const float *i, const float *o, const float *buf,
     }
 
     // Subtract max
-    for (size_t outerDim = 0; outerDim < outerSize; outerDim++) {
-      size_t srcOffset = outerDim * outerStep;
-      size_t bufOffset = outerDim * cnStep;
-
-      for (size_t cnDim = 0; cnDim < channels; cnDim++) {
-        const int offset = srcOffset + cnDim * cnStep;
-        for (size_t i = 0; i < innerSize; i++)
-          dstPtr[offset + i] = srcPtr[offset + i] - bufPtr[bufOffset + i];
-      }
+    for (size_t cnDim = 0; cnDim < channels; cnDim++) {
+      const int offset = srcOffset + cnDim * cnStep;
+      for (size_t i = 0; i < innerSize; i++)
+        dstPtr[offset + i] = srcPtr[offset + i] - bufPtr[bufOffset + i];
     }
 
     // Exponentiate
-    for (size_t outerDim = 0; outerDim < outerSize; outerDim++) {
-      size_t srcOffset = outerDim * outerStep;
-
-      for (size_t cnDim = 0; cnDim < channels; cnDim++) {
-        const int offset = srcOffset + cnDim * cnStep;
-        for (size_t i = 0; i < innerSize; i++)
-          dstPtr[offset + i] = exp(dstPtr[offset + i]);
-      }
+    for (size_t cnDim = 0; cnDim < channels; cnDim++) {
+      const int offset = srcOffset + cnDim * cnStep;
+      for (size_t i = 0; i < innerSize; i++)
+        dstPtr[offset + i] = exp(dstPtr[offset + i]);
     }
 
-    // Sum exps and divide
-    for (size_t outerDim = 0; outerDim < outerSize; outerDim++) {
-      size_t srcOffset = outerDim * outerStep;
-      size_t bufOffset = outerDim * cnStep;
+    // Sum exp along axis
+    for (size_t i = 0; i < innerSize; i++)
+      bufPtr[bufOffset + i] = 0.f;
 
-      // Sum exp along axis
+    for (size_t cnDim = 0; cnDim < channels; cnDim++) {
+      const int offset = srcOffset + cnDim * cnStep;
       for (size_t i = 0; i < innerSize; i++)
-        bufPtr[bufOffset + i] = 0.f;
-
-      for (size_t cnDim = 0; cnDim < channels; cnDim++) {
-        const int offset = srcOffset + cnDim * cnStep;
-        for (size_t i = 0; i < innerSize; i++)
-          bufPtr[bufOffset + i] += dstPtr[offset + i];
-      }
+        bufPtr[bufOffset + i] += dstPtr[offset + i];
+    }
 
-      // Divide by computed sum
-      for (size_t cnDim = 0; cnDim < channels; cnDim++) {
-        const int offset = srcOffset + cnDim * cnStep;
-        for (size_t i = 0; i < innerSize; i++)
-          dstPtr[offset + i] /= bufPtr[bufOffset + i];
-      }
+    // Divide by computed sum
+    for (size_t cnDim = 0; cnDim < channels; cnDim++) {
+      const int offset = srcOffset + cnDim * cnStep;
+      for (size_t i = 0; i < innerSize; i++)
+        dstPtr[offset + i] /= bufPtr[bufOffset + i];
     }
   }
 }
@@ -193,11 +177,13 @@ void softmax_vec(const float *i, const float *o, uint64_t channels,
       Divide by the computed sum
     */
 
+    // One division per strip: multiply the numerators by the reciprocal
+    den_chunk_v = vfrdiv_vf_f32m1(den_chunk_v, 1.0f, vl);
     for (uint64_t ch = 0; ch < channels; ++ch) {
       // Load numerator from memory
       num_chunk_v = vle32_v_f32m1(__o, vl);
-      // Divide
-      res_chunk_v = vfdiv_vv_f32m1(num_chunk_v, den_chunk_v, vl);
+      // Multiply by the reciprocal of the sum
+      res_chunk_v = vfmul_vv_f32m1(num_chunk_v, den_chunk_v, vl);
       // Store the result to memory
       vse32_v_f32m1(__o, res_chunk_v, vl);
       // Bump channel pointers
@@ -211,3 +197,109 @@ void softmax_vec(const float *i, const float *o, uint64_t channels,
     __o = _o;
   }
 }
+
+// Online softmax along the channel axis (stride innerSize), for outerSize
+// batches.
+//
+// The first pass keeps, for every column, the running maximum m and the
+// running sum s of exp(x - m). When a larger element shows up, s must be
+// rescaled by exp(m_old - m_new). Since either x - m_old or m_old - m_new is
+// zero, one exponential per element is enough:
+//   d = x - m, e = exp(-|d|)
+//   d > 0: s = s * e + 1, m = x
+//   else:  s = s + e
+// The second pass recomputes exp(x - m) and multiplies it by 1/s. The
+// numerators are never stored and reloaded, and there is one division per
+// column instead of one per element.
+void softmax_online_vec(const float *i, float *o, uint64_t outerSize,
+                        uint64_t channels, uint64_t innerSize) {
+  vfloat32m2_t x, d, e, max, sum, rcp;
+  vbool16_t gt;
+
+  for (uint64_t b = 0; b < outerSize; ++b) {
+    const float *i_ = i + b * channels * innerSize;
+    float *o_ = o + b * channels * innerSize;
+
+    // Stripmine on innerSize
+    size_t vl;
+    for (uint64_t c = 0; c < innerSize; c += vl) {
+      vl = vsetvl_e32m2(innerSize - c);
+
+      // Running maximum and sum
+      max = vle32_v_f32m2(i_ + c, vl);
+      sum = vfmv_v_f_f32m2(1.0f, vl);
+      for (uint64_t ch = 1; ch < channels; ++ch) {
+        x = vle32_v_f32m2(i_ + ch * innerSize + c, vl);
+        d = vfsub_vv_f32m2(x, max, vl);
+        gt = vmfgt_vf_f32m2_b16(d, 0, vl);
+        e = vexp_f32m2(vfsgnj_vf_f32m2(d, -1.0f, vl), vl);
+        sum = vfmul_vv_f32m2_m(gt, sum, sum, e, vl);
+        sum = vfadd_vv_f32m2(sum, vfmerge_vfm_f32m2(gt, e, 1.0f, vl), vl);
+        max = vfmax_vv_f32m2(max, x, vl);
+      }
+      rcp = vfrdiv_vf_f32m2(sum, 1.0f, vl);
+
+      // Normalize
+      for (uint64_t ch = 0; ch < channels; ++ch) {
+        x = vle32_v_f32m2(i_ + ch * innerSize + c, vl);
+        x = vexp_f32m2(vfsub_vv_f32m2(x, max, vl), vl);
+        vse32_v_f32m2(o_ + ch * innerSize + c, vfmul_vv_f32m2(x, rcp, vl), vl);
+      }
+    }
+  }
+}
+
+// Online softmax along the contiguous last axis, for rows x len elements
+// (e.g., the attention scores of a transformer, one row per query).
+//
+// The first pass stripmines the row, reduces each strip to its maximum with
+// vfredmax, rescales the running sum by exp(m_old - m_new) if the maximum
+// grew, and accumulates the exp(x - m) of the strip with vfredusum. The
+// second pass is the same as in softmax_online_vec, written with
+// common/vfuse.h.
+#define VFUSE_SEW 32
+#define VFUSE_LMUL 4
+
+void softmax_lastaxis_vec(const float *i, float *o, uint64_t rows,
+                          uint64_t len) {
+  vfloat32m4_t x;
+  // Only element 0 is used, but the accumulator of the reductions must not be
+  // read uninitialized
+  vfloat32m1_t red = vfmv_v_f_f32m1(0, 1);
+
+  for (uint64_t r = 0; r < rows; ++r) {
+    const float *i_ = i + r * len;
+    float *o_ = o + r * len;
+    float max = i_[0];
+    float sum = 0;
+
+    // Running maximum and sum
+    size_t vl;
+    for (uint64_t c = 0; c < len; c += vl) {
+      vl = vsetvl_e32m4(len - c);
+      x = vle32_v_f32m4(i_ + c, vl);
+
+      red = vfmv_s_f_f32m1(red, max, vl);
+      red = vfredmax_vs_f32m4_f32m1(red, x, red, vl);
+      float max_new = vfmv_f_s_f32m1_f32(red);
+      if (max_new > max) {
+        sum *= expf(max - max_new);
+        max = max_new;
+      }
+
+      x = vexp_f32m4(vfsub_vf_f32m4(x, max, vl), vl);
+      red = vfmv_s_f_f32m1(red, sum, vl);
+      red = vfredusum_vs_f32m4_f32m1(red, x, red, vl);
+      sum = vfmv_f_s_f32m1_f32(red);
+    }
+    const float rcp = 1.0f / sum;
+
+    // Normalize, fused: one load and one store per element
+    VFUSE_FOR(len) {
+      VF_ST(o_, VF_MULS(VF_MATH(vexp, VF_SUBS(VF_LD(i_), max)), rcp));
+    }
+  }
+}
+
+#undef VFUSE_SEW
+#undef VFUSE_LMUL
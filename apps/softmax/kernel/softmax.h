@@ -20,9 +20,15 @@
 #define _SOFTMAX_H_
 
 void softmax(const float *i, const float *o, const float *buf,
-             uint64_t channels, uint64_t innerSize);
+             uint64_t outerSize, uint64_t channels, uint64_t innerSize);
 
 void softmax_vec(const float *i, const float *o, uint64_t channels,
                  uint64_t innerSize);
 
+void softmax_online_vec(const float *i, float *o, uint64_t outerSize,
+                        uint64_t channels, uint64_t innerSize);
+
+void softmax_lastaxis_vec(const float *i, float *o, uint64_t rows,
+                          uint64_t len);
+
 #endif
@@ -41,12 +41,29 @@
 
 #define THRESHOLD 0.0001
 
+extern uint64_t outerSize;
 extern uint64_t channels;
 extern uint64_t innerSize;
 extern float i[] __attribute__((aligned(4 * NR_LANES)));
 extern float buf[] __attribute__((aligned(4 * NR_LANES)));
 extern float o_s[] __attribute__((aligned(4 * NR_LANES)));
 extern float o_v[] __attribute__((aligned(4 * NR_LANES)));
+extern float o_o[] __attribute__((aligned(4 * NR_LANES)));
+extern float o_l[] __attribute__((aligned(4 * NR_LANES)));
+extern float o_g[] __attribute__((aligned(4 * NR_LANES)));
+extern float o_lg[] __attribute__((aligned(4 * NR_LANES)));
+
+// Compare an output with its golden model
+int check(const char *name, const float *o, const float *g, uint64_t len) {
+  int error = 0;
+  for (uint64_t k = 0; k < len; ++k) {
+    if (!similarity_check(o[k], g[k], THRESHOLD)) {
+      error = 1;
+      printf("Error (%s) at index %d. %f != %f\n", name, k, o[k], g[k]);
+    }
+  }
+  return error;
+}
 
 int main() {
   printf("\n");
@@ -56,14 +73,17 @@ int main() {
   printf("\n");
   printf("\n");
 
-  printf("Channels: %lu\nInner Size: %lu\n", channels, innerSize);
+  printf("Batch: %lu\nChannels: %lu\nInner Size: %lu\n", outerSize, channels,
+         innerSize);
+
+  const uint64_t len = outerSize * channels * innerSize;
 
   int64_t runtime;
   int error = 0;
 
   printf("Scalar Softmax...\n");
   start_timer();
-  softmax(i, o_s, buf, channels, innerSize);
+  softmax(i, o_s, buf, outerSize, channels, innerSize);
   stop_timer();
 
   runtime = get_timer();
@@ -71,21 +91,39 @@ int main() {
 
   printf("Vector Softmax...\n");
   start_timer();
-  softmax_vec(i, o_v, channels, innerSize);
+  for (uint64_t b = 0; b < outerSize; ++b)
+    softmax_vec(i + b * channels * innerSize, o_v + b * channels * innerSize,
+                channels, innerSize);
   stop_timer();
 
   runtime = get_timer();
   printf("The vector Softmax execution took %d cycles.\n", runtime);
 
+  printf("Vector online Softmax (channel axis)...\n");
+  start_timer();
+  softmax_online_vec(i, o_o, outerSize, channels, innerSize);
+  stop_timer();
+
+  runtime = get_timer();
+  printf("The vector online Softmax execution took %d cycles.\n", runtime);
+
+  printf("Vector online Softmax (last axis)...\n");
+  start_timer();
+  softmax_lastaxis_vec(i, o_l, outerSize * channels, innerSize);
+  stop_timer();
+
+  runtime = get_timer();
+  printf("The vector last-axis Softmax execution took %d cycles.\n", runtime);
+
 #ifdef PRINT_RESULTS
-  for (uint64_t k = 0; k < channels * innerSize; ++k) {
+  for (uint64_t k = 0; k < len; ++k) {
     printf("%lu) Vector, Scalar: %x, %x\n", k, *((uint32_t *)&(o_v[k])),
            *((uint32_t *)&(o_s[k])));
   }
 #endif
 
 #ifdef CHECK
-  for (uint64_t k = 0; k < channels * innerSize; ++k) {
+  for (uint64_t k = 0; k < len; ++k) {
 #ifdef SANITY_CHECK
     if (o_s[k] != o_v[k]) {
 #else
@@ -95,6 +133,8 @@ int main() {
       printf("Error at index %d. %f != %f\n", k, o_v[k], o_s[k]);
     }
   }
+  error |= check("online", o_o, o_g, len);
+  error |= check("last axis", o_l, o_lg, len);
   if (!error)
     printf("Check okay. No errors.\n");
 #endif
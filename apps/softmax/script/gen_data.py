@@ -15,7 +15,7 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-# arg1: vector size, arg2: filter size
+# arg1: batch size (optional), arg2: channels, arg3: inner size
 
 import random as rand
 import numpy as np
@@ -35,30 +35,48 @@ def emit(name, array, alignment='8'):
 def rand_matrix(N, dtype):
   return np.random.rand(N).astype(dtype)
 
+# Softmax of x along axis, in float64
+def softmax(x, axis):
+  e = np.exp(x - x.max(axis=axis, keepdims=True))
+  return e / e.sum(axis=axis, keepdims=True)
+
 ############
 ## SCRIPT ##
 ############
 
 if len(sys.argv) == 3:
+  outerSize = 1
   channels = int(sys.argv[1])
   innerSize = int(sys.argv[2])
+elif len(sys.argv) == 4:
+  outerSize = int(sys.argv[1])
+  channels = int(sys.argv[2])
+  innerSize = int(sys.argv[3])
 else:
-  print("Error. Give me two arguments: the number of channels and the inner size.")
+  print("Error. Give me two or three arguments: the batch size (optional), the number of channels, and the inner size.")
   sys.exit()
 
-# Vector of samples
-i = rand_matrix(channels * innerSize, np.float32).astype(np.float32)
+# Vector of samples, in [-8, 8) to exercise the running maximum
+i = (16 * rand_matrix(outerSize * channels * innerSize, np.float32) - 8).astype(np.float32)
+
+# Golden models: softmax along the channel axis, and along the last axis
+x = i.astype(np.float64).reshape(outerSize, channels, innerSize)
+o_g = softmax(x, 1).astype(np.float32).flatten()
+o_lg = softmax(x, 2).astype(np.float32).flatten()
 
 # Results buffer
-buf = np.zeros(channels * innerSize, dtype=np.float32)
-o_s = np.zeros(channels * innerSize, dtype=np.float32)
-o_g = np.zeros(channels * innerSize, dtype=np.float32)
+o_v = np.zeros(outerSize * channels * innerSize, dtype=np.float32)
 
 # Create the file
 print(".section .data,\"aw\",@progbits")
+emit("outerSize", np.array(outerSize, dtype=np.uint64))
 emit("channels", np.array(channels, dtype=np.uint64))
 emit("innerSize", np.array(innerSize, dtype=np.uint64))
 emit("i", i, 'NR_LANES*4')
 emit("buf", i, 'NR_LANES*4')
 emit("o_s", i, 'NR_LANES*4')
 emit("o_v", i, 'NR_LANES*4')
+emit("o_o", o_v, 'NR_LANES*4')
+emit("o_l", o_v, 'NR_LANES*4')
+emit("o_g", o_g, 'NR_LANES*4')
+emit("o_lg", o_lg, 'NR_LANES*4')
@@ -0,0 +1,46 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Generic stencil engine, for 2D and 3D grids, any radius and coefficients,
+// float64 and float32.
+//
+// The kernels are derived from j2d_kernel_v (apps/jacobi2d): the grid is
+// stripmined on the columns, and the output rows of a strip are computed top
+// to bottom. Every input row is used by 2r+1 output rows (2D), so it is kept
+// in the vector registers in a window of rows that rotates by one position
+// for every output row, for radii up to STENCIL_MAX_RADIUS_2D/3D. The
+// horizontal neighbors are obtained with chains of vfslide1up/down, which
+// inject the halo elements from memory.
+//
+// Multiple time steps ping-pong between the two grids, as in j2d_v.
+
+#include <riscv_vector.h>
+#include <stddef.h>
+
+#include "stencil.h"
+
+#define ST_T double
+#define ST_SEW 64
+#include "stencil_impl.h"
+#undef ST_T
+#undef ST_SEW
+
+#define ST_T float
+#define ST_SEW 32
+#include "stencil_impl.h"
+#undef ST_T
+#undef ST_SEW
@@ -0,0 +1,63 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef STENCIL_H
+#define STENCIL_H
+
+#include <stdint.h>
+
+// Stencil description.
+//
+// The grid is [nz x ny x nx], row-major (nz == 1 for 2D stencils). The
+// coefficients are a dense (2r+1)^dims box, [dz][dy][dx], and the zero ones
+// are skipped, so that star (5/9-point 2D, 7-point 3D) and box (9-point 2D,
+// 27-point 3D) stencils of any radius are described in the same way.
+//
+// Variable coefficients: if vc != NULL and vc[k] != NULL, the tap k is
+// weighted by the grid vc[k] (same type and shape as the data, indexed by the
+// output point) instead of c[k]. c[k] must still be nonzero for the tap to be
+// applied.
+typedef struct {
+  int64_t dims;
+  int64_t radius;
+  const double *c;
+  const void *const *vc;
+} stencil_t;
+
+// Largest radius for which the rows are reused across the output rows in the
+// vector registers. Larger radii load every input row once per output row.
+#define STENCIL_MAX_RADIUS_2D 3
+#define STENCIL_MAX_RADIUS_3D 1
+
+// Apply the stencil tsteps times, alternating a -> b and b -> a. The result
+// is in a if tsteps is even, in b otherwise. Only the interior points (at
+// least r away from the borders) are written.
+void stencil_f64(const stencil_t *s, double *a, double *b, int64_t nz,
+                 int64_t ny, int64_t nx, int64_t tsteps);
+void stencil_f32(const stencil_t *s, float *a, float *b, int64_t nz,
+                 int64_t ny, int64_t nx, int64_t tsteps);
+
+// Same as above, without reusing the rows in the vector registers
+void stencil_noreuse_f64(const stencil_t *s, double *a, double *b, int64_t nz,
+                         int64_t ny, int64_t nx, int64_t tsteps);
+void stencil_noreuse_f32(const stencil_t *s, float *a, float *b, int64_t nz,
+                         int64_t ny, int64_t nx, int64_t tsteps);
+
+// Threshold for FP numbers comparison during the final check
+#define THRESHOLD_F64 0.000000001
+#define THRESHOLD_F32 0.0001
+
+#endif
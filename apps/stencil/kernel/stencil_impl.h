@@ -0,0 +1,280 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Stencil engine, type-generic body.
+// This file is included by stencil.c once per data type, with ST_T (element
+// type) and ST_SEW (element width) defined.
+
+#define _ST_CAT3(a, b, c) a##b##c
+#define ST_CAT3(a, b, c) _ST_CAT3(a, b, c)
+#define _ST_CAT5(a, b, c, d, e) a##b##c##d##e
+#define ST_CAT5(a, b, c, d, e) _ST_CAT5(a, b, c, d, e)
+
+#define VFLOAT ST_CAT3(vfloat, ST_SEW, m2_t)
+#define VSETVL ST_CAT3(vsetvl_e, ST_SEW, m2)
+#define VLE ST_CAT5(vle, ST_SEW, _v_f, ST_SEW, m2)
+#define VSE ST_CAT5(vse, ST_SEW, _v_f, ST_SEW, m2)
+#define VFMV ST_CAT3(vfmv_v_f_f, ST_SEW, m2)
+#define VFMACC_VF ST_CAT3(vfmacc_vf_f, ST_SEW, m2)
+#define VFMACC_VV ST_CAT3(vfmacc_vv_f, ST_SEW, m2)
+#define VFSLIDE1UP ST_CAT3(vfslide1up_vf_f, ST_SEW, m2)
+#define VFSLIDE1DOWN ST_CAT3(vfslide1down_vf_f, ST_SEW, m2)
+#define ST_NAME(name) ST_CAT3(name, _f, ST_SEW)
+
+// Tap k of the current row, applied to the shifted row x
+#define ST_TAP(acc, x, k)                                                      \
+  if (vc && vc[k])                                                             \
+    acc = VFMACC_VV(acc, VLE(vc[k] + off, vl), x, vl);                         \
+  else if (c[k] != 0)                                                          \
+    acc = VFMACC_VF(acc, (ST_T)c[k], x, vl);
+
+// Apply the taps of one input row, held in mid (row points to its element
+// j). The shifted copies of the row are built one vfslide1up/down at a time,
+// injecting the halo elements from memory, up to the largest |dx| with a
+// nonzero coefficient in this row (e).
+static inline VFLOAT ST_NAME(stencil_row)(VFLOAT acc, VFLOAT mid,
+                                          const ST_T *row, const double *c,
+                                          const ST_T *const *vc, int64_t off,
+                                          int64_t r, int64_t e, size_t vl) {
+  VFLOAT left = mid, right = mid;
+  ST_TAP(acc, mid, r);
+  for (int64_t d = 1; d <= e; ++d) {
+    left = VFSLIDE1UP(left, row[-d], vl);
+    right = VFSLIDE1DOWN(right, row[vl - 1 + d], vl);
+    ST_TAP(acc, left, r - d);
+    ST_TAP(acc, right, r + d);
+  }
+  return acc;
+}
+
+// Taps of the input row y + dy (coefficient row k), held in w
+#define ST_APPLY(w, k, ptr)                                                    \
+  if (ext[k] >= 0)                                                             \
+    acc = ST_NAME(stencil_row)(acc, w, ptr, s->c + (k)*n,                      \
+                               vc ? vc + (k)*n : NULL, off, r, ext[k], vl);
+
+// 2D, radius <= 3. The input rows y - r ... y + r are kept in w3-r ... w3+r
+// and rotated by one position for every output row, as in j2d_kernel_v.
+static void ST_NAME(stencil_2d)(const stencil_t *s, const int64_t *ext,
+                                const ST_T *in, ST_T *out, int64_t ny,
+                                int64_t nx) {
+  const int64_t r = s->radius, n = 2 * r + 1;
+  const ST_T *const *vc = (const ST_T *const *)s->vc;
+  VFLOAT w0, w1, w2, w3, w4, w5, w6, acc;
+
+#define ST_ROW_2D(y) (in + (y)*nx + j)
+#define ST_APPLY_2D(w, dy)                                                     \
+  if (-r <= (dy) && (dy) <= r)                                                 \
+    ST_APPLY(w, (dy) + r, ST_ROW_2D(y + (dy)))
+
+  // Stripmine on the columns
+  size_t vl;
+  for (int64_t j = r; j < nx - r; j += vl) {
+    vl = VSETVL(nx - r - j);
+
+    // Preload the rows above the first output row and the row itself
+    if (r >= 3)
+      w0 = VLE(ST_ROW_2D(r - 3), vl);
+    if (r >= 2)
+      w1 = VLE(ST_ROW_2D(r - 2), vl);
+    w2 = VLE(ST_ROW_2D(r - 1), vl);
+    w3 = VLE(ST_ROW_2D(r), vl);
+    if (r >= 2)
+      w4 = VLE(ST_ROW_2D(r + 1), vl);
+    if (r >= 3)
+      w5 = VLE(ST_ROW_2D(r + 2), vl);
+
+    for (int64_t y = r; y < ny - r; ++y) {
+      const int64_t off = y * nx + j;
+
+      // Load the bottom row
+      if (r == 1)
+        w4 = VLE(ST_ROW_2D(y + 1), vl);
+      else if (r == 2)
+        w5 = VLE(ST_ROW_2D(y + 2), vl);
+      else
+        w6 = VLE(ST_ROW_2D(y + 3), vl);
+
+      acc = VFMV(0, vl);
+      ST_APPLY_2D(w0, -3)
+      ST_APPLY_2D(w1, -2)
+      ST_APPLY_2D(w2, -1)
+      ST_APPLY_2D(w3, 0)
+      ST_APPLY_2D(w4, 1)
+      ST_APPLY_2D(w5, 2)
+      ST_APPLY_2D(w6, 3)
+      VSE(out + off, acc, vl);
+
+      // Rotate the window
+      if (r >= 3)
+        w0 = w1;
+      if (r >= 2)
+        w1 = w2;
+      w2 = w3;
+      w3 = w4;
+      if (r >= 2)
+        w4 = w5;
+      if (r >= 3)
+        w5 = w6;
+    }
+  }
+
+#undef ST_ROW_2D
+#undef ST_APPLY_2D
+}
+
+// 3D, radius 1, plane z. The input rows y - 1 ... y + 1 of the planes
+// z - 1 ... z + 1 are kept in p<dz>_<dy> and rotated as in stencil_2d.
+static void ST_NAME(stencil_3d)(const stencil_t *s, const int64_t *ext,
+                                const ST_T *in, ST_T *out, int64_t z,
+                                int64_t ny, int64_t nx) {
+  const int64_t r = 1, n = 3;
+  const ST_T *const *vc = (const ST_T *const *)s->vc;
+  VFLOAT p0_0, p0_1, p0_2, p1_0, p1_1, p1_2, p2_0, p2_1, p2_2, acc;
+
+#define ST_ROW_3D(dz, y) (in + ((z + (dz)) * ny + (y)) * nx + j)
+
+  // Stripmine on the columns
+  size_t vl;
+  for (int64_t j = 1; j < nx - 1; j += vl) {
+    vl = VSETVL(nx - 1 - j);
+
+    p0_0 = VLE(ST_ROW_3D(-1, 0), vl);
+    p0_1 = VLE(ST_ROW_3D(-1, 1), vl);
+    p1_0 = VLE(ST_ROW_3D(0, 0), vl);
+    p1_1 = VLE(ST_ROW_3D(0, 1), vl);
+    p2_0 = VLE(ST_ROW_3D(1, 0), vl);
+    p2_1 = VLE(ST_ROW_3D(1, 1), vl);
+
+    for (int64_t y = 1; y < ny - 1; ++y) {
+      const int64_t off = (z * ny + y) * nx + j;
+
+      p0_2 = VLE(ST_ROW_3D(-1, y + 1), vl);
+      p1_2 = VLE(ST_ROW_3D(0, y + 1), vl);
+      p2_2 = VLE(ST_ROW_3D(1, y + 1), vl);
+
+      acc = VFMV(0, vl);
+      ST_APPLY(p0_0, 0, ST_ROW_3D(-1, y - 1))
+      ST_APPLY(p0_1, 1, ST_ROW_3D(-1, y))
+      ST_APPLY(p0_2, 2, ST_ROW_3D(-1, y + 1))
+      ST_APPLY(p1_0, 3, ST_ROW_3D(0, y - 1))
+      ST_APPLY(p1_1, 4, ST_ROW_3D(0, y))
+      ST_APPLY(p1_2, 5, ST_ROW_3D(0, y + 1))
+      ST_APPLY(p2_0, 6, ST_ROW_3D(1, y - 1))
+      ST_APPLY(p2_1, 7, ST_ROW_3D(1, y))
+      ST_APPLY(p2_2, 8, ST_ROW_3D(1, y + 1))
+      VSE(out + off, acc, vl);
+
+      p0_0 = p0_1;
+      p0_1 = p0_2;
+      p1_0 = p1_1;
+      p1_1 = p1_2;
+      p2_0 = p2_1;
+      p2_1 = p2_2;
+    }
+  }
+
+#undef ST_ROW_3D
+}
+
+// Any shape and radius: every input row is loaded once per output row
+static void ST_NAME(stencil_generic)(const stencil_t *s, const int64_t *ext,
+                                     const ST_T *in, ST_T *out, int64_t nz,
+                                     int64_t ny, int64_t nx) {
+  const int64_t r = s->radius, n = 2 * r + 1;
+  const int64_t rz = (s->dims == 3) ? r : 0;
+  const ST_T *const *vc = (const ST_T *const *)s->vc;
+  VFLOAT mid, acc;
+
+  for (int64_t z = rz; z < nz - rz; ++z) {
+    // Stripmine on the columns
+    size_t vl;
+    for (int64_t j = r; j < nx - r; j += vl) {
+      vl = VSETVL(nx - r - j);
+
+      for (int64_t y = r; y < ny - r; ++y) {
+        const int64_t off = (z * ny + y) * nx + j;
+
+        acc = VFMV(0, vl);
+        for (int64_t dz = -rz; dz <= rz; ++dz) {
+          for (int64_t dy = -r; dy <= r; ++dy) {
+            const int64_t k = (dz + rz) * n + dy + r;
+            const ST_T *row = in + ((z + dz) * ny + y + dy) * nx + j;
+            if (ext[k] >= 0) {
+              mid = VLE(row, vl);
+              ST_APPLY(mid, k, row)
+            }
+          }
+        }
+        VSE(out + off, acc, vl);
+      }
+    }
+  }
+}
+
+static void ST_NAME(stencil_run)(const stencil_t *s, ST_T *a, ST_T *b,
+                                 int64_t nz, int64_t ny, int64_t nx,
+                                 int64_t tsteps, int reuse) {
+  const int64_t r = s->radius, n = 2 * r + 1;
+  const int64_t rows = (s->dims == 3) ? n * n : n;
+
+  // Largest |dx| with a nonzero coefficient, for every row of the stencil
+  // (-1 if the row is empty)
+  int64_t ext[rows];
+  for (int64_t k = 0; k < rows; ++k) {
+    ext[k] = -1;
+    for (int64_t dx = -r; dx <= r; ++dx)
+      if (s->c[k * n + dx + r] != 0 && (dx < 0 ? -dx : dx) > ext[k])
+        ext[k] = (dx < 0 ? -dx : dx);
+  }
+
+  for (int64_t t = 0; t < tsteps; ++t) {
+    const ST_T *in = (t & 1) ? b : a;
+    ST_T *out = (t & 1) ? a : b;
+
+    if (reuse && s->dims == 2 && r <= STENCIL_MAX_RADIUS_2D)
+      ST_NAME(stencil_2d)(s, ext, in, out, ny, nx);
+    else if (reuse && s->dims == 3 && r <= STENCIL_MAX_RADIUS_3D)
+      for (int64_t z = 1; z < nz - 1; ++z)
+        ST_NAME(stencil_3d)(s, ext, in, out, z, ny, nx);
+    else
+      ST_NAME(stencil_generic)(s, ext, in, out, nz, ny, nx);
+  }
+}
+
+void ST_NAME(stencil)(const stencil_t *s, ST_T *a, ST_T *b, int64_t nz,
+                      int64_t ny, int64_t nx, int64_t tsteps) {
+  ST_NAME(stencil_run)(s, a, b, nz, ny, nx, tsteps, 1);
+}
+
+void ST_NAME(stencil_noreuse)(const stencil_t *s, ST_T *a, ST_T *b,
+                              int64_t nz, int64_t ny, int64_t nx,
+                              int64_t tsteps) {
+  ST_NAME(stencil_run)(s, a, b, nz, ny, nx, tsteps, 0);
+}
+
+#undef VFLOAT
+#undef VSETVL
+#undef VLE
+#undef VSE
+#undef VFMV
+#undef VFMACC_VF
+#undef VFMACC_VV
+#undef VFSLIDE1UP
+#undef VFSLIDE1DOWN
+#undef ST_NAME
+#undef ST_TAP
+#undef ST_APPLY
@@ -0,0 +1,121 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Generic stencil engine: 2D/3D, star/box, any radius, constant or variable
+// coefficients, float64 and float32. Each configuration is run with and
+// without the row reuse in the vector registers, and checked against the
+// golden model of gen_data.py.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel/stencil.h"
+#include "runtime.h"
+#include "util.h"
+
+#ifndef SPIKE
+#include "printf.h"
+#else
+#include <stdio.h>
+#endif
+
+extern uint64_t dims;
+extern uint64_t radius;
+extern uint64_t nz;
+extern uint64_t ny;
+extern uint64_t nx;
+extern uint64_t tsteps;
+extern uint64_t nvar;
+extern double c[];
+extern double vc_f64[] __attribute__((aligned(4 * NR_LANES)));
+extern float vc_f32[] __attribute__((aligned(4 * NR_LANES)));
+extern double a_f64[] __attribute__((aligned(4 * NR_LANES)));
+extern double b_f64[] __attribute__((aligned(4 * NR_LANES)));
+extern double a0_f64[] __attribute__((aligned(4 * NR_LANES)));
+extern double g_f64[] __attribute__((aligned(4 * NR_LANES)));
+extern float a_f32[] __attribute__((aligned(4 * NR_LANES)));
+extern float b_f32[] __attribute__((aligned(4 * NR_LANES)));
+extern float a0_f32[] __attribute__((aligned(4 * NR_LANES)));
+extern float g_f32[] __attribute__((aligned(4 * NR_LANES)));
+
+// Run one stencil variant on fresh grids, report its performance, and check
+// the result (in a if tsteps is even, in b otherwise)
+#define RUN(name, fn, T, vc)                                                   \
+  do {                                                                         \
+    const stencil_t s = {dims, radius, c, (nvar ? vc : NULL)};                 \
+    memcpy(a_##T, a0_##T, len * sizeof(a_##T[0]));                            \
+    memcpy(b_##T, a0_##T, len * sizeof(b_##T[0]));                             \
+    start_timer();                                                             \
+    fn(&s, a_##T, b_##T, nz, ny, nx, tsteps);                                  \
+    stop_timer();                                                              \
+    int64_t runtime = get_timer();                                             \
+    float performance = 2.0 * taps * points * tsteps / runtime;                \
+    printf("%-17s %s: %d cycles, %f FLOP/cycle.\n", name, #T, runtime,         \
+           performance);                                                       \
+    const typeof(a_##T[0]) *o = (tsteps & 1) ? b_##T : a_##T;                  \
+    for (uint64_t k = 0; k < len; ++k)                                         \
+      if (!similarity_check(o[k], g_##T[k], THRESHOLD_##T)) {                  \
+        printf("Error (%s %s) at index %d: %f != %f\n", name, #T, k, o[k],     \
+               g_##T[k]);                                                      \
+        error = 1;                                                             \
+        break;                                                                 \
+      }                                                                        \
+  } while (0)
+
+#define THRESHOLD_f64 THRESHOLD_F64
+#define THRESHOLD_f32 THRESHOLD_F32
+
+int main() {
+  printf("\n");
+  printf("=============\n");
+  printf("=  STENCIL  =\n");
+  printf("=============\n");
+  printf("\n");
+  printf("\n");
+
+  int error = 0;
+  const uint64_t n = 2 * radius + 1;
+  const uint64_t ncoef = (dims == 3) ? n * n * n : n * n;
+  const uint64_t len = nz * ny * nx;
+  const uint64_t points = (dims == 3 ? nz - 2 * radius : 1) *
+                          (ny - 2 * radius) * (nx - 2 * radius);
+
+  uint64_t taps = 0;
+  for (uint64_t k = 0; k < ncoef; ++k)
+    taps += (c[k] != 0);
+
+  // One variable-coefficient grid per tap
+  const void *vc64[ncoef], *vc32[ncoef];
+  for (uint64_t k = 0; k < ncoef; ++k) {
+    vc64[k] = vc_f64 + k * len;
+    vc32[k] = vc_f32 + k * len;
+  }
+
+  printf("%luD stencil, radius %lu, %lu points, %s coefficients.\n", dims,
+         radius, taps, nvar ? "variable" : "constant");
+  printf("Grid: %lu x %lu x %lu, %lu time steps.\n", nz, ny, nx, tsteps);
+
+  RUN("stencil", stencil_f64, f64, vc64);
+  RUN("stencil_noreuse", stencil_noreuse_f64, f64, vc64);
+  RUN("stencil", stencil_f32, f32, vc32);
+  RUN("stencil_noreuse", stencil_noreuse_f32, f32, vc32);
+
+  if (!error)
+    printf("Check okay. No errors.\n");
+
+  return error;
+}
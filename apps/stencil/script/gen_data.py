@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+# Copyright 2022 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# arg1: dimensions (2 or 3), arg2: shape (star or box), arg3: radius,
+# arg4: grid size, arg5: time steps, arg6: "var" for variable coefficients
+# (optional)
+
+import numpy as np
+import sys
+
+def emit(name, array, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  bs = array.tobytes()
+  for i in range(0, len(bs), 4):
+    s = ""
+    for n in range(4):
+      s += "%02x" % bs[i+3-n]
+    print("    .word 0x%s" % s)
+
+# Apply the stencil tsteps times, ping-ponging between a and b on the
+# interior points, as the kernel does
+def stencil(a, b, c, vc, r, tsteps):
+  dims = a.ndim
+  n = 2 * r + 1
+  inner = tuple(slice(r, s - r) for s in a.shape)
+  for t in range(tsteps):
+    src, dst = (a, b) if t % 2 == 0 else (b, a)
+    acc = np.zeros(dst[inner].shape, dtype=np.float64)
+    for k, off in enumerate(np.ndindex(*([n] * dims))):
+      if c.flat[k] == 0:
+        continue
+      w = vc[k][inner] if vc is not None else c.flat[k]
+      shifted = tuple(slice(o, s - 2 * r + o) for o, s in zip(off, a.shape))
+      acc += w * src[shifted]
+    dst[inner] = acc
+  return a if tsteps % 2 == 0 else b
+
+############
+## SCRIPT ##
+############
+
+if len(sys.argv) == 6 or len(sys.argv) == 7:
+  dims = int(sys.argv[1])
+  shape = sys.argv[2]
+  r = int(sys.argv[3])
+  size = int(sys.argv[4])
+  tsteps = int(sys.argv[5])
+  var = len(sys.argv) == 7 and sys.argv[6] == "var"
+else:
+  print("Error. Give me five or six arguments: the dimensions (2 or 3), the shape (star or box), the radius, the grid size, the number of time steps, and \"var\" for variable coefficients (optional).")
+  sys.exit()
+
+n = 2 * r + 1
+grid = (size, size, size) if dims == 3 else (1, size, size)
+
+# Nonzero coefficients: the axes through the center (star), or all (box)
+idx = np.indices([n] * dims) - r
+if shape == "star":
+  mask = np.count_nonzero(idx, axis=0) <= 1
+else:
+  mask = np.ones([n] * dims, dtype=bool)
+
+# Positive coefficients, normalized to keep the grid bounded over time
+c = np.where(mask, np.random.rand(*([n] * dims)) + 0.1, 0.0)
+c /= c.sum()
+taps = c.size
+
+# Variable coefficients: one grid per tap, zero for the unused taps
+if var:
+  vc = [(np.random.rand(*grid[3 - dims:]) / np.count_nonzero(mask)) * (c.flat[k] != 0) for k in range(taps)]
+  vc_f64 = np.array(vc, dtype=np.float64)
+  vc_f32 = np.array(vc, dtype=np.float32)
+else:
+  vc_f64 = np.zeros(1, dtype=np.float64)
+  vc_f32 = np.zeros(1, dtype=np.float32)
+
+a_f64 = np.random.rand(*grid[3 - dims:]).astype(np.float64)
+a_f32 = a_f64.astype(np.float32)
+
+g_f64 = stencil(a_f64.copy(), a_f64.copy(), c, vc_f64 if var else None, r, tsteps)
+g_f32 = stencil(a_f32.astype(np.float64), a_f32.astype(np.float64),
+                c.astype(np.float32).astype(np.float64),
+                vc_f32.astype(np.float64) if var else None, r, tsteps)
+
+# Create the file
+print(".section .data,\"aw\",@progbits")
+emit("dims", np.array(dims, dtype=np.uint64))
+emit("radius", np.array(r, dtype=np.uint64))
+emit("nz", np.array(grid[0], dtype=np.uint64))
+emit("ny", np.array(grid[1], dtype=np.uint64))
+emit("nx", np.array(grid[2], dtype=np.uint64))
+emit("tsteps", np.array(tsteps, dtype=np.uint64))
+emit("nvar", np.array(int(var), dtype=np.uint64))
+emit("c", c.astype(np.float64))
+emit("vc_f64", vc_f64, 'NR_LANES*4')
+emit("vc_f32", vc_f32, 'NR_LANES*4')
+# Both grids start with the same borders, which are never written
+emit("a_f64", a_f64, 'NR_LANES*4')
+emit("b_f64", a_f64, 'NR_LANES*4')
+emit("a0_f64", a_f64, 'NR_LANES*4')
+emit("g_f64", g_f64.astype(np.float64), 'NR_LANES*4')
+emit("a_f32", a_f32, 'NR_LANES*4')
+emit("b_f32", a_f32, 'NR_LANES*4')
+emit("a0_f32", a_f32, 'NR_LANES*4')
+emit("g_f32", g_f32.astype(np.float32), 'NR_LANES*4')
@@ -0,0 +1,223 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark of the vector paths of the runtime string functions
+// (common/string.c) against their scalar references: memcpy, memset, memmove,
+// memcmp, strlen, and memchr, over sizes from 8 B to 16 KiB. The copies start
+// from a misaligned source and destination, memmove moves the bytes by half
+// of the size in both directions, memcmp compares equal buffers, and
+// the searches stop at the last byte. For each function, it reports the
+// crossover, i.e., the smallest size from which the vector path is faster.
+// memcpy, memset, memmove, and memcmp use the scalar path below
+// STRING_VEC_MIN bytes: run it on the different configurations to tune it for
+// the number of lanes. Every result is checked.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+#include "util.h"
+
+#ifndef SPIKE
+#include "printf.h"
+#else
+#include <stdio.h>
+#endif
+
+#define MIN_SIZE 8
+#define MAX_SIZE 16384
+
+// memmove- moves the bytes to lower addresses (forward copy), memmove+ to
+// higher addresses (backward copy)
+enum {
+  MEMCPY,
+  MEMSET,
+  MEMMOVE_FWD,
+  MEMMOVE_BWD,
+  MEMCMP,
+  STRLEN,
+  MEMCHR,
+  NR_FUN
+};
+const char *names[NR_FUN] = {"memcpy", "memset", "memmove-", "memmove+",
+                             "memcmp", "strlen", "memchr"};
+// Smallest size from which the vector path is faster (0: never)
+uint64_t crossover[NR_FUN];
+
+// Room for memmove, which moves the bytes by up to MAX_SIZE / 2
+uint8_t src[2 * MAX_SIZE] __attribute__((aligned(4 * NR_LANES)));
+uint8_t dst[2 * MAX_SIZE] __attribute__((aligned(4 * NR_LANES)));
+
+int error = 0;
+
+void print_result(int fun, uint64_t n, int64_t scalar, int64_t vector) {
+  printf("%-8s n = %5d: scalar %7d, vector %7d cycles (speedup %f)\n",
+         names[fun], n, scalar, vector, (float)scalar / vector);
+  if (vector < scalar) {
+    if (!crossover[fun])
+      crossover[fun] = n;
+  } else {
+    crossover[fun] = 0;
+  }
+}
+
+void fail(int fun, uint64_t n) {
+  printf("Error (%s, n = %d)\n", names[fun], n);
+  error = 1;
+}
+
+// Time a call
+#define TIME(runtime, call)                                                    \
+  do {                                                                         \
+    start_timer();                                                             \
+    call;                                                                      \
+    stop_timer();                                                              \
+    runtime = get_timer();                                                     \
+  } while (0)
+
+void bench_memcpy(uint64_t n) {
+  int64_t scalar, vector;
+  for (uint64_t i = 0; i < n; ++i)
+    src[i + 3] = (uint8_t)(7 * i + 1);
+
+  TIME(scalar, memcpy_scalar(dst + 5, src + 3, n));
+  memset_scalar(dst, 0, n + 5);
+  TIME(vector, memcpy_vector(dst + 5, src + 3, n));
+  print_result(MEMCPY, n, scalar, vector);
+
+  if (memcmp_scalar(dst + 5, src + 3, n))
+    fail(MEMCPY, n);
+}
+
+void bench_memset(uint64_t n) {
+  int64_t scalar, vector;
+
+  TIME(scalar, memset_scalar(dst + 1, 0x5a, n));
+  memset_scalar(dst + 1, 0, n);
+  TIME(vector, memset_vector(dst + 1, 0xa5, n));
+  print_result(MEMSET, n, scalar, vector);
+
+  for (uint64_t i = 0; i < n; ++i)
+    if (dst[i + 1] != 0xa5) {
+      fail(MEMSET, n);
+      return;
+    }
+}
+
+void init_memmove(uint8_t *buf, uint64_t n) {
+  for (uint64_t i = 0; i < n; ++i)
+    buf[i] = (uint8_t)(3 * i + 1);
+}
+
+// Move n bytes within src by n / 2 + 1 bytes, down (fwd) or up, so that the
+// two buffers overlap. The gold is the scalar memmove within dst.
+void bench_memmove(uint64_t n, int fwd) {
+  int fun = fwd ? MEMMOVE_FWD : MEMMOVE_BWD;
+  uint64_t dist = n / 2 + 1;
+  uint64_t from = fwd ? dist : 0, to = fwd ? 0 : dist;
+  int64_t scalar, vector;
+
+  init_memmove(dst, n + dist);
+  memmove_scalar(dst + to, dst + from, n);
+
+  init_memmove(src, n + dist);
+  TIME(scalar, memmove_scalar(src + to, src + from, n));
+  init_memmove(src, n + dist);
+  TIME(vector, memmove_vector(src + to, src + from, n));
+  print_result(fun, n, scalar, vector);
+
+  if (memcmp_scalar(dst, src, n + dist))
+    fail(fun, n);
+}
+
+void bench_memcmp(uint64_t n) {
+  int64_t scalar, vector;
+  int r_s, r_v;
+  for (uint64_t i = 0; i < n; ++i)
+    src[i] = dst[i + 1] = (uint8_t)(5 * i + 2);
+
+  TIME(scalar, r_s = memcmp_scalar(src, dst + 1, n));
+  TIME(vector, r_v = memcmp_vector(src, dst + 1, n));
+  print_result(MEMCMP, n, scalar, vector);
+
+  // Also check a difference in the last byte
+  dst[n] += 1;
+  if (r_s || r_v || memcmp_vector(src, dst + 1, n) != -1)
+    fail(MEMCMP, n);
+}
+
+void bench_strlen(uint64_t n) {
+  int64_t scalar, vector;
+  size_t len_s, len_v;
+  for (uint64_t i = 0; i < n; ++i)
+    src[i] = (uint8_t)(i % 255 + 1);
+  src[n] = 0;
+
+  TIME(scalar, len_s = strlen_scalar((const char *)src));
+  TIME(vector, len_v = strlen_vector((const char *)src));
+  print_result(STRLEN, n, scalar, vector);
+
+  if (len_s != n || len_v != n)
+    fail(STRLEN, n);
+}
+
+void bench_memchr(uint64_t n) {
+  int64_t scalar, vector;
+  void *p_s, *p_v;
+  for (uint64_t i = 0; i < n; ++i)
+    src[i] = 0;
+  src[n - 1] = 0x42;
+
+  TIME(scalar, p_s = memchr_scalar(src, 0x42, n));
+  TIME(vector, p_v = memchr_vector(src, 0x42, n));
+  print_result(MEMCHR, n, scalar, vector);
+
+  if (p_s != src + n - 1 || p_v != src + n - 1 || memchr(src, 0x43, n))
+    fail(MEMCHR, n);
+}
+
+int main() {
+  printf("\n");
+  printf("============\n");
+  printf("=  STRING  =\n");
+  printf("============\n");
+  printf("\n");
+  printf("\n");
+
+  HW_CNT_READY;
+  for (uint64_t n = MIN_SIZE; n <= MAX_SIZE; n *= 2) {
+    bench_memcpy(n);
+    bench_memset(n);
+    bench_memmove(n, 1);
+    bench_memmove(n, 0);
+    bench_memcmp(n);
+    bench_strlen(n);
+    bench_memchr(n);
+  }
+  HW_CNT_NOT_READY;
+
+  printf("\nCrossover with %d lanes:\n", NR_LANES);
+  for (int f = 0; f < NR_FUN; ++f)
+    if (crossover[f])
+      printf("%-8s %5d B\n", names[f], crossover[f]);
+    else
+      printf("%-8s never\n", names[f]);
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+
+  return error;
+}
@@ -0,0 +1,137 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Microbenchmark of the integer division throughput. For every SEW, it times a
+// sequence of independent vdivu, vdiv, vremu, and vrem on LMUL = 4 vectors of
+// VLMAX elements, and reports the elements divided per cycle. Build the
+// hardware with div_impl=0 (serial divider), div_impl=1 (pipelined, two
+// radix-2 steps per stage), or div_impl=2 (pipelined, four radix-2 steps per
+// stage) to compare the lane dividers. Every result is checked against the
+// scalar reference.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+#include "util.h"
+
+#ifndef SPIKE
+#include "printf.h"
+#else
+#include <stdio.h>
+#endif
+
+// Divisions per measurement (even)
+#define NR_DIVS 8
+
+// LMUL = 4 vector register groups
+uint8_t src_a[VLEN / 2] __attribute__((aligned(4 * NR_LANES)));
+uint8_t src_b[VLEN / 2] __attribute__((aligned(4 * NR_LANES)));
+uint8_t dst[VLEN / 2] __attribute__((aligned(4 * NR_LANES)));
+
+int error = 0;
+
+void print_result(const char *name, int sew, uint64_t vl, int64_t runtime) {
+  printf("%-6s e%-2d: %7d cycles (%f elements/cycle)\n", name, sew, runtime,
+         (float)(NR_DIVS * vl) / runtime);
+}
+
+// Time NR_DIVS independent divisions v8 OP v12 of the SEW S, and check the
+// last one. The divisors are never 0, 1, or -1, so that the C reference never
+// overflows.
+#define DEFINE_BENCH(S, T, OP, C_OP)                                           \
+  void bench_##OP##_e##S() {                                                   \
+    T *a = (T *)src_a, *b = (T *)src_b, *r = (T *)dst;                         \
+    uint64_t vl;                                                               \
+    asm volatile("vsetvli %0, zero, e" #S ", m4, ta, ma" : "=r"(vl));          \
+    for (uint64_t i = 0; i < vl; ++i) {                                        \
+      a[i] = (T)(i * 0x9e3779b97f4a7c15ULL >> (64 - S));                       \
+      b[i] = (T)((i % 13 + 2) * (i & 1 ? -1 : 1));                             \
+    }                                                                          \
+    asm volatile("vle" #S ".v v8, (%0)" ::"r"(a));                             \
+    asm volatile("vle" #S ".v v12, (%0)" ::"r"(b));                            \
+                                                                               \
+    start_timer();                                                             \
+    for (int k = 0; k < NR_DIVS / 2; ++k) {                                    \
+      asm volatile(#OP ".vv v16, v8, v12");                                    \
+      asm volatile(#OP ".vv v20, v8, v12");                                    \
+    }                                                                          \
+    stop_timer();                                                              \
+    int64_t runtime = get_timer();                                             \
+                                                                               \
+    print_result(#OP, S, vl, runtime);                                         \
+                                                                               \
+    asm volatile("vse" #S ".v v20, (%0)" ::"r"(r));                            \
+    for (uint64_t i = 0; i < vl; ++i) {                                        \
+      T gold = a[i] C_OP b[i];                                                 \
+      if (r[i] != gold) {                                                      \
+        printf("Error (" #OP " e%d): r[%d] = %d != %d\n", S, i,               \
+               (int64_t)r[i], (int64_t)gold);                                  \
+        error = 1;                                                             \
+        return;                                                                \
+      }                                                                        \
+    }                                                                          \
+  }
+
+DEFINE_BENCH(8, uint8_t, vdivu, /)
+DEFINE_BENCH(16, uint16_t, vdivu, /)
+DEFINE_BENCH(32, uint32_t, vdivu, /)
+DEFINE_BENCH(64, uint64_t, vdivu, /)
+DEFINE_BENCH(8, int8_t, vdiv, /)
+DEFINE_BENCH(16, int16_t, vdiv, /)
+DEFINE_BENCH(32, int32_t, vdiv, /)
+DEFINE_BENCH(64, int64_t, vdiv, /)
+DEFINE_BENCH(8, uint8_t, vremu, %)
+DEFINE_BENCH(16, uint16_t, vremu, %)
+DEFINE_BENCH(32, uint32_t, vremu, %)
+DEFINE_BENCH(64, uint64_t, vremu, %)
+DEFINE_BENCH(8, int8_t, vrem, %)
+DEFINE_BENCH(16, int16_t, vrem, %)
+DEFINE_BENCH(32, int32_t, vrem, %)
+DEFINE_BENCH(64, int64_t, vrem, %)
+
+int main() {
+  printf("\n");
+  printf("==========\n");
+  printf("=  VDIV  =\n");
+  printf("==========\n");
+  printf("\n");
+  printf("\n");
+
+  HW_CNT_READY;
+  bench_vdivu_e8();
+  bench_vdivu_e16();
+  bench_vdivu_e32();
+  bench_vdivu_e64();
+  bench_vdiv_e8();
+  bench_vdiv_e16();
+  bench_vdiv_e32();
+  bench_vdiv_e64();
+  bench_vremu_e8();
+  bench_vremu_e16();
+  bench_vremu_e32();
+  bench_vremu_e64();
+  bench_vrem_e8();
+  bench_vrem_e16();
+  bench_vrem_e32();
+  bench_vrem_e64();
+  HW_CNT_NOT_READY;
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+
+  return error;
+}
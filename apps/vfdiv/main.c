@@ -0,0 +1,154 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark of the floating-point division, square root, and reciprocal. For
+// every SEW, it stripmines each of them over N elements with LMUL = 4, once
+// with the hardware instructions (vfdiv, vfsqrt, vfrdiv) and once with the
+// fast tier of the vector math library (vdiv_fast, vsqrt_fast, vrecip_fast),
+// and reports the elements per cycle. Build the hardware with fdivsqrt_impl=0
+// (FPnew's serial unit), fdivsqrt_impl=1 (pipelined, two radix-2 steps per
+// stage), or fdivsqrt_impl=2 (pipelined, four radix-2 steps per stage) to
+// compare the lane units. The hardware results are checked against the
+// scalar reference, the fast ones against the relative error of the fast tier.
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+#include "util.h"
+#include "vmath.h"
+
+#ifndef SPIKE
+#include "printf.h"
+#else
+#include <stdio.h>
+#endif
+
+// Elements per measurement
+#define N 512
+
+// Relative error of the fast tier (see vmath.h)
+#define TOL_64 3e-8
+#define TOL_32 1e-4
+#define TOL_16 5e-3
+
+enum { DIV, SQRT, RECIP, NR_OPS };
+const char *names[NR_OPS] = {"div", "sqrt", "recip"};
+
+uint8_t src_a[8 * N] __attribute__((aligned(4 * NR_LANES)));
+uint8_t src_b[8 * N] __attribute__((aligned(4 * NR_LANES)));
+uint8_t dst_hw[8 * N] __attribute__((aligned(4 * NR_LANES)));
+uint8_t dst_fast[8 * N] __attribute__((aligned(4 * NR_LANES)));
+
+int error = 0;
+
+void print_result(int op, int sew, int64_t hw, int64_t fast) {
+  printf("%-5s e%-2d: hardware %f, fast %f elements/cycle (speedup %f)\n",
+         names[op], sew, (float)N / hw, (float)N / fast, (float)hw / fast);
+}
+
+// Check the hardware result against the gold, and the fast one within tol
+int check(int op, int sew, uint64_t i, double hw, double fast, double gold,
+          double tol) {
+  if (hw != gold || fabs(fast - gold) > tol * fabs(gold)) {
+    printf("Error (%s e%d): [%d] = %f, fast %f != %f\n", names[op], sew, i, hw,
+           fast, gold);
+    error = 1;
+    return 1;
+  }
+  return 0;
+}
+
+// Time a call
+#define TIME(runtime, call)                                                    \
+  do {                                                                         \
+    start_timer();                                                             \
+    call;                                                                      \
+    stop_timer();                                                              \
+    runtime = get_timer();                                                     \
+  } while (0)
+
+// Stripmine y[i] = EXPR over N elements, with SEW S and LMUL = 4. EXPR reads
+// the vectors va and vb, loaded from a and b.
+#define APPLY(S, y, a, b, EXPR)                                                \
+  do {                                                                         \
+    size_t vl;                                                                 \
+    for (size_t i = 0; i < N; i += vl) {                                       \
+      vl = vsetvl_e##S##m4(N - i);                                             \
+      vfloat##S##m4_t va = vle##S##_v_f##S##m4(&(a)[i], vl);                   \
+      vfloat##S##m4_t vb = vle##S##_v_f##S##m4(&(b)[i], vl);                   \
+      vse##S##_v_f##S##m4(&(y)[i], EXPR, vl);                                  \
+    }                                                                          \
+  } while (0)
+
+// Benchmark the SEW S, with element type T. The scalar reference computes in
+// the type GT, and rounds to T: for f16, the double rounding through f32 is
+// innocuous for the division and the square root.
+#define DEFINE_BENCH(S, T, GT, SQRT_FN)                                        \
+  void bench_e##S() {                                                          \
+    T *a = (T *)src_a, *b = (T *)src_b, *y = (T *)dst_hw, *z = (T *)dst_fast;  \
+    int64_t hw, fast;                                                          \
+    for (uint64_t i = 0; i < N; ++i) {                                         \
+      a[i] = (T)(1 + (i % 37) / 8.0);                                          \
+      b[i] = (T)((0.75 + (i % 11) / 4.0) * (i & 1 ? -1 : 1));                  \
+    }                                                                          \
+                                                                               \
+    TIME(hw, APPLY(S, y, a, b, vfdiv_vv_f##S##m4(va, vb, vl)));                \
+    TIME(fast, APPLY(S, z, a, b, vdiv_fast_f##S##m4(va, vb, vl)));             \
+    print_result(DIV, S, hw, fast);                                            \
+    for (uint64_t i = 0; i < N; ++i)                                           \
+      if (check(DIV, S, i, y[i], z[i], (T)((GT)a[i] / (GT)b[i]), TOL_##S))     \
+        break;                                                                 \
+                                                                               \
+    TIME(hw, APPLY(S, y, a, b, vfsqrt_v_f##S##m4(va, vl)));                    \
+    TIME(fast, APPLY(S, z, a, b, vsqrt_fast_f##S##m4(va, vl)));                \
+    print_result(SQRT, S, hw, fast);                                           \
+    for (uint64_t i = 0; i < N; ++i)                                           \
+      if (check(SQRT, S, i, y[i], z[i], (T)SQRT_FN((GT)a[i]), TOL_##S))        \
+        break;                                                                 \
+                                                                               \
+    TIME(hw, APPLY(S, y, b, a, vfrdiv_vf_f##S##m4(va, 1, vl)));                \
+    TIME(fast, APPLY(S, z, b, a, vrecip_fast_f##S##m4(va, vl)));               \
+    print_result(RECIP, S, hw, fast);                                          \
+    for (uint64_t i = 0; i < N; ++i)                                           \
+      if (check(RECIP, S, i, y[i], z[i], (T)(1 / (GT)b[i]), TOL_##S))          \
+        break;                                                                 \
+  }
+
+DEFINE_BENCH(64, double, double, sqrt)
+DEFINE_BENCH(32, float, float, sqrtf)
+DEFINE_BENCH(16, _Float16, float, sqrtf)
+
+int main() {
+  printf("\n");
+  printf("===========\n");
+  printf("=  VFDIV  =\n");
+  printf("===========\n");
+  printf("\n");
+  printf("\n");
+
+  HW_CNT_READY;
+  bench_e64();
+  bench_e32();
+  bench_e16();
+  HW_CNT_NOT_READY;
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+
+  return error;
+}
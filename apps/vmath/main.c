@@ -0,0 +1,147 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Accuracy and throughput benchmark of the vector math library
+// (common/vmath.h). For every function, data type, accuracy tier and LMUL,
+// print the cycles per element and the largest error in ulp versus the
+// golden model. The accurate tier is checked against VMATH_ULP_*.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+#include "util.h"
+#include "vmath.h"
+
+#ifndef SPIKE
+#include "printf.h"
+#else
+#include <stdio.h>
+#endif
+
+extern uint64_t N;
+extern double y[] __attribute__((aligned(4 * NR_LANES)));
+
+#define DECLARE_DATA(fn)                                                       \
+  extern double fn##_x_f64[] __attribute__((aligned(4 * NR_LANES)));           \
+  extern double fn##_g_f64[] __attribute__((aligned(4 * NR_LANES)));           \
+  extern float fn##_x_f32[] __attribute__((aligned(4 * NR_LANES)));            \
+  extern float fn##_g_f32[] __attribute__((aligned(4 * NR_LANES)));            \
+  extern _Float16 fn##_x_f16[] __attribute__((aligned(4 * NR_LANES)));         \
+  extern _Float16 fn##_g_f16[] __attribute__((aligned(4 * NR_LANES)));
+
+DECLARE_DATA(exp)
+DECLARE_DATA(log)
+DECLARE_DATA(sin)
+DECLARE_DATA(cos)
+DECLARE_DATA(tanh)
+DECLARE_DATA(sigmoid)
+
+// Largest distance in ulp between two arrays, i.e., the number of
+// representable numbers between a[i] and b[i]
+#define DEFINE_MAX_ULP(S, T, UT)                                               \
+  uint64_t max_ulp_##S(const T *a, const T *b, uint64_t n) {                   \
+    const UT sign = (UT)1 << (S - 1);                                          \
+    uint64_t max = 0;                                                          \
+    for (uint64_t i = 0; i < n; ++i) {                                         \
+      UT ua, ub;                                                               \
+      memcpy(&ua, &a[i], sizeof(T));                                           \
+      memcpy(&ub, &b[i], sizeof(T));                                           \
+      uint64_t ma = ua & (sign - 1), mb = ub & (sign - 1);                     \
+      uint64_t ulp;                                                            \
+      if ((ua & sign) == (ub & sign))                                          \
+        ulp = ma > mb ? ma - mb : mb - ma;                                     \
+      else                                                                     \
+        ulp = ma + mb;                                                         \
+      if (a[i] != a[i] || b[i] != b[i])                                        \
+        ulp = (a[i] != a[i] && b[i] != b[i]) ? 0 : UINT64_MAX;                 \
+      if (ulp > max)                                                           \
+        max = ulp;                                                             \
+    }                                                                          \
+    return max;                                                                \
+  }
+
+DEFINE_MAX_ULP(64, double, uint64_t)
+DEFINE_MAX_ULP(32, float, uint32_t)
+DEFINE_MAX_ULP(16, _Float16, uint16_t)
+
+int error = 0;
+
+void report(const char *fn, const char *type, int lmul, int accurate,
+            int64_t runtime, uint64_t ulp, uint64_t bound) {
+  printf("%-13s %s m%d: %5d cycles (%f cycles/elem), max error %d ulp\n", fn,
+         type, lmul, runtime, (float)runtime / N, ulp);
+  if (accurate && ulp > bound) {
+    printf("Error: %s %s exceeds %d ulp\n", fn, type, bound);
+    error = 1;
+  }
+}
+
+#define BENCH(fn, S, L, accurate, x, g, bound)                                 \
+  do {                                                                         \
+    start_timer();                                                             \
+    VMATH_APPLY(fn, S, L, (VMATH_T_##S *)y, x, N);                             \
+    stop_timer();                                                              \
+    report(#fn, "f" #S, L, accurate, get_timer(),                              \
+           max_ulp_##S((VMATH_T_##S *)y, g, N), bound);                        \
+  } while (0)
+
+// Both tiers of one function and data type, for every LMUL
+#define BENCH_ALL(fn, S, bound)                                                \
+  do {                                                                         \
+    BENCH(v##fn, S, 1, 1, fn##_x_f##S, fn##_g_f##S, bound);                    \
+    BENCH(v##fn, S, 2, 1, fn##_x_f##S, fn##_g_f##S, bound);                    \
+    BENCH(v##fn, S, 4, 1, fn##_x_f##S, fn##_g_f##S, bound);                    \
+    BENCH(v##fn, S, 8, 1, fn##_x_f##S, fn##_g_f##S, bound);                    \
+    BENCH(v##fn##_fast, S, 1, 0, fn##_x_f##S, fn##_g_f##S, bound);             \
+    BENCH(v##fn##_fast, S, 2, 0, fn##_x_f##S, fn##_g_f##S, bound);             \
+    BENCH(v##fn##_fast, S, 4, 0, fn##_x_f##S, fn##_g_f##S, bound);             \
+    BENCH(v##fn##_fast, S, 8, 0, fn##_x_f##S, fn##_g_f##S, bound);             \
+  } while (0)
+
+#define VMATH_T_64 double
+#define VMATH_T_32 float
+#define VMATH_T_16 _Float16
+
+#define BENCH_FUNCTION(fn)                                                     \
+  do {                                                                         \
+    BENCH_ALL(fn, 64, VMATH_ULP_F64);                                          \
+    BENCH_ALL(fn, 32, VMATH_ULP_F32);                                          \
+    BENCH_ALL(fn, 16, VMATH_ULP_F16);                                          \
+  } while (0)
+
+int main() {
+  printf("\n");
+  printf("===========\n");
+  printf("=  VMATH  =\n");
+  printf("===========\n");
+  printf("\n");
+  printf("\n");
+
+  printf("%d samples per function and data type.\n", N);
+
+  BENCH_FUNCTION(exp);
+  BENCH_FUNCTION(log);
+  BENCH_FUNCTION(sin);
+  BENCH_FUNCTION(cos);
+  BENCH_FUNCTION(tanh);
+  BENCH_FUNCTION(sigmoid);
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+
+  return error;
+}
@@ -0,0 +1,76 @@
+# Copyright 2022 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+#!/usr/bin/env python3
+
+# arg1: number of samples per function and data type
+
+import numpy as np
+import sys
+
+def emit(name, array, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  bs = array.tobytes()
+  # Pad to a whole number of words (e.g., for 16-bit arrays)
+  bs += bytes(-len(bs) % 4)
+  for i in range(0, len(bs), 4):
+    s = ""
+    for n in range(4):
+      s += "%02x" % bs[i+3-n]
+    print("    .word 0x%s" % s)
+
+def sigmoid(x):
+  return 1 / (1 + np.exp(-x))
+
+############
+## SCRIPT ##
+############
+
+if len(sys.argv) == 2:
+  N = int(sys.argv[1])
+else:
+  print("Error. Give me one argument: the number of samples.")
+  sys.exit()
+
+types = {'f64': np.float64, 'f32': np.float32, 'f16': np.float16}
+
+# Function, golden model, and input range for f64, f32, f16 (for sin and cos,
+# the whole domain documented in common/vmath.h)
+uniform = lambda lo, hi: (lambda n: np.random.uniform(lo, hi, n))
+logspace = lambda lo, hi: (lambda n: 10 ** np.random.uniform(lo, hi, n))
+functions = [
+  ('exp',     np.exp,  [uniform(-50, 50),   uniform(-20, 20),   uniform(-9, 10)]),
+  ('log',     np.log,  [logspace(-10, 10),  logspace(-10, 10),  logspace(-4, 4)]),
+  ('sin',     np.sin,  [uniform(-1e3, 1e3), uniform(-1e3, 1e3), uniform(-32, 32)]),
+  ('cos',     np.cos,  [uniform(-1e3, 1e3), uniform(-1e3, 1e3), uniform(-32, 32)]),
+  ('tanh',    np.tanh, [uniform(-5, 5),     uniform(-5, 5),     uniform(-5, 5)]),
+  ('sigmoid', sigmoid, [uniform(-10, 10),   uniform(-10, 10),   uniform(-8, 8)]),
+]
+
+print(".section .data,\"aw\",@progbits")
+emit("N", np.array(N, dtype=np.uint64))
+# Output buffer, large enough for any data type
+emit("y", np.zeros(N, dtype=np.float64), 'NR_LANES*4')
+
+for name, gold, ranges in functions:
+  for (suffix, dtype), rng in zip(types.items(), ranges):
+    x = rng(N).astype(dtype)
+    # Golden model in extended precision, rounded to the data type
+    g = gold(x.astype(np.longdouble)).astype(dtype)
+    emit("%s_x_%s" % (name, suffix), x, 'NR_LANES*4')
+    emit("%s_g_%s" % (name, suffix), g, 'NR_LANES*4')
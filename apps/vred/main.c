@@ -0,0 +1,161 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Test and benchmark of the vector reduction library (common/vred.h).
+// The reductions to a scalar are swept over the vector length (the prefixes
+// of x of length 16, 64, 256, ... N), and the sum over the threshold of the
+// tree folds, from the plain vfredusum (no folds) to the full tree. Run it
+// on the different Ara configurations to sweep the number of lanes. Every
+// result is checked against the scalar loop.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+#include "util.h"
+#include "vred.h"
+
+#ifndef SPIKE
+#include "printf.h"
+#else
+#include <stdio.h>
+#endif
+
+extern uint64_t N;
+extern uint64_t NSEG;
+
+#define DECLARE(T, name) extern T name[] __attribute__((aligned(4 * NR_LANES)));
+
+DECLARE(double, x_d)
+DECLARE(float, x_s)
+DECLARE(uint8_t, head)
+DECLARE(uint32_t, off)
+DECLARE(double, seg_d)
+DECLARE(float, seg_s)
+DECLARE(double, o_d)
+DECLARE(float, o_s)
+
+int error = 0;
+
+// The inputs are multiples of 1/64 (see script/gen_data.py), so the sums are
+// exact in any order, and all the results must match the scalar loop exactly
+void check(const char *name, int sew, uint64_t n, double o, double g) {
+  if (o != g) {
+    printf("Error (%s f%d, n = %d). %f != %f\n", name, sew, n, o, g);
+    error = 1;
+  }
+}
+
+// Time a call, and print its cycles per element
+#define BENCH(name, sew, n, call)                                              \
+  do {                                                                         \
+    start_timer();                                                             \
+    call;                                                                      \
+    stop_timer();                                                              \
+    int64_t runtime = get_timer();                                             \
+    printf("%-18s f%d n = %6d: %7d cycles (%f cycles/elem)\n", name, sew, n,   \
+           runtime, (float)runtime / (n));                                     \
+  } while (0)
+
+// Sweep of the reductions of x[0..n-1], for the type with SEW S
+#define DEFINE_SWEEP(S, T, x)                                                  \
+  void sweep_f##S(uint64_t n) {                                                \
+    T sum = 0, max = x[0], min = x[0];                                         \
+    uint64_t imax = 0, imin = 0;                                               \
+    for (uint64_t i = 0; i < n; ++i) {                                         \
+      sum += x[i];                                                             \
+      if (x[i] > max) {                                                        \
+        max = x[i];                                                            \
+        imax = i;                                                              \
+      }                                                                        \
+      if (x[i] < min) {                                                        \
+        min = x[i];                                                            \
+        imin = i;                                                              \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    T r;                                                                       \
+    size_t ir;                                                                 \
+    /* From the plain vfredusum (no folds) to the full tree */                 \
+    const size_t vlmax = vsetvlmax_e##S##m8();                                 \
+    const size_t tree_min[] = {vlmax, 32 * NR_LANES, 8 * NR_LANES, NR_LANES,   \
+                               1};                                             \
+    for (int k = 0; k < 5; ++k) {                                              \
+      char name[32];                                                           \
+      sprintf(name, "sum (tree %d)", tree_min[k]);                             \
+      BENCH(name, S, n, r = vred_sum_tree_f##S(x, n, tree_min[k]));            \
+      check(name, S, n, r, sum);                                               \
+    }                                                                          \
+    BENCH("osum", S, n, r = vred_osum_f##S(x, n));                             \
+    check("osum", S, n, r, sum);                                               \
+    BENCH("max", S, n, r = vred_max_f##S(x, n));                               \
+    check("max", S, n, r, max);                                                \
+    BENCH("min", S, n, r = vred_min_f##S(x, n));                               \
+    check("min", S, n, r, min);                                                \
+    BENCH("argmax", S, n, ir = vred_argmax_f##S(x, n));                        \
+    check("argmax", S, n, ir, imax);                                           \
+    BENCH("argmin", S, n, ir = vred_argmin_f##S(x, n));                        \
+    check("argmin", S, n, ir, imin);                                           \
+  }
+
+DEFINE_SWEEP(64, double, x_d)
+DEFINE_SWEEP(32, float, x_s)
+
+int main() {
+  printf("\n");
+  printf("==========\n");
+  printf("=  VRED  =\n");
+  printf("==========\n");
+  printf("\n");
+  printf("\n");
+
+  printf("N = %d, %d segments\n", N, NSEG);
+
+  for (uint64_t n = 16;; n *= 4) {
+    if (n > N)
+      n = N;
+    sweep_f64(n);
+    sweep_f32(n);
+    if (n == N)
+      break;
+  }
+
+  // Segmented sums, by offsets and by head flags
+  size_t nseg;
+  BENCH("segsum", 64, N, vred_segsum_f64(x_d, off, NSEG, o_d));
+  for (uint64_t s = 0; s < NSEG; ++s)
+    check("segsum", 64, s, o_d[s], seg_d[s]);
+  memset(o_d, 0, NSEG * sizeof(double));
+  BENCH("segsum_mask", 64, N, nseg = vred_segsum_mask_f64(x_d, head, N, o_d));
+  check("segsum_mask count", 64, N, nseg, NSEG);
+  for (uint64_t s = 0; s < NSEG; ++s)
+    check("segsum_mask", 64, s, o_d[s], seg_d[s]);
+
+  BENCH("segsum", 32, N, vred_segsum_f32(x_s, off, NSEG, o_s));
+  for (uint64_t s = 0; s < NSEG; ++s)
+    check("segsum", 32, s, o_s[s], seg_s[s]);
+  memset(o_s, 0, NSEG * sizeof(float));
+  BENCH("segsum_mask", 32, N, nseg = vred_segsum_mask_f32(x_s, head, N, o_s));
+  check("segsum_mask count", 32, N, nseg, NSEG);
+  for (uint64_t s = 0; s < NSEG; ++s)
+    check("segsum_mask", 32, s, o_s[s], seg_s[s]);
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+
+  return error;
+}
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+# Copyright 2022 ETH Zurich and University of Bologna.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# arg1: vector length N, arg2: average segment length L
+
+import numpy as np
+import sys
+
+def emit(name, array, alignment='8'):
+  print(".global %s" % name)
+  print(".balign " + alignment)
+  print("%s:" % name)
+  bs = array.tobytes()
+  # Pad to a multiple of 4 bytes (uint8 arrays)
+  bs += bytes(-len(bs) % 4)
+  for i in range(0, len(bs), 4):
+    s = ""
+    for n in range(4):
+      s += "%02x" % bs[i+3-n]
+    print("    .word 0x%s" % s)
+
+############
+## SCRIPT ##
+############
+
+if len(sys.argv) == 3:
+  N = int(sys.argv[1])
+  L = int(sys.argv[2])
+else:
+  print("Error. Give me two arguments: the vector length N and the average segment length L.")
+  sys.exit()
+
+# Multiples of 1/64 in [-1, 1): every summation order is exact (for N up to
+# 2^18 in float32), and the extrema have many ties, to check that argmax and
+# argmin return the first one
+x_d = np.random.randint(-64, 64, N) / 64
+x_s = x_d.astype(np.float32)
+
+# Segments of 1 to 2L-1 elements
+lens = []
+while sum(lens) < N:
+  lens.append(min(np.random.randint(1, 2 * L), N - sum(lens)))
+off = np.concatenate(([0], np.cumsum(lens))).astype(np.uint32)
+head = np.zeros(N, dtype=np.uint8)
+head[off[:-1]] = 1
+seg_d = np.add.reduceat(x_d, off[:-1])
+seg_s = seg_d.astype(np.float32)
+
+print(".section .data,\"aw\",@progbits")
+emit("N", np.array(N, dtype=np.uint64))
+emit("NSEG", np.array(len(lens), dtype=np.uint64))
+emit("x_d", x_d, 'NR_LANES*4')
+emit("x_s", x_s, 'NR_LANES*4')
+emit("head", head, 'NR_LANES*4')
+emit("off", off, 'NR_LANES*4')
+emit("seg_d", seg_d, 'NR_LANES*4')
+emit("seg_s", seg_s, 'NR_LANES*4')
+emit("o_d", np.zeros(len(lens), dtype=np.float64), 'NR_LANES*4')
+emit("o_s", np.zeros(len(lens), dtype=np.float32), 'NR_LANES*4')
@@ -0,0 +1,145 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Microbenchmark of the vector slides. For every SEW and slide amount, it
+// reports the cycles per instruction of a chain of dependent slides (latency)
+// and of a sequence of independent slides of the same source (throughput), on
+// LMUL = 4 vectors of VLMAX elements. The slide unit slides by any amount in a
+// single pass, so the odd amounts used by fconv2d 7x7 and jacobi2d should cost
+// as much as the powers of two. Every slide is checked against the scalar
+// reference.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+#include "util.h"
+
+#ifndef SPIKE
+#include "printf.h"
+#else
+#include <stdio.h>
+#endif
+
+// Slides per measurement (multiple of 4)
+#define NR_SLIDES 16
+
+// An LMUL = 4 vector register group
+uint8_t src[VLEN / 2] __attribute__((aligned(4 * NR_LANES)));
+uint8_t dst[VLEN / 2] __attribute__((aligned(4 * NR_LANES)));
+
+int error = 0;
+
+void print_result(const char *name, int sew, uint64_t amt, int64_t lat,
+                  int64_t thr) {
+  printf("%-10s e%-2d amt = %3d: latency %f, throughput %f cycles/insn\n",
+         name, sew, amt, (float)lat / NR_SLIDES, (float)thr / NR_SLIDES);
+}
+
+// Time NR_SLIDES slides by amt of the SEW S, dependent and then independent,
+// and check the last one. vslidedown fills the top amt elements with zeros,
+// vslideup leaves the bottom amt elements undisturbed.
+#define DEFINE_BENCH(S, T, OP, DOWN)                                           \
+  void bench_##OP##_e##S(uint64_t amt) {                                       \
+    T *a = (T *)src, *b = (T *)dst;                                            \
+    uint64_t vl;                                                               \
+    asm volatile("vsetvli %0, zero, e" #S ", m4, ta, ma" : "=r"(vl));          \
+    for (uint64_t i = 0; i < vl; ++i) {                                        \
+      a[i] = (T)(i + 1);                                                       \
+      b[i] = 0;                                                                \
+    }                                                                          \
+    asm volatile("vle" #S ".v v4, (%0)" ::"r"(a));                             \
+    asm volatile("vle" #S ".v v8, (%0)" ::"r"(b));                             \
+    asm volatile("vle" #S ".v v24, (%0)" ::"r"(b));                            \
+                                                                               \
+    start_timer();                                                             \
+    for (int k = 0; k < NR_SLIDES / 2; ++k) {                                  \
+      asm volatile(#OP ".vx v12, v8, %0" ::"r"(amt));                          \
+      asm volatile(#OP ".vx v8, v12, %0" ::"r"(amt));                          \
+    }                                                                          \
+    stop_timer();                                                              \
+    int64_t lat = get_timer();                                                 \
+                                                                               \
+    start_timer();                                                             \
+    for (int k = 0; k < NR_SLIDES / 4; ++k) {                                  \
+      asm volatile(#OP ".vx v12, v4, %0" ::"r"(amt));                          \
+      asm volatile(#OP ".vx v16, v4, %0" ::"r"(amt));                          \
+      asm volatile(#OP ".vx v20, v4, %0" ::"r"(amt));                          \
+      asm volatile(#OP ".vx v24, v4, %0" ::"r"(amt));                          \
+    }                                                                          \
+    stop_timer();                                                              \
+    int64_t thr = get_timer();                                                 \
+                                                                               \
+    print_result(#OP, S, amt, lat, thr);                                       \
+                                                                               \
+    asm volatile("vse" #S ".v v24, (%0)" ::"r"(b));                            \
+    for (uint64_t i = 0; i < vl; ++i) {                                        \
+      T gold;                                                                  \
+      if (DOWN)                                                                \
+        gold = i + amt < vl ? a[i + amt] : 0;                                  \
+      else                                                                     \
+        gold = i < amt ? 0 : a[i - amt];                                       \
+      if (b[i] != gold) {                                                      \
+        printf("Error (" #OP " e%d, amt = %d): b[%d] = %d != %d\n", S, amt,   \
+               i, (int64_t)b[i], (int64_t)gold);                               \
+        error = 1;                                                             \
+        return;                                                                \
+      }                                                                        \
+    }                                                                          \
+  }
+
+DEFINE_BENCH(8, uint8_t, vslidedown, 1)
+DEFINE_BENCH(16, uint16_t, vslidedown, 1)
+DEFINE_BENCH(32, uint32_t, vslidedown, 1)
+DEFINE_BENCH(64, uint64_t, vslidedown, 1)
+DEFINE_BENCH(8, uint8_t, vslideup, 0)
+DEFINE_BENCH(16, uint16_t, vslideup, 0)
+DEFINE_BENCH(32, uint32_t, vslideup, 0)
+DEFINE_BENCH(64, uint64_t, vslideup, 0)
+
+int main() {
+  printf("\n");
+  printf("============\n");
+  printf("=  VSLIDE  =\n");
+  printf("============\n");
+  printf("\n");
+  printf("\n");
+
+  // Powers of two and not, within a VRF word and across VRF words
+  const uint64_t amts[] = {1, 2, 3, 4, 5, 6, 7, 8, NR_LANES + 1,
+                           8 * NR_LANES + 3};
+  const int nr_amts = sizeof(amts) / sizeof(amts[0]);
+
+  HW_CNT_READY;
+  for (int k = 0; k < nr_amts; ++k) {
+    bench_vslidedown_e8(amts[k]);
+    bench_vslidedown_e16(amts[k]);
+    bench_vslidedown_e32(amts[k]);
+    bench_vslidedown_e64(amts[k]);
+  }
+  for (int k = 0; k < nr_amts; ++k) {
+    bench_vslideup_e8(amts[k]);
+    bench_vslideup_e16(amts[k]);
+    bench_vslideup_e32(amts[k]);
+    bench_vslideup_e64(amts[k]);
+  }
+  HW_CNT_NOT_READY;
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+
+  return error;
+}
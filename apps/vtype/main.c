@@ -0,0 +1,230 @@
+// Copyright 2022 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Microbenchmark of the cost of alternating the vtype. Every iteration runs
+// an LMUL = 8 and an LMUL = 1 vfadd:
+// - with the same vtype (two LMUL = 8 vfadds), as a baseline;
+// - alternating the LMUL, on independent registers;
+// - alternating the LMUL, with the LMUL = 1 vfadd reading v17, which the
+//   LMUL = 8 vfadd writes as part of v16-v23.
+// Only the last case needs to wait for the LMUL = 8 vfadd to complete. The
+// same is measured on a dot product that reduces every strip and switches to
+// LMUL = 1 to accumulate the partial sums, against one that reduces only once
+// at the end. All the results are checked.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "runtime.h"
+#include "util.h"
+
+#ifndef SPIKE
+#include "printf.h"
+#else
+#include <stdio.h>
+#endif
+
+// Iterations of the vtype microbenchmark
+#define ITER 16
+// Dot product length
+#define N 2048
+
+double a[N] __attribute__((aligned(4 * NR_LANES)));
+double b[N] __attribute__((aligned(4 * NR_LANES)));
+// Result of the vfadds (LMUL = 1)
+double r[VLEN / 64] __attribute__((aligned(4 * NR_LANES)));
+
+int error = 0;
+
+void print_result(const char *name, int64_t runtime, int64_t n) {
+  printf("%-28s: %7d cycles (%f cycles/iter)\n", name, runtime,
+         (float)runtime / n);
+}
+
+// Check the first element of every vector register in r
+void check(const char *name, double gold) {
+  for (uint64_t i = 0; i < VLEN / 64; ++i)
+    if (r[i] != gold) {
+      printf("Error (%s): r[%d] = %f != %f\n", name, i, r[i], gold);
+      error = 1;
+      return;
+    }
+}
+
+// v16-v23 = 0, v24-v31 = 1, v1 = 0, v2 = 1
+void init_regs() {
+  double zero = 0, one = 1;
+  asm volatile("vsetvli t0, zero, e64, m8, ta, ma" ::: "t0");
+  asm volatile("vfmv.v.f v16, %0" ::"f"(zero));
+  asm volatile("vfmv.v.f v24, %0" ::"f"(one));
+  asm volatile("vsetvli t0, zero, e64, m1, ta, ma" ::: "t0");
+  asm volatile("vfmv.v.f v1, %0" ::"f"(zero));
+  asm volatile("vfmv.v.f v2, %0" ::"f"(one));
+}
+
+void bench_vtype() {
+  int64_t runtime;
+
+  // Same vtype: v16 += v24 and v8 += v24, both with LMUL = 8
+  init_regs();
+  asm volatile("vsetvli t0, zero, e64, m8, ta, ma" ::: "t0");
+  asm volatile("vmv.v.v v8, v16");
+  start_timer();
+  for (int k = 0; k < ITER; ++k) {
+    asm volatile("vfadd.vv v16, v16, v24");
+    asm volatile("vfadd.vv v8, v8, v24");
+  }
+  stop_timer();
+  runtime = get_timer();
+  print_result("same vtype", runtime, ITER);
+  asm volatile("vse64.v v8, (%0)" ::"r"(a));
+  if (a[0] != ITER) {
+    printf("Error (same vtype): %f != %f\n", a[0], (double)ITER);
+    error = 1;
+  }
+
+  // Alternating vtype, independent registers: v16 += v24, v1 += v2
+  init_regs();
+  start_timer();
+  for (int k = 0; k < ITER; ++k) {
+    asm volatile("vsetvli t0, zero, e64, m8, ta, ma" ::: "t0");
+    asm volatile("vfadd.vv v16, v16, v24");
+    asm volatile("vsetvli t0, zero, e64, m1, ta, ma" ::: "t0");
+    asm volatile("vfadd.vv v1, v1, v2");
+  }
+  stop_timer();
+  runtime = get_timer();
+  print_result("alternating, independent", runtime, ITER);
+  asm volatile("vse64.v v1, (%0)" ::"r"(r));
+  check("alternating, independent", ITER);
+
+  // Alternating vtype, v17 is written with LMUL = 8 and read with LMUL = 1:
+  // v1 += v17 sums 1, 2, ..., ITER
+  init_regs();
+  start_timer();
+  for (int k = 0; k < ITER; ++k) {
+    asm volatile("vsetvli t0, zero, e64, m8, ta, ma" ::: "t0");
+    asm volatile("vfadd.vv v16, v16, v24");
+    asm volatile("vsetvli t0, zero, e64, m1, ta, ma" ::: "t0");
+    asm volatile("vfadd.vv v1, v1, v17");
+  }
+  stop_timer();
+  runtime = get_timer();
+  print_result("alternating, dependent", runtime, ITER);
+  asm volatile("vse64.v v1, (%0)" ::"r"(r));
+  check("alternating, dependent", ITER * (ITER + 1) / 2);
+}
+
+// Dot product, reduced at every strip, and accumulated with LMUL = 1
+double dotp_strip(const double *x, const double *y, uint64_t n) {
+  double zero = 0, res;
+  asm volatile("vsetvli t0, zero, e64, m1, ta, ma" ::: "t0");
+  asm volatile("vfmv.v.f v2, %0" ::"f"(zero));
+  asm volatile("vfmv.v.f v3, %0" ::"f"(zero));
+  while (n > 0) {
+    uint64_t vl;
+    asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(n));
+    asm volatile("vle64.v v8, (%0)" ::"r"(x));
+    asm volatile("vle64.v v16, (%0)" ::"r"(y));
+    asm volatile("vfmul.vv v24, v8, v16");
+    asm volatile("vfredusum.vs v1, v24, v3");
+    asm volatile("vsetvli t0, zero, e64, m1, ta, ma" ::: "t0");
+    asm volatile("vfadd.vv v2, v2, v1");
+    x += vl;
+    y += vl;
+    n -= vl;
+  }
+  asm volatile("vfmv.f.s %0, v2" : "=f"(res));
+  return res;
+}
+
+// Dot product, accumulated with LMUL = 8 and reduced once at the end
+double dotp_acc(const double *x, const double *y, uint64_t n) {
+  double zero = 0, res;
+  uint64_t vlmax;
+  asm volatile("vsetvli %0, zero, e64, m8, ta, ma" : "=r"(vlmax));
+  asm volatile("vfmv.v.f v24, %0" ::"f"(zero));
+  while (n > 0) {
+    uint64_t vl;
+    // Keep the tail of the accumulator: tail undisturbed
+    asm volatile("vsetvli %0, %1, e64, m8, tu, ma" : "=r"(vl) : "r"(n));
+    asm volatile("vle64.v v8, (%0)" ::"r"(x));
+    asm volatile("vle64.v v16, (%0)" ::"r"(y));
+    asm volatile("vfmacc.vv v24, v8, v16");
+    x += vl;
+    y += vl;
+    n -= vl;
+  }
+  asm volatile("vsetvli zero, %0, e64, m8, ta, ma" ::"r"(vlmax));
+  asm volatile("vfmv.s.f v1, %0" ::"f"(zero));
+  asm volatile("vfredusum.vs v1, v24, v1");
+  asm volatile("vfmv.f.s %0, v1" : "=f"(res));
+  return res;
+}
+
+void bench_dotp() {
+  int64_t runtime;
+  double res, gold = 0;
+  uint64_t vlmax;
+
+  // Small integers: the sum is exact in any order
+  for (int i = 0; i < N; ++i) {
+    a[i] = (i % 7) - 3;
+    b[i] = (i % 5) - 2;
+    gold += a[i] * b[i];
+  }
+
+  asm volatile("vsetvli %0, zero, e64, m8, ta, ma" : "=r"(vlmax));
+
+  start_timer();
+  res = dotp_strip(a, b, N);
+  stop_timer();
+  runtime = get_timer();
+  print_result("dotp, reduce every strip", runtime, (N + vlmax - 1) / vlmax);
+  if (res != gold) {
+    printf("Error (dotp_strip): %f != %f\n", res, gold);
+    error = 1;
+  }
+
+  start_timer();
+  res = dotp_acc(a, b, N);
+  stop_timer();
+  runtime = get_timer();
+  print_result("dotp, reduce once", runtime, (N + vlmax - 1) / vlmax);
+  if (res != gold) {
+    printf("Error (dotp_acc): %f != %f\n", res, gold);
+    error = 1;
+  }
+}
+
+int main() {
+  printf("\n");
+  printf("===========\n");
+  printf("=  VTYPE  =\n");
+  printf("===========\n");
+  printf("\n");
+  printf("\n");
+
+  HW_CNT_READY;
+  bench_vtype();
+  bench_dotp();
+  HW_CNT_NOT_READY;
+
+  if (!error)
+    printf("Test result: PASS. No errors found.\n");
+
+  return error;
+}
@@ -23,3 +23,12 @@ nr_lanes ?= 16
 # Length of each vector register (in bits)
 # Constraints: VLEN > 128
 vlen ?= 16384
+
+# Number of vector instructions in flight (power of two, at least two)
+nr_vinsn ?= 8
+
+# Depth of the instruction queues of the ALU and MFPU, of the load/store unit,
+# and of the slide unit
+insn_queue_depth ?= 4
+vlsu_insn_queue_depth ?= 4
+sldu_insn_queue_depth ?= 2
@@ -25,7 +25,8 @@ package ara_pkg;
   localparam int unsigned MAXVL = VLEN; // SEW = EW8, LMUL = 8. VL = 8 * VLEN / 8 = VLEN.
 
   // Number of vector instructions that can run in parallel.
-  localparam int unsigned NrVInsn = 8;
+  // Set with the nr_vinsn parameter of the configuration.
+  localparam int unsigned NrVInsn = `ifdef NR_VINSN `NR_VINSN `else 8 `endif;
 
   // Maximum number of lanes that Ara can support.
   localparam int unsigned MaxNrLanes = 16;
@@ -45,6 +46,20 @@ package ara_pkg;
     FPExtSupportEnable  = 1'b1
   } fpext_support_e;
 
+  // Integer divider in the lanes
+  typedef enum logic [1:0] {
+    DivSerial     = 2'b00, // Iterative, one element at a time
+    DivPipe2Steps = 2'b01, // Pipelined, two radix-2 steps (quotient bits) per stage
+    DivPipe4Steps = 2'b10  // Pipelined, four radix-2 steps (quotient bits) per stage
+  } div_impl_e;
+
+  // Floating-point divide and square root in the lanes
+  typedef enum logic [1:0] {
+    FDivSqrtSerial     = 2'b00, // FPnew's iterative unit, one element at a time
+    FDivSqrtPipe2Steps = 2'b01, // Pipelined, two radix-2 steps (quotient bits) per stage
+    FDivSqrtPipe4Steps = 2'b10  // Pipelined, four radix-2 steps (quotient bits) per stage
+  } fdivsqrt_impl_e;
+
   // The three bits correspond to {RVVD, RVVF, RVVH}
   typedef enum logic [2:0] {
     FPUSupportNone             = 3'b000,
@@ -86,18 +101,23 @@ package ara_pkg;
   // Define the maximum FPU latency
   localparam int unsigned LatFMax = LatFCompEW64;
 
-  // Define the maximum instruction queue depth
-  localparam MaxVInsnQueueDepth = 4;
   // FUs instruction queue depth.
-  localparam int unsigned MfpuInsnQueueDepth = 4;
-  localparam int unsigned ValuInsnQueueDepth = 4;
-  localparam int unsigned VlduInsnQueueDepth = 4;
-  localparam int unsigned VstuInsnQueueDepth = 4;
-  localparam int unsigned VaddrgenInsnQueueDepth = 4;
-  localparam int unsigned SlduInsnQueueDepth = 2;
+  // Set with the insn_queue_depth, vlsu_insn_queue_depth, and sldu_insn_queue_depth parameters
+  // of the configuration.
+  localparam int unsigned MfpuInsnQueueDepth = `ifdef INSN_QUEUE_DEPTH `INSN_QUEUE_DEPTH `else 4 `endif;
+  localparam int unsigned ValuInsnQueueDepth = `ifdef INSN_QUEUE_DEPTH `INSN_QUEUE_DEPTH `else 4 `endif;
+  localparam int unsigned VlduInsnQueueDepth = `ifdef VLSU_INSN_QUEUE_DEPTH `VLSU_INSN_QUEUE_DEPTH `else 4 `endif;
+  localparam int unsigned VstuInsnQueueDepth = `ifdef VLSU_INSN_QUEUE_DEPTH `VLSU_INSN_QUEUE_DEPTH `else 4 `endif;
+  localparam int unsigned VaddrgenInsnQueueDepth = `ifdef VLSU_INSN_QUEUE_DEPTH `VLSU_INSN_QUEUE_DEPTH `else 4 `endif;
+  localparam int unsigned SlduInsnQueueDepth = `ifdef SLDU_INSN_QUEUE_DEPTH `SLDU_INSN_QUEUE_DEPTH `else 2 `endif;
   localparam int unsigned NoneInsnQueueDepth = 1;
   // Ara supports MaskuInsnQueueDepth = 1 only.
   localparam int unsigned MaskuInsnQueueDepth = 1;
+  // Define the maximum instruction queue depth
+  localparam int unsigned MaxVInsnQueueDepth =
+    ValuInsnQueueDepth > VlduInsnQueueDepth
+      ? (ValuInsnQueueDepth > SlduInsnQueueDepth ? ValuInsnQueueDepth : SlduInsnQueueDepth)
+      : (VlduInsnQueueDepth > SlduInsnQueueDepth ? VlduInsnQueueDepth : SlduInsnQueueDepth);
 
   ///////////////////
   //  Definitions  //
@@ -294,7 +314,9 @@ package ara_pkg;
     // 2nd scalar operand: stride for constant-strided vector load/stores, slide offset for vector
     // slides
     elen_t stride;
-    logic is_stride_np2;
+
+    // Fault-only-first load: a fault after the first element trims vl instead of trapping
+    logic fault_only_first;
 
     // Destination vector register
     logic [4:0] vd;
@@ -395,7 +417,9 @@ package ara_pkg;
 
     // 2nd scalar operand: stride for constant-strided vector load/stores
     elen_t stride;
-    logic is_stride_np2;
+
+    // Fault-only-first load: a fault after the first element trims vl instead of trapping
+    logic fault_only_first;
 
     // Destination vector register
     logic [4:0] vd;
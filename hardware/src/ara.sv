@@ -15,6 +15,10 @@ module ara import ara_pkg::*; #(
     parameter  fpext_support_e        FPExtSupport = FPExtSupportEnable,
     // Support for fixed-point data types
     parameter  fixpt_support_e        FixPtSupport = FixedPointEnable,
+    // Integer divider in the lanes
+    parameter  div_impl_e             DivImpl      = DivSerial,
+    // Floating-point divide and square root in the lanes
+    parameter  fdivsqrt_impl_e        FDivSqrtImpl = FDivSqrtSerial,
     // AXI Interface
     parameter  int           unsigned AxiDataWidth = 0,
     parameter  int           unsigned AxiAddrWidth = 0,
@@ -231,7 +235,9 @@ module ara import ara_pkg::*; #(
       .NrLanes     (NrLanes     ),
       .FPUSupport  (FPUSupport  ),
       .FPExtSupport(FPExtSupport),
-      .FixPtSupport(FixPtSupport)
+      .FixPtSupport(FixPtSupport),
+      .DivImpl     (DivImpl     ),
+      .FDivSqrtImpl(FDivSqrtImpl)
     ) i_lane (
       .clk_i                           (clk_i                               ),
       .rst_ni                          (rst_ni                              ),
@@ -466,6 +472,12 @@ module ara import ara_pkg::*; #(
   if (ara_pkg::VLEN != 2**$clog2(ara_pkg::VLEN))
     $error("[ara] The vector length must be a power of two.");
 
+  if (NrVInsn < 2 || NrVInsn != 2**$clog2(NrVInsn))
+    $error("[ara] The number of parallel vector instructions must be a power of two, at least two.");
+
+  if (ValuInsnQueueDepth == 0 || VlduInsnQueueDepth == 0 || SlduInsnQueueDepth == 0)
+    $error("[ara] The instruction queues must have at least one entry.");
+
   if (RVVD(FPUSupport) && !ariane_pkg::RVD)
     $error(
       "[ara] Cannot support double-precision floating-point on Ara if Ariane does not support it.");
@@ -128,7 +128,6 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
 
   // The backend can either be in normal operation, waiting for Ara to be idle before issuing new
   // operations, or injecting a reshuffling uop.
-  // IDLE can happen, for example, once the vlmul has changed.
   // RESHUFFLE can happen when an instruction writes a register with != EEW
   typedef enum logic [1:0] {
     NORMAL_OPERATION,
@@ -214,20 +213,6 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
   `FF(load_complete_q, load_complete_i, 1'b0)
   `FF(store_complete_q, store_complete_i, 1'b0)
 
-  // NP2 Slide support
-  logic is_stride_np2;
-  logic [idx_width(idx_width(VLENB << 3)):0] sldu_popc;
-
-  // Is the stride power of two?
-  popcount #(
-    .INPUT_WIDTH (idx_width(VLENB << 3))
-  ) i_np2_stride (
-    .data_i    (ara_req_d.stride[idx_width(VLENB << 3)-1:0]),
-    .popcount_o(sldu_popc                                  )
-  );
-
-  assign is_stride_np2 = sldu_popc > 1;
-
   ///////////////
   //  Decoder  //
   ///////////////
@@ -505,14 +490,9 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                 // Return the new vl
                 acc_resp_o.result = vl_d;
 
-                // If the vtype has changed, wait for the backend before issuing any new instructions.
-                // This is to avoid hazards on implicit register labels when LMUL_old > LMUL_new
-                // and both the LMULs are greater then LMUL_1 (i.e., lmul[2] == 1'b0)
-                // Checking only lmul_q is a trick: we want to stall only if both lmuls have
-                // zero MSB. If lmul_q has zero MSB, it's greater than lmul_d only if also
-                // lmul_d has zero MSB since the slice comparison is intrinsically unsigned
-                if (!vtype_q.vlmul[2] && (vtype_d.vlmul[2:0] < vtype_q.vlmul[2:0]))
-                  state_d = WAIT_IDLE;
+                // No need to wait for the backend if the LMUL shrinks: the sequencer tracks the
+                // register groups of the running instructions, and stalls only the instructions
+                // whose groups overlap the running ones on different registers
               end
 
               OPIVV: begin: opivv
@@ -741,7 +721,6 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                 ara_req_d.vd            = insn.varith_type.rd;
                 ara_req_d.use_vd        = 1'b1;
                 ara_req_d.vm            = insn.varith_type.vm;
-                ara_req_d.is_stride_np2 = is_stride_np2;
                 ara_req_valid_d         = 1'b1;
 
                 // Decode based on the func6 field
@@ -955,7 +934,6 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                 ara_req_d.vd            = insn.varith_type.rd;
                 ara_req_d.use_vd        = 1'b1;
                 ara_req_d.vm            = insn.varith_type.vm;
-                ara_req_d.is_stride_np2 = is_stride_np2;
                 ara_req_valid_d         = 1'b1;
 
                 // Decode based on the func6 field
@@ -1614,7 +1592,6 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                 ara_req_d.vd            = insn.varith_type.rd;
                 ara_req_d.use_vd        = 1'b1;
                 ara_req_d.vm            = insn.varith_type.vm;
-                ara_req_d.is_stride_np2 = is_stride_np2;
                 ara_req_valid_d         = 1'b1;
 
                 // Decode based on the func6 field
@@ -2265,7 +2242,6 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                   ara_req_d.vd            = insn.varith_type.rd;
                   ara_req_d.use_vd        = 1'b1;
                   ara_req_d.vm            = insn.varith_type.vm;
-                  ara_req_d.is_stride_np2 = is_stride_np2;
                   ara_req_d.fp_rm         = acc_req_i.frm;
                   ara_req_valid_d         = 1'b1;
 
@@ -2575,10 +2551,8 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
                     ara_req_d.vtype.vsew = EW8;
                   end
                   5'b10000: begin // Unit-strided, fault-only first
-                    // TODO: Not implemented
-                    illegal_insn     = 1'b1;
-                    acc_resp_o.req_ready  = 1'b1;
-                    acc_resp_o.resp_valid = 1'b1;
+                    // A fault after the first element trims vl (see the answer of the backend)
+                    ara_req_d.fault_only_first = 1'b1;
                   end
                   default: begin // Reserved
                     illegal_insn     = 1'b1;
@@ -2693,6 +2667,13 @@ module ara_dispatcher import ara_pkg::*; import rvv_pkg::*; #(
               // In case of error, modify vstart
               if (ara_resp_i.error)
                 vstart_d = ara_resp_i.error_vl;
+              // Fault-only-first loads trap only on the first element. Otherwise, vl is trimmed
+              // to the first faulting element.
+              if (ara_req_d.fault_only_first && ara_resp_i.error && ara_resp_i.error_vl != '0) begin
+                acc_resp_o.error = 1'b0;
+                vstart_d         = vstart_q;
+                vl_d             = ara_resp_i.error_vl;
+              end
             end
           end
 
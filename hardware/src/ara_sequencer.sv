@@ -146,6 +146,26 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
   vreg_access_t [31:0] read_list_d, read_list_q;
   vreg_access_t [31:0] write_list_d, write_list_q;
 
+  // The read and write lists are indexed by the first register of each register group, which
+  // is enough for chaining as long as the groups of two instructions start from the same
+  // register. After a vtype change, a group can also overlap another one that starts from a
+  // different register (e.g., v9 at LMUL 1 and v8-v15 at LMUL 8). Two such instructions cannot
+  // be chained, and the new one waits for the running one to complete. For this, we keep the
+  // register groups of the running instructions. An unused group has no registers.
+  typedef struct packed {
+    logic [4:0] vd;
+    logic [3:0] nr_vd;
+    logic [4:0] vs1;
+    logic [3:0] nr_vs1;
+    logic [4:0] vs2;
+    logic [3:0] nr_vs2;
+    logic       vm;
+  } vreg_groups_t;
+  vreg_groups_t [NrVInsn-1:0] vreg_groups_d, vreg_groups_q;
+  vreg_groups_t               vreg_groups_req;
+  // Running instructions that overlap the new one on a different register group
+  logic         [NrVInsn-1:0] group_hazard;
+
   pe_req_t pe_req_d;
   logic    pe_req_valid_d;
 
@@ -201,6 +221,62 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
     endcase
   endfunction : target_vfus
 
+  // Number of vector registers spanned by the first vl elements of EEW eew, at least one
+  function automatic logic [3:0] nr_vregs(vlen_t vl, rvv_pkg::vew_e eew);
+    automatic logic [$bits(vlen_t)+3:0] n = (({4'b0, vl} << eew) + VLENB - 1) >> $clog2(VLENB);
+    if (n == '0) return 4'd1;
+    if (n > 8)   return 4'd8;
+    return n[3:0];
+  endfunction : nr_vregs
+
+  // Number of vector registers of a register group with multiplier lmul
+  function automatic logic [3:0] lmul_vregs(rvv_pkg::vlmul_e lmul);
+    unique case (lmul)
+      LMUL_2 : return 4'd2;
+      LMUL_4 : return 4'd4;
+      LMUL_8 : return 4'd8;
+      default: return 4'd1;
+    endcase
+  endfunction : lmul_vregs
+
+  // Register groups read and written by a request. Mask operands, scalar operands of the
+  // reductions, and scalar results take one register.
+  function automatic vreg_groups_t vreg_groups(ara_req_t req);
+    automatic rvv_pkg::vew_e eew_vd = req.vtype.vsew;
+
+    // Widening instructions write vd with 2*SEW
+    if ($signed(req.emul) > $signed(req.vtype.vlmul))
+      eew_vd = rvv_pkg::vew_e'(req.vtype.vsew + 1);
+
+    vreg_groups = '{
+      vd    : req.vd,
+      nr_vd : req.use_vd ? nr_vregs(req.vl, eew_vd) : '0,
+      vs1   : req.vs1,
+      nr_vs1: req.use_vs1 ? nr_vregs(req.vl, req.eew_vs1) : '0,
+      vs2   : req.vs2,
+      nr_vs2: req.use_vs2 ? nr_vregs(req.vl, req.eew_vs2) : '0,
+      vm    : !req.vm
+    };
+
+    if (req.use_vd && req.op inside {[VREDSUM:VWREDSUM], [VFREDUSUM:VFWREDOSUM], [VMFEQ:VMSIF],
+        VMSGT, [VMADC:VMXNOR], VMVSX, VFMVSF})
+      vreg_groups.nr_vd = 4'd1;
+    if (req.use_vs1 && req.op inside {[VREDSUM:VWREDSUM], [VFREDUSUM:VFWREDOSUM], [VMANDNOT:VMXNOR]})
+      vreg_groups.nr_vs1 = 4'd1;
+    if (req.use_vs2 && req.op inside {[VMSBF:VFIRST], [VMANDNOT:VMXNOR], VMVXS, VFMVFS})
+      vreg_groups.nr_vs2 = 4'd1;
+    // vslidedown reads vs2 up to VLMAX, apart from the reshuffles (stride 0)
+    if (req.use_vs2 && req.op == VSLIDEDOWN && req.stride != '0)
+      vreg_groups.nr_vs2 = lmul_vregs(req.vtype.vlmul);
+  endfunction : vreg_groups
+
+  // Do the groups [a, a + na) and [b, b + nb) overlap, without starting from the same register?
+  function automatic logic vreg_misaligned(logic [4:0] a, logic [3:0] na, logic [4:0] b,
+                                           logic [3:0] nb);
+    return na != '0 && nb != '0 && a != b &&
+      ({1'b0, a} < {1'b0, b} + nb) && ({1'b0, b} < {1'b0, a} + na);
+  endfunction : vreg_misaligned
+
   localparam int unsigned InsnQueueDepth [NrVFUs] = '{
     ValuInsnQueueDepth,
     MfpuInsnQueueDepth,
@@ -214,8 +290,9 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
   logic ara_req_token_d, ara_req_token_q;
 
   // Counters keep track of how many instructions each unit is running.
-  // They have the same size only to keep the code easy.
-  logic [NrVFUs-1:0] [idx_width(MaxVInsnQueueDepth + 1)-1:0] insn_queue_cnt_q;
+  // They have the same size only to keep the code easy. With a gold ticket, a counter can
+  // reach its queue depth plus one.
+  logic [NrVFUs-1:0] [idx_width(MaxVInsnQueueDepth + 2)-1:0] insn_queue_cnt_q;
   logic [NrVFUs-1:0] insn_queue_done;
   logic [NrVFUs-1:0] insn_queue_cnt_en, insn_queue_cnt_down, insn_queue_cnt_up;
   // Each FU has its own ready signal
@@ -259,8 +336,12 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
     pe_vinsn_running_d    = pe_vinsn_running_q;
     read_list_d           = read_list_q;
     write_list_d          = write_list_q;
+    vreg_groups_d         = vreg_groups_q;
     global_hazard_table_d = global_hazard_table_o;
 
+    vreg_groups_req = '0;
+    group_hazard    = '0;
+
     // Maintain request
     pe_req_d       = '0;
     pe_req_valid_d = 1'b0;
@@ -323,47 +404,62 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
             if (ara_req_i.use_vd) pe_req_d.hazard_vd[write_list_d[ara_req_i.vd].vid] |=
               write_list_d[ara_req_i.vd].valid;
 
+            // RAW, WAR, and WAW between misaligned register groups
+            vreg_groups_req = vreg_groups(ara_req_i);
+            for (int unsigned id = 0; id < NrVInsn; id++)
+              if (vinsn_running_q[id]) begin
+                automatic vreg_groups_t g = vreg_groups_q[id];
+                group_hazard[id] =
+                  vreg_misaligned(vreg_groups_req.vs1, vreg_groups_req.nr_vs1, g.vd, g.nr_vd)   ||
+                  vreg_misaligned(vreg_groups_req.vs2, vreg_groups_req.nr_vs2, g.vd, g.nr_vd)   ||
+                  vreg_misaligned(VMASK, {3'b0, vreg_groups_req.vm}, g.vd, g.nr_vd)             ||
+                  vreg_misaligned(vreg_groups_req.vd, vreg_groups_req.nr_vd, g.vs1, g.nr_vs1)   ||
+                  vreg_misaligned(vreg_groups_req.vd, vreg_groups_req.nr_vd, g.vs2, g.nr_vs2)   ||
+                  vreg_misaligned(vreg_groups_req.vd, vreg_groups_req.nr_vd, VMASK, {3'b0, g.vm}) ||
+                  vreg_misaligned(vreg_groups_req.vd, vreg_groups_req.nr_vd, g.vd, g.nr_vd);
+              end
+
             /////////////
             //  Issue  //
             /////////////
 
             // Populate the PE request
             pe_req_d = '{
-              id            : vinsn_id_n,
-              op            : ara_req_i.op,
-              vm            : ara_req_i.vm,
-              eew_vmask     : ara_req_i.eew_vmask,
-              vfu           : vfu(ara_req_i.op),
-              vs1           : ara_req_i.vs1,
-              use_vs1       : ara_req_i.use_vs1,
-              conversion_vs1: ara_req_i.conversion_vs1,
-              eew_vs1       : ara_req_i.eew_vs1,
-              vs2           : ara_req_i.vs2,
-              use_vs2       : ara_req_i.use_vs2,
-              conversion_vs2: ara_req_i.conversion_vs2,
-              eew_vs2       : ara_req_i.eew_vs2,
-              use_vd_op     : ara_req_i.use_vd_op,
-              eew_vd_op     : ara_req_i.eew_vd_op,
-              scalar_op     : ara_req_i.scalar_op,
-              use_scalar_op : ara_req_i.use_scalar_op,
-              swap_vs2_vd_op: ara_req_i.swap_vs2_vd_op,
-              stride        : ara_req_i.stride,
-              is_stride_np2 : ara_req_i.is_stride_np2,
-              vd            : ara_req_i.vd,
-              use_vd        : ara_req_i.use_vd,
-              emul          : ara_req_i.emul,
-              fp_rm         : ara_req_i.fp_rm,
-              wide_fp_imm   : ara_req_i.wide_fp_imm,
-              cvt_resize    : ara_req_i.cvt_resize,
-              scale_vl      : ara_req_i.scale_vl,
-              vl            : ara_req_i.vl,
-              vstart        : ara_req_i.vstart,
-              vtype         : ara_req_i.vtype,
-              hazard_vd     : pe_req_d.hazard_vd,
-              hazard_vm     : pe_req_d.hazard_vm,
-              hazard_vs1    : pe_req_d.hazard_vs1,
-              hazard_vs2    : pe_req_d.hazard_vs2,
-              default       : '0
+              id              : vinsn_id_n,
+              op              : ara_req_i.op,
+              vm              : ara_req_i.vm,
+              eew_vmask       : ara_req_i.eew_vmask,
+              vfu             : vfu(ara_req_i.op),
+              vs1             : ara_req_i.vs1,
+              use_vs1         : ara_req_i.use_vs1,
+              conversion_vs1  : ara_req_i.conversion_vs1,
+              eew_vs1         : ara_req_i.eew_vs1,
+              vs2             : ara_req_i.vs2,
+              use_vs2         : ara_req_i.use_vs2,
+              conversion_vs2  : ara_req_i.conversion_vs2,
+              eew_vs2         : ara_req_i.eew_vs2,
+              use_vd_op       : ara_req_i.use_vd_op,
+              eew_vd_op       : ara_req_i.eew_vd_op,
+              scalar_op       : ara_req_i.scalar_op,
+              use_scalar_op   : ara_req_i.use_scalar_op,
+              swap_vs2_vd_op  : ara_req_i.swap_vs2_vd_op,
+              stride          : ara_req_i.stride,
+              fault_only_first: ara_req_i.fault_only_first,
+              vd              : ara_req_i.vd,
+              use_vd          : ara_req_i.use_vd,
+              emul            : ara_req_i.emul,
+              fp_rm           : ara_req_i.fp_rm,
+              wide_fp_imm     : ara_req_i.wide_fp_imm,
+              cvt_resize      : ara_req_i.cvt_resize,
+              scale_vl        : ara_req_i.scale_vl,
+              vl              : ara_req_i.vl,
+              vstart          : ara_req_i.vstart,
+              vtype           : ara_req_i.vtype,
+              hazard_vd       : pe_req_d.hazard_vd,
+              hazard_vm       : pe_req_d.hazard_vm,
+              hazard_vs1      : pe_req_d.hazard_vs1,
+              hazard_vs2      : pe_req_d.hazard_vs2,
+              default         : '0
             };
 
             // Populate the global hazard table
@@ -376,7 +472,9 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
             if (!(|{ara_req_i.use_vs1, ara_req_i.use_vs2, ara_req_i.use_vd_op, !ara_req_i.vm}) &&
                 |{pe_req_d.hazard_vs1, pe_req_d.hazard_vs2, pe_req_d.hazard_vm, pe_req_d.hazard_vd} ||
                 (pe_req_d.op == VSLIDEUP && |{pe_req_d.hazard_vd, pe_req_d.hazard_vs1, pe_req_d.hazard_vs2}) ||
-                (pe_req_d.op == VSLIDEDOWN && |{pe_req_d.hazard_vs1, pe_req_d.hazard_vs2}))
+                (pe_req_d.op == VSLIDEDOWN && |{pe_req_d.hazard_vs1, pe_req_d.hazard_vs2}) ||
+                // Misaligned register groups cannot be chained
+                |group_hazard)
             begin
               ara_req_ready_o = 1'b0;
               pe_req_valid_d  = 1'b0;
@@ -416,6 +514,9 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
               if (ara_req_i.use_vs1) read_list_d[ara_req_i.vs1] = '{vid: vinsn_id_n, valid: 1'b1};
               if (ara_req_i.use_vs2) read_list_d[ara_req_i.vs2] = '{vid: vinsn_id_n, valid: 1'b1};
               if (!ara_req_i.vm) read_list_d[VMASK]             = '{vid: vinsn_id_n, valid: 1'b1};
+
+              // Remember the register groups of this vector instruction
+              vreg_groups_d[vinsn_id_n] = vreg_groups_req;
             end
           end else ara_req_ready_o = 1'b0; // Wait until the PEs are ready
         end
@@ -462,8 +563,9 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
     if (!rst_ni) begin
       state_q <= IDLE;
 
-      read_list_q  <= '0;
-      write_list_q <= '0;
+      read_list_q   <= '0;
+      write_list_q  <= '0;
+      vreg_groups_q <= '0;
 
       pe_req_o       <= '0;
       pe_req_valid_o <= 1'b0;
@@ -477,8 +579,9 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
     end else begin
       state_q <= state_d;
 
-      read_list_q  <= read_list_d;
-      write_list_q <= write_list_d;
+      read_list_q   <= read_list_d;
+      write_list_q  <= write_list_d;
+      vreg_groups_q <= vreg_groups_d;
 
       pe_req_o       <= pe_req_d;
       pe_req_valid_o <= pe_req_valid_d;
@@ -542,7 +645,7 @@ module ara_sequencer import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg::i
   // One counter per VFU
   for (genvar i = 0; i < NrVFUs; i++) begin : gen_seq_fu_cnt
     // The width can be optimized for each counter
-    localparam CNT_WIDTH = idx_width(MaxVInsnQueueDepth + 1);
+    localparam CNT_WIDTH = idx_width(MaxVInsnQueueDepth + 2);
 
     counter #(
         .WIDTH           (CNT_WIDTH),
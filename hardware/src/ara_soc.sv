@@ -15,6 +15,12 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     parameter  fpext_support_e        FPExtSupport = FPExtSupportEnable,
     // Support for fixed-point data types
     parameter  fixpt_support_e        FixPtSupport = FixedPointEnable,
+    // Integer divider in the lanes
+    parameter  div_impl_e             DivImpl      = DivSerial,
+    // Floating-point divide and square root in the lanes
+    parameter  fdivsqrt_impl_e        FDivSqrtImpl = FDivSqrtSerial,
+    // Number of Ariane+Ara tiles, sharing the L2 memory
+    parameter  int           unsigned NrTiles      = 1,
     // AXI Interface
     parameter  int           unsigned AxiDataWidth = 32*NrLanes,
     parameter  int           unsigned AxiAddrWidth = 64,
@@ -59,7 +65,7 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   //  Memory Regions  //
   //////////////////////
 
-  localparam NrAXIMasters = 1; // Actually masters, but slaves on the crossbar
+  localparam NrAXIMasters = NrTiles; // Actually masters, but slaves on the crossbar
 
   typedef enum int unsigned {
     L2MEM = 0,
@@ -91,8 +97,9 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   localparam AxiWideDataWidth   = AxiDataWidth;
   localparam AXiWideStrbWidth   = AxiWideDataWidth / 8;
 
-  localparam AxiSocIdWidth  = AxiIdWidth - $clog2(NrAXIMasters);
-  localparam AxiCoreIdWidth = AxiSocIdWidth - 1;
+  // The crossbar extends the IDs of the tiles
+  localparam AxiSocIdWidth  = AxiIdWidth + $clog2(NrAXIMasters);
+  localparam AxiCoreIdWidth = AxiIdWidth - 1;
 
   // Internal types
   typedef logic [AxiNarrowDataWidth-1:0] axi_narrow_data_t;
@@ -111,11 +118,11 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   `AXI_LITE_TYPEDEF_ALL(soc_narrow_lite, axi_addr_t, axi_narrow_data_t, axi_narrow_strb_t)
 
   // Buses
-  system_req_t  system_axi_req_spill;
-  system_resp_t system_axi_resp_spill;
-  system_resp_t system_axi_resp_spill_del;
-  system_req_t  system_axi_req;
-  system_resp_t system_axi_resp;
+  system_req_t  [NrTiles-1:0] system_axi_req_spill;
+  system_resp_t [NrTiles-1:0] system_axi_resp_spill;
+  system_resp_t [NrTiles-1:0] system_axi_resp_spill_del;
+  system_req_t  [NrTiles-1:0] system_axi_req;
+  system_resp_t [NrTiles-1:0] system_axi_resp;
 
   soc_wide_req_t    [NrAXISlaves-1:0] periph_wide_axi_req;
   soc_wide_resp_t   [NrAXISlaves-1:0] periph_wide_axi_resp;
@@ -133,8 +140,8 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     MaxSlvTrans       : 4,
     FallThrough       : 1'b0,
     LatencyMode       : axi_pkg::CUT_MST_PORTS,
-    AxiIdWidthSlvPorts: AxiSocIdWidth,
-    AxiIdUsedSlvPorts : AxiSocIdWidth,
+    AxiIdWidthSlvPorts: AxiIdWidth,
+    AxiIdUsedSlvPorts : AxiIdWidth,
     UniqueIds         : 1'b0,
     AxiAddrWidth      : AxiAddrWidth,
     AxiDataWidth      : AxiWideDataWidth,
@@ -365,6 +372,20 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
 
   logic [63:0] event_trigger;
 
+  // Scalar/vector coherence
+  logic [NrTiles-1:0][63:0] inval_lines, inval_issued;
+  // Totals over all the tiles, exposed in the control registers
+  logic [63:0]              inval_lines_sum, inval_issued_sum;
+
+  always_comb begin: p_inval_sum
+    inval_lines_sum  = '0;
+    inval_issued_sum = '0;
+    for (int unsigned t = 0; t < NrTiles; t++) begin
+      inval_lines_sum  += inval_lines[t];
+      inval_issued_sum += inval_issued[t];
+    end
+  end: p_inval_sum
+
   axi_to_axi_lite #(
     .AxiAddrWidth   (AxiAddrWidth          ),
     .AxiDataWidth   (AxiNarrowDataWidth    ),
@@ -388,6 +409,7 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   );
 
   ctrl_registers #(
+    .NrTiles        (NrTiles               ),
     .DRAMBaseAddr   (DRAMBase              ),
     .DRAMLength     (DRAMLength            ),
     .DataWidth      (AxiNarrowDataWidth    ),
@@ -403,7 +425,9 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     .dram_base_addr_o     (/* Unused */                ),
     .dram_end_addr_o      (/* Unused */                ),
     .exit_o               (exit_o                      ),
-    .event_trigger_o      (event_trigger)
+    .event_trigger_o      (event_trigger),
+    .inval_lines_i        (inval_lines_sum             ),
+    .inval_issued_i       (inval_issued_sum            )
   );
 
   axi_dw_converter #(
@@ -436,10 +460,6 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   //  System  //
   //////////////
 
-  logic [2:0] hart_id;
-
-  assign hart_id = '0;
-
   localparam ariane_pkg::ariane_cfg_t ArianeAraConfig = '{
     RASDepth             : 2,
     BTBEntries           : 32,
@@ -464,80 +484,86 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
     NrPMPEntries         : 0
   };
 
+  // Every tile runs the same program, from its own hart ID
+  for (genvar t = 0; t < NrTiles; t++) begin: gen_tiles
 `ifndef TARGET_GATESIM
-  ara_system #(
-    .NrLanes           (NrLanes              ),
-    .FPUSupport        (FPUSupport           ),
-    .FPExtSupport      (FPExtSupport         ),
-    .FixPtSupport      (FixPtSupport         ),
-    .ArianeCfg         (ArianeAraConfig      ),
-    .AxiAddrWidth      (AxiAddrWidth         ),
-    .AxiIdWidth        (AxiCoreIdWidth       ),
-    .AxiNarrowDataWidth(AxiNarrowDataWidth   ),
-    .AxiWideDataWidth  (AxiDataWidth         ),
-    .ara_axi_ar_t      (ara_axi_ar_chan_t    ),
-    .ara_axi_aw_t      (ara_axi_aw_chan_t    ),
-    .ara_axi_b_t       (ara_axi_b_chan_t     ),
-    .ara_axi_r_t       (ara_axi_r_chan_t     ),
-    .ara_axi_w_t       (ara_axi_w_chan_t     ),
-    .ara_axi_req_t     (ara_axi_req_t        ),
-    .ara_axi_resp_t    (ara_axi_resp_t       ),
-    .ariane_axi_ar_t   (ariane_axi_ar_chan_t ),
-    .ariane_axi_aw_t   (ariane_axi_aw_chan_t ),
-    .ariane_axi_b_t    (ariane_axi_b_chan_t  ),
-    .ariane_axi_r_t    (ariane_axi_r_chan_t  ),
-    .ariane_axi_w_t    (ariane_axi_w_chan_t  ),
-    .ariane_axi_req_t  (ariane_axi_req_t     ),
-    .ariane_axi_resp_t (ariane_axi_resp_t    ),
-    .system_axi_ar_t   (system_ar_chan_t     ),
-    .system_axi_aw_t   (system_aw_chan_t     ),
-    .system_axi_b_t    (system_b_chan_t      ),
-    .system_axi_r_t    (system_r_chan_t      ),
-    .system_axi_w_t    (system_w_chan_t      ),
-    .system_axi_req_t  (system_req_t         ),
-    .system_axi_resp_t (system_resp_t        ))
+    ara_system #(
+      .NrLanes           (NrLanes              ),
+      .FPUSupport        (FPUSupport           ),
+      .FPExtSupport      (FPExtSupport         ),
+      .FixPtSupport      (FixPtSupport         ),
+      .DivImpl           (DivImpl              ),
+      .FDivSqrtImpl      (FDivSqrtImpl         ),
+      .ArianeCfg         (ArianeAraConfig      ),
+      .AxiAddrWidth      (AxiAddrWidth         ),
+      .AxiIdWidth        (AxiCoreIdWidth       ),
+      .AxiNarrowDataWidth(AxiNarrowDataWidth   ),
+      .AxiWideDataWidth  (AxiDataWidth         ),
+      .ara_axi_ar_t      (ara_axi_ar_chan_t    ),
+      .ara_axi_aw_t      (ara_axi_aw_chan_t    ),
+      .ara_axi_b_t       (ara_axi_b_chan_t     ),
+      .ara_axi_r_t       (ara_axi_r_chan_t     ),
+      .ara_axi_w_t       (ara_axi_w_chan_t     ),
+      .ara_axi_req_t     (ara_axi_req_t        ),
+      .ara_axi_resp_t    (ara_axi_resp_t       ),
+      .ariane_axi_ar_t   (ariane_axi_ar_chan_t ),
+      .ariane_axi_aw_t   (ariane_axi_aw_chan_t ),
+      .ariane_axi_b_t    (ariane_axi_b_chan_t  ),
+      .ariane_axi_r_t    (ariane_axi_r_chan_t  ),
+      .ariane_axi_w_t    (ariane_axi_w_chan_t  ),
+      .ariane_axi_req_t  (ariane_axi_req_t     ),
+      .ariane_axi_resp_t (ariane_axi_resp_t    ),
+      .system_axi_ar_t   (system_ar_chan_t     ),
+      .system_axi_aw_t   (system_aw_chan_t     ),
+      .system_axi_b_t    (system_b_chan_t      ),
+      .system_axi_r_t    (system_r_chan_t      ),
+      .system_axi_w_t    (system_w_chan_t      ),
+      .system_axi_req_t  (system_req_t         ),
+      .system_axi_resp_t (system_resp_t        ))
 `else
-  ara_system
+    ara_system
 `endif
-  i_system (
-    .clk_i        (clk_i                    ),
-    .rst_ni       (rst_ni                   ),
-    .boot_addr_i  (DRAMBase                 ), // start fetching from DRAM
-    .hart_id_i    (hart_id                  ),
-    .scan_enable_i(1'b0                     ),
-    .scan_data_i  (1'b0                     ),
-    .scan_data_o  (/* Unconnected */        ),
+    i_system (
+      .clk_i         (clk_i                       ),
+      .rst_ni        (rst_ni                      ),
+      .boot_addr_i   (DRAMBase                    ), // start fetching from DRAM
+      .hart_id_i     (3'(t)                       ),
+      .scan_enable_i (1'b0                        ),
+      .scan_data_i   (1'b0                        ),
+      .scan_data_o   (/* Unconnected */           ),
+      .inval_lines_o (inval_lines[t]              ),
+      .inval_issued_o(inval_issued[t]             ),
 `ifndef TARGET_GATESIM
-    .axi_req_o    (system_axi_req           ),
-    .axi_resp_i   (system_axi_resp          )
-  );
+      .axi_req_o     (system_axi_req[t]           ),
+      .axi_resp_i    (system_axi_resp[t]          )
+    );
 `else
-    .axi_req_o    (system_axi_req_spill     ),
-    .axi_resp_i   (system_axi_resp_spill_del)
-  );
+      .axi_req_o     (system_axi_req_spill[t]     ),
+      .axi_resp_i    (system_axi_resp_spill_del[t])
+    );
 `endif
 
-
 `ifdef TARGET_GATESIM
-  assign #(AxiRespDelay*1ps) system_axi_resp_spill_del = system_axi_resp_spill;
-
-  axi_cut #(
-    .ar_chan_t   (system_ar_chan_t     ),
-    .aw_chan_t   (system_aw_chan_t     ),
-    .b_chan_t    (system_b_chan_t      ),
-    .r_chan_t    (system_r_chan_t      ),
-    .w_chan_t    (system_w_chan_t      ),
-    .req_t       (system_req_t         ),
-    .resp_t      (system_resp_t        )
-  ) i_system_cut (
-    .clk_i       (clk_i),
-    .rst_ni      (rst_ni),
-    .slv_req_i   (system_axi_req_spill),
-    .slv_resp_o  (system_axi_resp_spill),
-    .mst_req_o   (system_axi_req),
-    .mst_resp_i  (system_axi_resp)
-  );
+    assign #(AxiRespDelay*1ps) system_axi_resp_spill_del[t] = system_axi_resp_spill[t];
+
+    axi_cut #(
+      .ar_chan_t   (system_ar_chan_t     ),
+      .aw_chan_t   (system_aw_chan_t     ),
+      .b_chan_t    (system_b_chan_t      ),
+      .r_chan_t    (system_r_chan_t      ),
+      .w_chan_t    (system_w_chan_t      ),
+      .req_t       (system_req_t         ),
+      .resp_t      (system_resp_t        )
+    ) i_system_cut (
+      .clk_i       (clk_i),
+      .rst_ni      (rst_ni),
+      .slv_req_i   (system_axi_req_spill[t]),
+      .slv_resp_o  (system_axi_resp_spill[t]),
+      .mst_req_o   (system_axi_req[t]),
+      .mst_resp_i  (system_axi_resp[t])
+    );
 `endif
+  end: gen_tiles
 
   //////////////////
   //  Assertions  //
@@ -552,6 +578,9 @@ module ara_soc import axi_pkg::*; import ara_pkg::*; #(
   if (AxiAddrWidth == 0)
     $error("[ara_soc] The AXI address width must be greater than zero.");
 
+  if (NrTiles == 0 || NrTiles > 8)
+    $error("[ara_soc] Ara's SoC supports between one and eight tiles.");
+
   if (AxiUserWidth == 0)
     $error("[ara_soc] The AXI user width must be greater than zero.");
 
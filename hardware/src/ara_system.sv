@@ -15,6 +15,10 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
     parameter fpext_support_e                   FPExtSupport       = FPExtSupportEnable,
     // Support for fixed-point data types
     parameter fixpt_support_e                   FixPtSupport       = FixedPointEnable,
+    // Integer divider in the lanes
+    parameter div_impl_e                        DivImpl            = DivSerial,
+    // Floating-point divide and square root in the lanes
+    parameter fdivsqrt_impl_e                   FDivSqrtImpl       = FDivSqrtSerial,
     // Ariane configuration
     parameter ariane_pkg::ariane_cfg_t          ArianeCfg          = ariane_pkg::ArianeDefaultConfig,
     // AXI Interface
@@ -52,6 +56,9 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
     input  logic                    scan_enable_i,
     input  logic                    scan_data_i,
     output logic                    scan_data_o,
+    // Scalar/vector coherence
+    output logic             [63:0] inval_lines_o,
+    output logic             [63:0] inval_issued_o,
     // AXI Interface
     output system_axi_req_t         axi_req_o,
     input  system_axi_resp_t        axi_resp_i
@@ -174,32 +181,46 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
     .mst_resp_i(ariane_axi_resp       )
   );
 
+  // The invalidation filter skips the regions that Ariane never read, tracking
+  // 256 regions of 1 KiB each
   axi_inval_filter #(
-    .MaxTxns    (4                              ),
-    .AddrWidth  (AxiAddrWidth                   ),
-    .L1LineWidth(ariane_pkg::DCACHE_LINE_WIDTH/8),
-    .aw_chan_t  (ara_axi_aw_t                   ),
-    .req_t      (ara_axi_req_t                  ),
-    .resp_t     (ara_axi_resp_t                 )
+    .MaxTxns          (4                              ),
+    .FilterRegions    (256                            ),
+    .FilterRegionWidth(1024                           ),
+    .AddrWidth        (AxiAddrWidth                   ),
+    .L1LineWidth      (ariane_pkg::DCACHE_LINE_WIDTH/8),
+    .aw_chan_t        (ara_axi_aw_t                   ),
+    .req_t            (ara_axi_req_t                  ),
+    .resp_t           (ara_axi_resp_t                 ),
+    .snoop_req_t      (ariane_axi_req_t               ),
+    .snoop_resp_t     (ariane_axi_resp_t              )
   ) i_axi_inval_filter (
-    .clk_i        (clk_i             ),
-    .rst_ni       (rst_ni            ),
+    .clk_i         (clk_i                 ),
+    .rst_ni        (rst_ni                ),
 `ifdef IDEAL_DISPATCHER
-    .en_i         (1'b0              ),
+    .en_i          (1'b0                  ),
 `else
-    .en_i         (acc_cons_en       ),
+    .en_i          (acc_cons_en           ),
 `endif
-    .slv_req_i    (ara_axi_req       ),
-    .slv_resp_o   (ara_axi_resp      ),
-    .mst_req_o    (ara_axi_req_inval ),
-    .mst_resp_i   (ara_axi_resp_inval),
-    .inval_addr_o (inval_addr        ),
-    .inval_valid_o(inval_valid       ),
+    .slv_req_i     (ara_axi_req           ),
+    .slv_resp_o    (ara_axi_resp          ),
+    .mst_req_o     (ara_axi_req_inval     ),
+    .mst_resp_i    (ara_axi_resp_inval    ),
 `ifdef IDEAL_DISPATCHER
-    .inval_ready_i(1'b0              )
+    .snoop_req_i   ('0                    ),
 `else
-    .inval_ready_i(inval_ready       )
+    .snoop_req_i   (ariane_narrow_axi_req ),
 `endif
+    .snoop_resp_i  (ariane_narrow_axi_resp),
+    .inval_addr_o  (inval_addr            ),
+    .inval_valid_o (inval_valid           ),
+`ifdef IDEAL_DISPATCHER
+    .inval_ready_i (1'b0                  ),
+`else
+    .inval_ready_i (inval_ready           ),
+`endif
+    .inval_lines_o (inval_lines_o         ),
+    .inval_issued_o(inval_issued_o        )
   );
 
   ara #(
@@ -207,6 +228,8 @@ module ara_system import axi_pkg::*; import ara_pkg::*; #(
     .FPUSupport  (FPUSupport      ),
     .FPExtSupport(FPExtSupport    ),
     .FixPtSupport(FixPtSupport    ),
+    .DivImpl     (DivImpl         ),
+    .FDivSqrtImpl(FDivSqrtImpl    ),
     .AxiDataWidth(AxiWideDataWidth),
     .AxiAddrWidth(AxiAddrWidth    ),
     .axi_ar_t    (ara_axi_ar_t    ),
@@ -6,16 +6,35 @@
 // Description:
 // Listens to AXI4 AW channel and issue single cacheline invalidations.
 // All other channels are passed through.
+//
+// To avoid paying for invalidations of lines that cannot be in the L1, the
+// filter also snoops the reads of the scalar core (snoop_req_i/snoop_resp_i):
+// - It tracks which regions of FilterRegionWidth bytes were ever read by the
+//   core, in a table of FilterRegions bits indexed by the region number modulo
+//   FilterRegions. Writes to regions that were never read skip the L1, one
+//   region per cycle. The table is conservative: aliasing only costs spurious
+//   invalidations. It is only cleared at reset, since the write-through L1
+//   cannot be emptied without invalidating it line by line.
+// - It drops an invalidation of the line it invalidated last, if the core did
+//   not read that line in the meantime, e.g., for strided stores.
+// Set FilterRegions to zero to disable the region table.
 
 module axi_inval_filter #(
     // Maximum number of AXI write bursts outstanding at the same time
-    parameter int  unsigned MaxTxns     = 32'd0,
+    parameter int  unsigned MaxTxns           = 32'd0,
+    // Number of regions tracked by the filter (power of two, 0 to disable)
+    parameter int  unsigned FilterRegions     = 32'd0,
+    // Size of a region tracked by the filter, in bytes (power of two)
+    parameter int  unsigned FilterRegionWidth = 32'd1024,
     // AXI Bus Types
-    parameter int  unsigned AddrWidth   = 32'd0,
-    parameter int  unsigned L1LineWidth = 32'd0,
-    parameter type          aw_chan_t   = logic,
-    parameter type          req_t       = logic,
-    parameter type          resp_t      = logic
+    parameter int  unsigned AddrWidth         = 32'd0,
+    parameter int  unsigned L1LineWidth       = 32'd0,
+    parameter type          aw_chan_t         = logic,
+    parameter type          req_t             = logic,
+    parameter type          resp_t            = logic,
+    // Scalar core's AXI Bus Types
+    parameter type          snoop_req_t       = logic,
+    parameter type          snoop_resp_t      = logic
   ) (
     input logic clk_i,
     input logic rst_ni,
@@ -29,10 +48,18 @@ module axi_inval_filter #(
     output req_t  mst_req_o,
     input  resp_t mst_resp_i,
 
+    // Scalar core's memory port (snooped)
+    input  snoop_req_t  snoop_req_i,
+    input  snoop_resp_t snoop_resp_i,
+
     // Output / Cache invalidation requests
     output logic [AddrWidth-1:0] inval_addr_o,
     output logic                 inval_valid_o,
-    input  logic                 inval_ready_i
+    input  logic                 inval_ready_i,
+
+    // Statistics
+    output logic [63:0]          inval_lines_o,  // Lines written while enabled
+    output logic [63:0]          inval_issued_o  // Invalidations sent to the L1
   );
 
   import cf_math_pkg::idx_width;
@@ -41,6 +68,9 @@ module axi_inval_filter #(
   `include "axi/typedef.svh"
   `include "common_cells/registers.svh"
 
+  localparam int unsigned LineOffBits   = idx_width(L1LineWidth);
+  localparam int unsigned RegionOffBits = idx_width(FilterRegionWidth);
+
   // AW FIFO
   logic     aw_fifo_full, aw_fifo_empty;
   logic     aw_fifo_push, aw_fifo_pop;
@@ -50,9 +80,11 @@ module axi_inval_filter #(
 
   // Invalidation requests
   logic [AddrWidth-1:0] inval_offset_d, inval_offset_q;
+  // Skip the current line, or the rest of the current region
+  logic                 skip_line, skip_region;
 
   assign inval_addr_o  = aw_fifo_data.addr + inval_offset_q;
-  assign inval_valid_o = ~aw_fifo_empty;
+  assign inval_valid_o = ~aw_fifo_empty & ~skip_line & ~skip_region;
 
   //////////////////
   // AXI Handling //
@@ -70,60 +102,145 @@ module axi_inval_filter #(
     end
   end
 
+  //////////////
+  // Snooping //
+  //////////////
+
+  // Scalar reads
+  logic                 snoop_ar, snoop_r_last;
+  logic [AddrWidth-1:0] snoop_addr;
+
+  assign snoop_ar     = snoop_req_i.ar_valid & snoop_resp_i.ar_ready;
+  assign snoop_r_last = snoop_resp_i.r_valid & snoop_req_i.r_ready & snoop_resp_i.r.last;
+  assign snoop_addr   = snoop_req_i.ar.addr;
+
+  // Outstanding scalar reads. A line whose refill is still in flight may land
+  // in the L1 after its invalidation.
+  logic [7:0] snoop_pending_d, snoop_pending_q;
+
+  assign snoop_pending_d = snoop_pending_q + snoop_ar - snoop_r_last;
+
+  // Last invalidated line
+  logic [AddrWidth-LineOffBits-1:0] last_line_d, last_line_q;
+  logic                             last_valid_d, last_valid_q;
+
+  assign skip_line = last_valid_q && (inval_addr_o[AddrWidth-1:LineOffBits] == last_line_q);
+
+  always_comb begin : last_line
+    last_line_d  = last_line_q;
+    last_valid_d = last_valid_q;
+
+    // The core read the line again
+    if (snoop_ar && snoop_addr[AddrWidth-1:LineOffBits] == last_line_q)
+      last_valid_d = 1'b0;
+
+    // Remember the line we just invalidated, unless the core might be refilling it
+    if (inval_valid_o && inval_ready_i) begin
+      last_line_d  = inval_addr_o[AddrWidth-1:LineOffBits];
+      last_valid_d = !snoop_ar && snoop_pending_q == '0;
+    end
+  end
+
+  // Regions read by the scalar core
+  if (FilterRegions > 0) begin: gen_region_filter
+    localparam int unsigned RegionIdxBits = idx_width(FilterRegions);
+
+    logic [FilterRegions-1:0] cached_d, cached_q;
+
+    // Also check the region of the read snooped in this cycle, which is not in cached_q yet
+    assign skip_region = !cached_d[inval_addr_o[RegionOffBits +: RegionIdxBits]];
+
+    always_comb begin : region_filter
+      cached_d = cached_q;
+      if (snoop_ar)
+        cached_d[snoop_addr[RegionOffBits +: RegionIdxBits]] = 1'b1;
+    end
+
+    `FF(cached_q, cached_d, '0)
+
+    if (FilterRegions != 2**RegionIdxBits)
+      $error("[axi_inval_filter] FilterRegions must be a power of two.");
+
+    if (FilterRegionWidth < L1LineWidth || FilterRegionWidth != 2**RegionOffBits)
+      $error("[axi_inval_filter] FilterRegionWidth must be a power of two, at least one L1 line.");
+  end: gen_region_filter else begin: gen_no_region_filter
+    assign skip_region = 1'b0;
+  end: gen_no_region_filter
+
   ///////////////////////
   // Invalidation FSM  //
   ///////////////////////
 
-  enum logic { Idle, Invalidating } state_d, state_q;
+  // Bytes of the current burst, and bytes until the next line/region
+  logic [AddrWidth-1:0] burst_bytes, step;
+  // Move on to the next line/region
+  logic                 advance;
+
+  assign burst_bytes = (aw_fifo_data.len + 1) << aw_fifo_data.size;
 
   always_comb begin : inval_fsm
     // Default assignments
-    state_d        = state_q;
     aw_fifo_pop    = 1'b0;
     inval_offset_d = inval_offset_q;
 
-    unique case (state_q)
-      // Ready for the next invalidation
-      Idle: begin
-        // We have a new AW
-        if (!aw_fifo_empty) begin
-          // Wait for the L1 to accept a new invalidation request
-          if (inval_ready_i) begin
-            // Continue if we are not done yet
-            // If the addr is misaligned wrt the cache line, we should invalidate one line more
-            if ((L1LineWidth - aw_fifo_data.addr[idx_width(L1LineWidth)-1:0]) < ((aw_fifo_data.len + 1) << aw_fifo_data.size)) begin
-              state_d        = Invalidating;
-              inval_offset_d = L1LineWidth - aw_fifo_data.addr[idx_width(L1LineWidth)-1:0];
-            end else begin
-              aw_fifo_pop = 1'b1;
-            end
-          end
-        end
-      end
+    // If the addr is misaligned wrt the cache line (region), the first step is shorter
+    step = skip_region
+         ? AddrWidth'(FilterRegionWidth - inval_addr_o[RegionOffBits-1:0])
+         : AddrWidth'(L1LineWidth - inval_addr_o[LineOffBits-1:0]);
 
-      // Issue incrementing invalidation requests
-      Invalidating: begin
-        // Wait for the L1 to accept a new invalidation request
-        if (inval_ready_i) begin
-          inval_offset_d = inval_offset_q + L1LineWidth;
-          // Are we done?
-          if (inval_offset_d >= ((aw_fifo_data.len + 1) << aw_fifo_data.size)) begin
-            state_d        = Idle;
-            inval_offset_d = '0;
-            aw_fifo_pop    = 1'b1;
-          end
-        end
+    // Wait for the L1 to accept the invalidation request, or skip it
+    advance = !aw_fifo_empty && (inval_ready_i || skip_line || skip_region);
+    if (advance) begin
+      inval_offset_d = inval_offset_q + step;
+      // Are we done?
+      if (inval_offset_d >= burst_bytes) begin
+        inval_offset_d = '0;
+        aw_fifo_pop    = 1'b1;
       end
-    endcase
+    end
   end
 
+  ////////////////
+  // Statistics //
+  ////////////////
+
+  logic [63:0] inval_lines_d, inval_lines_q;
+  logic [63:0] inval_issued_d, inval_issued_q;
+
+  // Lines covered by this step
+  logic [AddrWidth-1:0] step_last;
+
+  always_comb begin : stats
+    inval_lines_d  = inval_lines_q;
+    inval_issued_d = inval_issued_q;
+
+    step_last = inval_addr_o + (aw_fifo_pop ? burst_bytes - inval_offset_q : step) - 1;
+
+    if (advance)
+      inval_lines_d = inval_lines_q + 64'(step_last[AddrWidth-1:LineOffBits] -
+        inval_addr_o[AddrWidth-1:LineOffBits]) + 1;
+    if (inval_valid_o && inval_ready_i)
+      inval_issued_d = inval_issued_q + 1;
+  end
+
+  assign inval_lines_o  = inval_lines_q;
+  assign inval_issued_o = inval_issued_q;
+
   always_ff @(posedge clk_i or negedge rst_ni) begin
     if (!rst_ni) begin
-      state_q        <= Idle;
-      inval_offset_q <= '0;
+      inval_offset_q  <= '0;
+      snoop_pending_q <= '0;
+      last_line_q     <= '0;
+      last_valid_q    <= 1'b0;
+      inval_lines_q   <= '0;
+      inval_issued_q  <= '0;
     end else begin
-      state_q        <= state_d;
-      inval_offset_q <= inval_offset_d;
+      inval_offset_q  <= inval_offset_d;
+      snoop_pending_q <= snoop_pending_d;
+      last_line_q     <= last_line_d;
+      last_valid_q    <= last_valid_d;
+      inval_lines_q   <= inval_lines_d;
+      inval_issued_q  <= inval_issued_d;
     end
   end
 
@@ -12,6 +12,8 @@ module ctrl_registers #(
     // Parameters
     parameter logic          [DataWidth-1:0] DRAMBaseAddr    = 0,
     parameter logic          [DataWidth-1:0] DRAMLength      = 0,
+    // Number of Ariane+Ara tiles
+    parameter int   unsigned                 NrTiles         = 1,
     // AXI Structs
     parameter type                           axi_lite_req_t  = logic,
     parameter type                           axi_lite_resp_t = logic
@@ -26,7 +28,10 @@ module ctrl_registers #(
     output logic           [DataWidth-1:0] dram_base_addr_o,
     output logic           [DataWidth-1:0] dram_end_addr_o,
     output logic           [DataWidth-1:0] event_trigger_o,
-    output logic           [DataWidth-1:0] hw_cnt_en_o
+    output logic           [DataWidth-1:0] hw_cnt_en_o,
+    // Scalar/vector coherence
+    input  logic           [DataWidth-1:0] inval_lines_i,
+    input  logic           [DataWidth-1:0] inval_issued_i
   );
 
   `include "common_cells/registers.svh"
@@ -35,7 +40,7 @@ module ctrl_registers #(
   //  Definitions  //
   ///////////////////
 
-  localparam int unsigned NumRegs          = 5;
+  localparam int unsigned NumRegs          = 8 + NrTiles;
   localparam int unsigned DataWidthInBytes = (DataWidth + 7) / 8;
   localparam int unsigned RegNumBytes      = NumRegs * DataWidthInBytes;
 
@@ -43,19 +48,31 @@ module ctrl_registers #(
   localparam logic [DataWidthInBytes-1:0] ReadWriteReg = {DataWidthInBytes{1'b0}};
 
   // Memory map
+  // [64+:8]: sync           (rw, one register per tile)
+  // [63:56]: nr_tiles       (ro)
+  // [55:48]: inval_issued   (ro, sum over the tiles)
+  // [47:40]: inval_lines    (ro, sum over the tiles)
   // [39:32]: hw_cnt_en      (rw)
   // [25:31]: event_trigger  (rw)
   // [23:16]: dram_end_addr  (ro)
   // [15:8]:  dram_base_addr (ro)
   // [7:0]:   exit           (rw)
-  localparam logic [NumRegs-1:0][DataWidth-1:0] RegRstVal = '{
-    0,
-    0,
-    DRAMBaseAddr + DRAMLength,
-    DRAMBaseAddr,
-    0
+  localparam logic [NumRegs-1:0][DataWidth-1:0] RegRstVal = {
+    {NrTiles{DataWidth'(0)}},
+    DataWidth'(NrTiles),
+    DataWidth'(0),
+    DataWidth'(0),
+    DataWidth'(0),
+    DataWidth'(0),
+    DataWidth'(DRAMBaseAddr + DRAMLength),
+    DataWidth'(DRAMBaseAddr),
+    DataWidth'(0)
   };
-  localparam logic [NumRegs-1:0][DataWidthInBytes-1:0] AxiReadOnly = '{
+  localparam logic [NumRegs-1:0][DataWidthInBytes-1:0] AxiReadOnly = {
+    {NrTiles{ReadWriteReg}},
+    ReadOnlyReg,
+    ReadOnlyReg,
+    ReadOnlyReg,
     ReadWriteReg,
     ReadWriteReg,
     ReadOnlyReg,
@@ -69,6 +86,10 @@ module ctrl_registers #(
 
   logic [RegNumBytes-1:0] wr_active_d, wr_active_q;
 
+  logic [NrTiles-1:0][DataWidth-1:0] sync;
+  logic [DataWidth-1:0] nr_tiles;
+  logic [DataWidth-1:0] inval_issued;
+  logic [DataWidth-1:0] inval_lines;
   logic [DataWidth-1:0] hw_cnt_en;
   logic [DataWidth-1:0] event_trigger;
   logic [DataWidth-1:0] dram_base_address;
@@ -90,13 +111,27 @@ module ctrl_registers #(
     .axi_resp_o (axi_lite_slave_resp_o                      ),
     .wr_active_o(wr_active_d                                ),
     .rd_active_o(/* Unused */                               ),
-    .reg_d_i    ('0                                         ),
-    .reg_load_i ('0                                         ),
-    .reg_q_o    ({hw_cnt_en, event_trigger, dram_end_address, dram_base_address, exit})
+    .reg_d_i    (reg_d                                      ),
+    .reg_load_i (reg_load                                   ),
+    .reg_q_o    ({sync, nr_tiles, inval_issued, inval_lines, hw_cnt_en, event_trigger, dram_end_address, dram_base_address, exit})
   );
 
   `FF(wr_active_q, wr_active_d, '0);
 
+  // The coherence statistics are updated every cycle. The sync registers are
+  // only written by the software barrier of the tiles.
+  logic [NumRegs-1:0][DataWidth-1:0]        reg_d;
+  logic [NumRegs-1:0][DataWidthInBytes-1:0] reg_load;
+
+  always_comb begin : stats
+    reg_d       = '0;
+    reg_load    = '0;
+    reg_d[5]    = inval_lines_i;
+    reg_load[5] = '1;
+    reg_d[6]    = inval_issued_i;
+    reg_load[6] = '1;
+  end
+
   /////////////////
   //   Signals   //
   /////////////////
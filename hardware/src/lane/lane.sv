@@ -17,6 +17,10 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     parameter  fpext_support_e        FPExtSupport    = FPExtSupportEnable,
     // Support for fixed-point data types
     parameter  fixpt_support_e        FixPtSupport    = FixedPointEnable,
+    // Integer divider
+    parameter  div_impl_e             DivImpl         = DivSerial,
+    // Floating-point divide and square root
+    parameter  fdivsqrt_impl_e        FDivSqrtImpl    = FDivSqrtSerial,
     // Dependant parameters. DO NOT CHANGE!
     // VRF Parameters
     localparam int           unsigned MaxVLenPerLane  = VLEN / NrLanes,       // In bits
@@ -358,6 +362,8 @@ module lane import ara_pkg::*; import rvv_pkg::*; #(
     .FPUSupport  (FPUSupport  ),
     .FPExtSupport(FPExtSupport),
     .FixPtSupport(FixPtSupport),
+    .DivImpl     (DivImpl     ),
+    .FDivSqrtImpl(FDivSqrtImpl),
     .vaddr_t     (vaddr_t     )
   ) i_vfus (
     .clk_i                (clk_i                                  ),
@@ -0,0 +1,161 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Ara's pipelined SIMD Divider, operating on elements 64-bit wide.
+// It divides all the ElementWidth elements of a 64-bit word in parallel, with a radix-2
+// restoring division. Each pipeline stage chains StepsPerStage radix-2 steps, i.e., it retires
+// StepsPerStage quotient bits; this is not a higher-radix recurrence. The first stage takes the
+// magnitudes of the operands, and the output fixes the signs. Once the pipeline is full, the
+// unit can generate 64 bits per cycle.
+//
+// Cost: the critical path of a stage is StepsPerStage chained (ElemBits+1)-bit subtractions,
+// so it grows linearly with StepsPerStage. Each of the ElemBits/StepsPerStage stages registers
+// the full-width remainder, quotient, and divisor, i.e., about 3x64 flip-flops per stage: with
+// two steps per stage, the EW64 divider alone has 32 stages, about 6 kbit of registers.
+
+module simd_div_pipe import ara_pkg::*; import rvv_pkg::*; #(
+    // Quotient bits retired by each pipeline stage
+    parameter  int   unsigned StepsPerStage = 2,
+    parameter  vew_e          ElementWidth  = EW64,
+    // Dependant parameters. DO NOT CHANGE!
+    localparam int   unsigned DataWidth     = $bits(elen_t),
+    localparam int   unsigned StrbWidth     = DataWidth/8,
+    localparam type           strb_t        = logic [DataWidth/8-1:0],
+    localparam int   unsigned ElemBits      = 8 << ElementWidth,
+    localparam int   unsigned NrElems       = DataWidth / ElemBits,
+    localparam int   unsigned NumStages     = ElemBits / StepsPerStage
+  ) (
+    input  logic    clk_i,
+    input  logic    rst_ni,
+    input  elen_t   operand_a_i,
+    input  elen_t   operand_b_i,
+    input  strb_t   mask_i,
+    input  ara_op_e op_i,
+    input  strb_t   be_i,
+    output elen_t   result_o,
+    output strb_t   mask_o,
+    input  logic    valid_i,
+    output logic    ready_o,
+    input  logic    ready_i,
+    output logic    valid_o
+  );
+
+`include "common_cells/registers.svh"
+
+  ///////////////////
+  //  Definitions  //
+  ///////////////////
+
+  typedef logic [ElemBits-1:0] elem_t;
+  typedef logic [NrElems-1:0]  flags_t;
+
+  typedef struct packed {
+    elem_t [NrElems-1:0] rem;    // Partial remainders
+    elem_t [NrElems-1:0] quo;    // Dividends, shifted out while the quotient is shifted in
+    elem_t [NrElems-1:0] div;    // Divisors
+    flags_t              neg_q;  // Negate the quotient
+    flags_t              neg_r;  // Negate the remainder
+    flags_t              en;     // Valid elements. The others are short-circuited to zero.
+    logic                rem_op; // Return the remainder
+    strb_t               mask;
+  } div_payload_t;
+
+  ///////////////////////
+  //  Pipeline stages  //
+  ///////////////////////
+
+  // Input signals for the next stage (= output signals of the previous stage)
+  div_payload_t [NumStages:0] payload_d, payload_q;
+  logic         [NumStages:0] valid_d, valid_q;
+  // Ready signal is combinatorial for all stages
+  logic         [NumStages+1:0] stage_ready;
+
+  // Input stage: divide the magnitudes of the operands
+  div_payload_t in_payload;
+
+  always_comb begin : p_div_in
+    automatic logic is_signed = op_i inside {VDIV, VREM};
+
+    in_payload        = '0;
+    in_payload.rem_op = op_i inside {VREMU, VREM};
+    in_payload.mask   = mask_i;
+    for (int e = 0; e < NrElems; e++) begin
+      automatic elem_t a     = operand_a_i[ElemBits*e +: ElemBits];
+      automatic elem_t b     = operand_b_i[ElemBits*e +: ElemBits];
+      automatic logic  neg_a = is_signed && a[ElemBits-1];
+      automatic logic  neg_b = is_signed && b[ElemBits-1];
+
+      in_payload.quo[e]   = neg_a ? -a : a;
+      in_payload.div[e]   = neg_b ? -b : b;
+      // Dividing by zero returns all ones and the dividend, i.e., the quotient keeps its sign.
+      // The overflow (most negative / -1) needs no special care: the unsigned quotient of the
+      // magnitudes is already the most negative number.
+      in_payload.neg_q[e] = (neg_a ^ neg_b) && (b != '0);
+      in_payload.neg_r[e] = neg_a;
+      in_payload.en[e]    = be_i[e * ElemBits/8];
+    end
+  end : p_div_in
+
+  assign payload_d[0] = in_payload;
+  assign valid_d[0]   = valid_i;
+
+  // Restoring division: every step shifts the next dividend bit into the partial remainder,
+  // and subtracts the divisor if it fits
+  for (genvar s = 0; s < NumStages; s++) begin : gen_div_stages
+    div_payload_t stage_res;
+
+    always_comb begin : p_div_stage
+      stage_res = payload_q[s];
+      for (int e = 0; e < NrElems; e++)
+        for (int k = 0; k < StepsPerStage; k++) begin
+          // The shifted partial remainder needs one more bit than the element
+          automatic logic [ElemBits:0] rem_sh = {stage_res.rem[e], stage_res.quo[e][ElemBits-1]};
+          automatic logic [ElemBits:0] diff   = rem_sh - {1'b0, stage_res.div[e]};
+
+          stage_res.rem[e] = diff[ElemBits] ? rem_sh[ElemBits-1:0] : diff[ElemBits-1:0];
+          stage_res.quo[e] = {stage_res.quo[e][ElemBits-2:0], ~diff[ElemBits]};
+        end
+    end : p_div_stage
+
+    assign payload_d[s+1] = stage_res;
+    assign valid_d[s+1]   = valid_q[s];
+  end : gen_div_stages
+
+  for (genvar i = 0; i <= NumStages; i++) begin : gen_pipeline_regs
+    // Determine the ready signal of the current stage - advance the pipeline:
+    // 1. if the next stage is ready for our data
+    // 2. if the next stage register only holds a bubble (not valid) -> we can pop it
+    assign stage_ready[i] = stage_ready[i+1] | ~valid_q[i];
+
+    `FFL(valid_q[i], valid_d[i], stage_ready[i], 1'b0)
+    `FFL(payload_q[i], payload_d[i], stage_ready[i] && valid_d[i], '0)
+  end : gen_pipeline_regs
+
+  // Input stage: Propagate ready signal from pipeline
+  assign ready_o = stage_ready[0];
+
+  // Output stage: Ready travels backwards from output side
+  assign stage_ready[NumStages+1] = ready_i;
+  assign valid_o                  = valid_q[NumStages];
+  assign mask_o                   = payload_q[NumStages].mask;
+
+  // Output stage: select the quotient or the remainder, and fix its sign
+  always_comb begin : p_div_out
+    for (int e = 0; e < NrElems; e++) begin
+      automatic elem_t res = payload_q[NumStages].rem_op ?
+        payload_q[NumStages].rem[e] : payload_q[NumStages].quo[e];
+      automatic logic  neg = payload_q[NumStages].rem_op ?
+        payload_q[NumStages].neg_r[e] : payload_q[NumStages].neg_q[e];
+
+      result_o[ElemBits*e +: ElemBits] = !payload_q[NumStages].en[e] ? '0 :
+                                         neg                         ? -res :
+                                                                       res;
+    end
+  end : p_div_out
+
+  if (ElemBits % StepsPerStage != 0)
+    $error("[simd_div_pipe] StepsPerStage must divide the element width.");
+
+endmodule : simd_div_pipe
@@ -0,0 +1,345 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+//
+// Description:
+// Ara's pipelined SIMD floating-point divide and square root unit, operating on elements 64-bit
+// wide. It computes all the ElementWidth elements (FP16, FP32, or FP64) of a 64-bit word in
+// parallel, with a radix-2 restoring digit recurrence. Each pipeline stage chains StepsPerStage
+// radix-2 steps, i.e., it retires StepsPerStage quotient (or root) bits; this is not a
+// higher-radix recurrence. The first stage classifies and normalizes the operands, and the
+// output rounds the result according to the IEEE 754 rules, with tininess detected after
+// rounding. Once the pipeline is full, the unit can generate 64 bits per cycle.
+//
+// Cost: the critical path of a stage is StepsPerStage chained (RemBits+1)-bit subtractions,
+// so it grows linearly with StepsPerStage. Each stage registers the partial remainder, the
+// quotient, and the divisor (or radicand), which are wider than the significand: with two steps
+// per stage, the FP64 unit has 28 stages of about 250 flip-flops each, about 7 kbit.
+
+module simd_fdivsqrt_pipe import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*; #(
+    // Quotient bits retired by each pipeline stage
+    parameter  int   unsigned StepsPerStage = 2,
+    // EW16, EW32, or EW64
+    parameter  vew_e          ElementWidth  = EW64,
+    // Dependant parameters. DO NOT CHANGE!
+    localparam int   unsigned DataWidth     = $bits(elen_t),
+    localparam int   unsigned StrbWidth     = DataWidth/8,
+    localparam type           strb_t        = logic [DataWidth/8-1:0],
+    localparam int   unsigned ElemBits      = 8 << ElementWidth,
+    localparam int   unsigned NrElems       = DataWidth / ElemBits,
+    localparam int   unsigned ExpBits       = ElementWidth == EW64 ? 11 :
+                                              ElementWidth == EW32 ? 8  : 5,
+    localparam int   unsigned ManBits       = ElemBits - ExpBits - 1,
+    // The quotient needs the integer bit, the mantissa, and the round bit, plus one bit when it
+    // is smaller than one
+    localparam int   unsigned NumStages     = (ManBits + 3 + StepsPerStage - 1) / StepsPerStage,
+    localparam int   unsigned NumSteps      = NumStages * StepsPerStage
+  ) (
+    input  logic       clk_i,
+    input  logic       rst_ni,
+    // Dividend, or square root operand
+    input  elen_t      operand_a_i,
+    // Divisor
+    input  elen_t      operand_b_i,
+    input  strb_t      mask_i,
+    input  ara_op_e    op_i,
+    input  roundmode_e rm_i,
+    input  strb_t      be_i,
+    output elen_t      result_o,
+    output status_t    status_o,
+    output strb_t      mask_o,
+    input  logic       valid_i,
+    output logic       ready_o,
+    input  logic       ready_i,
+    output logic       valid_o
+  );
+
+`include "common_cells/registers.svh"
+
+  ///////////////////
+  //  Definitions  //
+  ///////////////////
+
+  localparam int unsigned RemBits = NumSteps + 3;
+  localparam int unsigned ExpW    = ExpBits + 3;
+  localparam int unsigned Bias    = 2**(ExpBits-1) - 1;
+
+  typedef logic        [ElemBits-1:0]   elem_t;
+  typedef logic        [ManBits:0]      sig_t;
+  typedef logic        [NumSteps-1:0]   quo_t;
+  typedef logic        [RemBits-1:0]    rem_t;
+  typedef logic        [2*NumSteps-1:0] opnd_t;
+  typedef logic signed [ExpW-1:0]       exp_t;
+
+  localparam exp_t MaxExp = exp_t'(2**ExpBits - 1);
+
+  // Results that do not come from the recurrence
+  typedef enum logic [1:0] {
+    ResFinite,
+    ResZero,
+    ResInf,
+    ResNaN
+  } res_class_e;
+
+  typedef struct packed {
+    rem_t                 rem;   // Partial remainder
+    quo_t                 quo;   // Quotient, or root
+    // Divisor significand, or the radicand bits still to be shifted in
+    opnd_t                opnd;
+    exp_t                 exp;   // Biased exponent of the result
+    logic                 sign;
+    res_class_e           cls;
+    logic                 nv;
+    logic                 dz;
+    logic                 en;    // Valid element. The others are short-circuited to zero.
+  } fdiv_elem_t;
+
+  typedef struct packed {
+    fdiv_elem_t [NrElems-1:0] elem;
+    logic                     sqrt;
+    roundmode_e               rm;
+    strb_t                    mask;
+  } fdiv_payload_t;
+
+  // Unpacked operand, with the significand normalized also for subnormal numbers
+  typedef struct packed {
+    logic sign;
+    exp_t exp;
+    sig_t sig;
+    logic zero;
+    logic inf;
+    logic nan;
+    logic snan;
+  } fp_unpacked_t;
+
+  function automatic fp_unpacked_t unpack(elem_t x);
+    automatic logic [ExpBits-1:0] e = x[ElemBits-2 -: ExpBits];
+    automatic logic [ManBits-1:0] f = x[ManBits-1:0];
+
+    unpack.sign = x[ElemBits-1];
+    unpack.zero = e == '0 && f == '0;
+    unpack.inf  = e == '1 && f == '0;
+    unpack.nan  = e == '1 && f != '0;
+    unpack.snan = unpack.nan && !f[ManBits-1];
+    unpack.exp  = exp_t'(e);
+    unpack.sig  = {1'b1, f};
+    // Normalize the subnormal numbers
+    if (e == '0) begin
+      automatic int unsigned lz = ManBits;
+      for (int i = 0; i < ManBits; i++)
+        if (f[i]) lz = ManBits - 1 - i;
+      unpack.sig = sig_t'(f) << (lz + 1);
+      unpack.exp = -exp_t'(lz);
+    end
+  endfunction : unpack
+
+  function automatic logic round_up(roundmode_e rm, logic sign, logic lsb, logic rnd,
+      logic sticky);
+    case (rm)
+      RNE:     return rnd & (sticky | lsb);
+      RDN:     return (rnd | sticky) & sign;
+      RUP:     return (rnd | sticky) & ~sign;
+      RMM:     return rnd;
+      default: return 1'b0; // RTZ
+    endcase
+  endfunction : round_up
+
+  ///////////////////////
+  //  Pipeline stages  //
+  ///////////////////////
+
+  // Input signals for the next stage (= output signals of the previous stage)
+  fdiv_payload_t [NumStages:0]   payload_d, payload_q;
+  logic          [NumStages:0]   valid_d, valid_q;
+  // Ready signal is combinatorial for all stages
+  logic          [NumStages+1:0] stage_ready;
+
+  // Input stage: classify and normalize the operands
+  fdiv_payload_t in_payload;
+
+  always_comb begin : p_fdiv_in
+    in_payload      = '0;
+    in_payload.sqrt = op_i == VFSQRT;
+    in_payload.rm   = rm_i;
+    in_payload.mask = mask_i;
+    for (int e = 0; e < NrElems; e++) begin
+      automatic fp_unpacked_t a = unpack(operand_a_i[ElemBits*e +: ElemBits]);
+      automatic fp_unpacked_t b = unpack(operand_b_i[ElemBits*e +: ElemBits]);
+
+      in_payload.elem[e].en = be_i[e * ElemBits/8];
+      if (in_payload.sqrt) begin
+        // Make the unbiased exponent even, and take the significand to [1, 4)
+        automatic logic odd = ~a.exp[0];
+
+        in_payload.elem[e].sign = a.sign;
+        in_payload.elem[e].exp  = ((a.exp - exp_t'(Bias) - exp_t'(odd)) >>> 1) + exp_t'(Bias);
+        in_payload.elem[e].opnd = opnd_t'(a.sig) << (2*NumSteps - 2 - ManBits + odd);
+
+        in_payload.elem[e].cls = ResFinite;
+        if (a.nan) begin
+          in_payload.elem[e].cls = ResNaN;
+          in_payload.elem[e].nv  = a.snan;
+        end else if (a.zero)
+          in_payload.elem[e].cls = ResZero;
+        else if (a.sign) begin
+          in_payload.elem[e].cls = ResNaN;
+          in_payload.elem[e].nv  = 1'b1;
+        end else if (a.inf)
+          in_payload.elem[e].cls = ResInf;
+      end else begin
+        in_payload.elem[e].sign = a.sign ^ b.sign;
+        in_payload.elem[e].exp  = a.exp - b.exp + exp_t'(Bias);
+        in_payload.elem[e].rem  = rem_t'(a.sig);
+        in_payload.elem[e].opnd = b.sig;
+
+        in_payload.elem[e].cls = ResFinite;
+        if (a.nan || b.nan) begin
+          in_payload.elem[e].cls = ResNaN;
+          in_payload.elem[e].nv  = a.snan || b.snan;
+        end else if ((a.inf && b.inf) || (a.zero && b.zero)) begin
+          in_payload.elem[e].cls = ResNaN;
+          in_payload.elem[e].nv  = 1'b1;
+        end else if (a.inf || b.zero) begin
+          in_payload.elem[e].cls = ResInf;
+          in_payload.elem[e].dz  = b.zero && !a.inf;
+        end else if (a.zero || b.inf)
+          in_payload.elem[e].cls = ResZero;
+      end
+    end
+  end : p_fdiv_in
+
+  assign payload_d[0] = in_payload;
+  assign valid_d[0]   = valid_i;
+
+  // Restoring recurrence. The division subtracts the divisor from the partial remainder if it
+  // fits, and doubles it. The square root shifts the next two radicand bits into the partial
+  // remainder, and subtracts {root, 01} if it fits.
+  for (genvar s = 0; s < NumStages; s++) begin : gen_fdiv_stages
+    fdiv_payload_t stage_res;
+
+    always_comb begin : p_fdiv_stage
+      stage_res = payload_q[s];
+      for (int e = 0; e < NrElems; e++)
+        for (int k = 0; k < StepsPerStage; k++) begin
+          automatic fdiv_elem_t  el = stage_res.elem[e];
+          automatic rem_t        a  = el.rem;
+          automatic rem_t        b  = rem_t'(el.opnd[ManBits:0]);
+          automatic logic [RemBits:0] diff;
+
+          if (stage_res.sqrt) begin
+            a       = {el.rem[RemBits-3:0], el.opnd[2*NumSteps-1 -: 2]};
+            b       = rem_t'({el.quo, 2'b01});
+            el.opnd = el.opnd << 2;
+          end
+          diff = {1'b0, a} - {1'b0, b};
+
+          el.rem = diff[RemBits] ? a : diff[RemBits-1:0];
+          if (!stage_res.sqrt)
+            el.rem = el.rem << 1;
+          el.quo = {el.quo[NumSteps-2:0], ~diff[RemBits]};
+          stage_res.elem[e] = el;
+        end
+    end : p_fdiv_stage
+
+    assign payload_d[s+1] = stage_res;
+    assign valid_d[s+1]   = valid_q[s];
+  end : gen_fdiv_stages
+
+  for (genvar i = 0; i <= NumStages; i++) begin : gen_pipeline_regs
+    // Determine the ready signal of the current stage - advance the pipeline:
+    // 1. if the next stage is ready for our data
+    // 2. if the next stage register only holds a bubble (not valid) -> we can pop it
+    assign stage_ready[i] = stage_ready[i+1] | ~valid_q[i];
+
+    `FFL(valid_q[i], valid_d[i], stage_ready[i], 1'b0)
+    `FFL(payload_q[i], payload_d[i], stage_ready[i] && valid_d[i], '0)
+  end : gen_pipeline_regs
+
+  // Input stage: Propagate ready signal from pipeline
+  assign ready_o = stage_ready[0];
+
+  // Output stage: Ready travels backwards from output side
+  assign stage_ready[NumStages+1] = ready_i;
+  assign valid_o                  = valid_q[NumStages];
+  assign mask_o                   = payload_q[NumStages].mask;
+
+  // Output stage: normalize, round, and handle the special cases
+  always_comb begin : p_fdiv_out
+    automatic roundmode_e rm = payload_q[NumStages].rm;
+
+    result_o = '0;
+    status_o = '0;
+    for (int e = 0; e < NrElems; e++) begin
+      automatic fdiv_elem_t el     = payload_q[NumStages].elem[e];
+      automatic quo_t       sig    = el.quo;
+      automatic exp_t       exp    = el.exp;
+      automatic logic       sticky = el.rem != '0;
+      automatic logic       tiny, inexact, of, to_inf;
+      automatic exp_t       shamt;
+      automatic logic [ElemBits-2:0] res;
+      automatic elem_t      res_e;
+      automatic status_t    flags;
+
+      // The quotient is in (0.5, 2)
+      if (!sig[NumSteps-1]) begin
+        sig = sig << 1;
+        exp = exp - 1;
+      end
+
+      // Tininess after rounding: would the result be subnormal with an unbounded exponent?
+      tiny = exp < 0 || (exp == 0 && !(&sig[NumSteps-2 -: ManBits] &&
+        round_up(rm, el.sign, sig[NumSteps-1-ManBits], sig[NumSteps-2-ManBits],
+          sticky || |sig[NumSteps-3-ManBits:0])));
+
+      // Denormalize the subnormal results
+      shamt   = exp > 0 ? exp_t'(0) : 1 - exp;
+      sticky |= ((sig >> shamt) << shamt) != sig;
+      sig     = sig >> shamt;
+      sticky |= |sig[NumSteps-3-ManBits:0];
+      inexact = sig[NumSteps-2-ManBits] || sticky;
+
+      // Round. A carry out of the mantissa correctly bumps the exponent.
+      res = {exp > 0 ? exp[ExpBits-1:0] : {ExpBits{1'b0}}, sig[NumSteps-2 -: ManBits]};
+      res = res + round_up(rm, el.sign, sig[NumSteps-1-ManBits], sig[NumSteps-2-ManBits],
+        sticky);
+
+      // Overflow
+      of     = exp >= MaxExp || res[ElemBits-2 -: ExpBits] == '1;
+      to_inf = rm inside {RNE, RMM} || (rm == RUP && !el.sign) || (rm == RDN && el.sign);
+      if (of) begin
+        res     = to_inf ? {{ExpBits{1'b1}}, {ManBits{1'b0}}} : {{ExpBits-1{1'b1}}, 1'b0,
+          {ManBits{1'b1}}};
+        inexact = 1'b1;
+      end
+
+      res_e = {el.sign, res};
+      flags = '{NV: 1'b0, DZ: 1'b0, OF: of, UF: tiny && inexact, NX: inexact};
+      unique case (el.cls)
+        ResNaN: begin
+          // Canonical quiet NaN
+          res_e = {1'b0, {ExpBits{1'b1}}, 1'b1, {ManBits-1{1'b0}}};
+          flags = '{NV: el.nv, default: 1'b0};
+        end
+        ResInf: begin
+          res_e = {el.sign, {ExpBits{1'b1}}, {ManBits{1'b0}}};
+          flags = '{DZ: el.dz, default: 1'b0};
+        end
+        ResZero: begin
+          res_e = {el.sign, {ElemBits-1{1'b0}}};
+          flags = '0;
+        end
+        default:;
+      endcase
+
+      // Do not raise exceptions on inactive elements
+      if (el.en) begin
+        result_o[ElemBits*e +: ElemBits] = res_e;
+        status_o                         = status_o | flags;
+      end
+    end
+  end : p_fdiv_out
+
+  if (!(ElementWidth inside {EW16, EW32, EW64}))
+    $error("[simd_fdivsqrt_pipe] Only FP16, FP32, and FP64 elements are supported.");
+
+endmodule : simd_fdivsqrt_pipe
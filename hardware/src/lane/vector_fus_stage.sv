@@ -15,6 +15,10 @@ module vector_fus_stage import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg
     parameter  fpext_support_e        FPExtSupport = FPExtSupportEnable,
     // Support for fixed-point data types
     parameter  fixpt_support_e        FixPtSupport = FixedPointEnable,
+    // Integer divider
+    parameter  div_impl_e             DivImpl      = DivSerial,
+    // Floating-point divide and square root
+    parameter  fdivsqrt_impl_e        FDivSqrtImpl = FDivSqrtSerial,
     // Type used to address vector register file elements
     parameter  type                   vaddr_t      = logic,
     // Dependant parameters. DO NOT CHANGE!
@@ -149,6 +153,8 @@ module vector_fus_stage import ara_pkg::*; import rvv_pkg::*; import cf_math_pkg
     .FPUSupport(FPUSupport),
     .FPExtSupport(FPExtSupport),
     .FixPtSupport(FixPtSupport),
+    .DivImpl     (DivImpl     ),
+    .FDivSqrtImpl(FDivSqrtImpl),
     .vaddr_t   (vaddr_t   )
   ) i_vmfpu (
     .clk_i                (clk_i                           ),
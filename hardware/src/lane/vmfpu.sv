@@ -16,6 +16,10 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
     parameter  fpext_support_e        FPExtSupport = FPExtSupportEnable,
     // Support for fixed-point data types
     parameter  fixpt_support_e        FixPtSupport = FixedPointEnable,
+    // Integer divider
+    parameter  div_impl_e             DivImpl      = DivSerial,
+    // Floating-point divide and square root
+    parameter  fdivsqrt_impl_e        FDivSqrtImpl = FDivSqrtSerial,
     // Type used to address vector register file elements
     parameter  type                   vaddr_t      = logic,
     // Dependant parameters. DO NOT CHANGE!
@@ -185,11 +189,18 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
   //  Helper signals  //
   //////////////////////
 
-  logic vinsn_issue_mul, vinsn_issue_div, vinsn_issue_fpu;
+  logic vinsn_issue_mul, vinsn_issue_div, vinsn_issue_fdiv, vinsn_issue_fpu;
+  logic vinsn_processing_fdiv;
 
-  assign vinsn_issue_mul = vinsn_issue_q.op inside {[VMUL:VSMUL]};
-  assign vinsn_issue_div = vinsn_issue_q.op inside {[VDIVU:VREM]};
-  assign vinsn_issue_fpu = vinsn_issue_q.op inside {[VFADD:VMFGE]};
+  assign vinsn_issue_mul  = vinsn_issue_q.op inside {[VMUL:VSMUL]};
+  assign vinsn_issue_div  = vinsn_issue_q.op inside {[VDIVU:VREM]};
+  // With a pipelined divide and square root unit, FPnew does not receive these operations
+  assign vinsn_issue_fdiv = FDivSqrtImpl != FDivSqrtSerial &&
+                            vinsn_issue_q.op inside {VFDIV, VFRDIV, VFSQRT};
+  assign vinsn_issue_fpu  = vinsn_issue_q.op inside {[VFADD:VMFGE]} && !vinsn_issue_fdiv;
+
+  assign vinsn_processing_fdiv = FDivSqrtImpl != FDivSqrtSerial &&
+                                 vinsn_processing_q.op inside {VFDIV, VFRDIV, VFSQRT};
 
   // This function returns the latency of the FPU operation,
   // depending on the sew as well
@@ -524,22 +535,66 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
   // committed.
   strb_t vdiv_mask;
 
-  simd_div i_simd_div (
-    .clk_i      (clk_i                                                      ),
-    .rst_ni     (rst_ni                                                     ),
-    .operand_a_i(mfpu_operand_i[1]                                          ),
-    .operand_b_i(vinsn_issue_q.use_scalar_op ? scalar_op : mfpu_operand_i[0]),
-    .mask_i     (mask_i                                                     ),
-    .op_i       (vinsn_issue_q.op                                           ),
-    .be_i       (issue_be                                                   ),
-    .vew_i      (vinsn_issue_q.vtype.vsew                                   ),
-    .result_o   (vdiv_result                                                ),
-    .mask_o     (vdiv_mask                                                  ),
-    .valid_i    (vdiv_in_valid                                              ),
-    .ready_o    (vdiv_in_ready                                              ),
-    .ready_i    (vdiv_out_ready                                             ),
-    .valid_o    (vdiv_out_valid                                             )
-  );
+  if (DivImpl == DivSerial) begin : gen_serial_div
+    simd_div i_simd_div (
+      .clk_i      (clk_i                                                      ),
+      .rst_ni     (rst_ni                                                     ),
+      .operand_a_i(mfpu_operand_i[1]                                          ),
+      .operand_b_i(vinsn_issue_q.use_scalar_op ? scalar_op : mfpu_operand_i[0]),
+      .mask_i     (mask_i                                                     ),
+      .op_i       (vinsn_issue_q.op                                           ),
+      .be_i       (issue_be                                                   ),
+      .vew_i      (vinsn_issue_q.vtype.vsew                                   ),
+      .result_o   (vdiv_result                                                ),
+      .mask_o     (vdiv_mask                                                  ),
+      .valid_i    (vdiv_in_valid                                              ),
+      .ready_o    (vdiv_in_ready                                              ),
+      .ready_i    (vdiv_out_ready                                             ),
+      .valid_o    (vdiv_out_valid                                             )
+    );
+  end : gen_serial_div else begin : gen_pipe_div
+    // One pipelined divider per element width. As for the multipliers, only one of them receives
+    // the request, and their outputs are read in order.
+    elen_t [3:0] vdiv_simd_result;
+    strb_t [3:0] vdiv_simd_mask;
+    logic  [3:0] vdiv_simd_in_valid;
+    logic  [3:0] vdiv_simd_in_ready;
+    logic  [3:0] vdiv_simd_out_valid;
+    logic  [3:0] vdiv_simd_out_ready;
+
+    for (genvar ew = EW8; ew <= EW64; ew++) begin : gen_simd_div_pipe
+      simd_div_pipe #(
+        .StepsPerStage(DivImpl == DivPipe4Steps ? 4 : 2),
+        .ElementWidth (vew_e'(ew)                      )
+      ) i_simd_div_pipe (
+        .clk_i      (clk_i                                                      ),
+        .rst_ni     (rst_ni                                                     ),
+        .operand_a_i(mfpu_operand_i[1]                                          ),
+        .operand_b_i(vinsn_issue_q.use_scalar_op ? scalar_op : mfpu_operand_i[0]),
+        .mask_i     (mask_i                                                     ),
+        .op_i       (vinsn_issue_q.op                                           ),
+        .be_i       (issue_be                                                   ),
+        .result_o   (vdiv_simd_result[ew]                                       ),
+        .mask_o     (vdiv_simd_mask[ew]                                         ),
+        .valid_i    (vdiv_simd_in_valid[ew]                                     ),
+        .ready_o    (vdiv_simd_in_ready[ew]                                     ),
+        .ready_i    (vdiv_simd_out_ready[ew]                                    ),
+        .valid_o    (vdiv_simd_out_valid[ew]                                    )
+      );
+    end : gen_simd_div_pipe
+
+    always_comb begin
+      vdiv_simd_in_valid                           = '0;
+      vdiv_simd_in_valid[vinsn_issue_q.vtype.vsew] = vdiv_in_valid;
+      vdiv_in_ready                                = vdiv_simd_in_ready[vinsn_issue_q.vtype.vsew];
+
+      vdiv_result         = vdiv_simd_result[vinsn_processing_q.vtype.vsew];
+      vdiv_mask           = vdiv_simd_mask[vinsn_processing_q.vtype.vsew];
+      vdiv_out_valid      = vdiv_simd_out_valid[vinsn_processing_q.vtype.vsew];
+      vdiv_simd_out_ready = '0;
+      vdiv_simd_out_ready[vinsn_processing_q.vtype.vsew] = vdiv_out_ready;
+    end
+  end : gen_pipe_div
 
   //////////////////
   //  Reductions  //
@@ -722,6 +777,15 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
   logic          fflags_ex_valid_d, fflags_ex_valid_q;
   logic    [4:0] fflags_ex_d, fflags_ex_q;
 
+  // Pipelined divide and square root signals
+  elen_t         vfdiv_result;
+  status_t       vfdiv_ex_flag;
+  strb_t         vfdiv_mask;
+  logic          vfdiv_in_valid;
+  logic          vfdiv_out_valid;
+  logic          vfdiv_in_ready;
+  logic          vfdiv_out_ready;
+
   // In floating-point comparisons the tag is used as mask,
   // In unordered reductions the tag is used as ntr indicator.
   // 0: no neutral value,
@@ -996,6 +1060,73 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
       .busy_o        (/* Unused */   )
     );
 
+    ///////////////////////////////
+    //  Pipelined Divide & Sqrt  //
+    ///////////////////////////////
+
+    if (FDivSqrtImpl != FDivSqrtSerial) begin : gen_fdivsqrt_pipe
+      // One unit per FP format. As for the multipliers, only one of them receives the request,
+      // and their outputs are read in order.
+      elen_t   [3:0] vfdiv_simd_result;
+      status_t [3:0] vfdiv_simd_ex_flag;
+      strb_t   [3:0] vfdiv_simd_mask;
+      logic    [3:0] vfdiv_simd_in_valid;
+      logic    [3:0] vfdiv_simd_in_ready;
+      logic    [3:0] vfdiv_simd_out_valid;
+      logic    [3:0] vfdiv_simd_out_ready;
+
+      for (genvar ew = EW8; ew <= EW64; ew++) begin : gen_simd_fdivsqrt_pipe
+        if ((ew == EW16 && RVVH(FPUSupport)) || (ew == EW32 && RVVF(FPUSupport)) ||
+            (ew == EW64 && RVVD(FPUSupport))) begin : gen_fmt
+          simd_fdivsqrt_pipe #(
+            .StepsPerStage(FDivSqrtImpl == FDivSqrtPipe4Steps ? 4 : 2),
+            .ElementWidth (vew_e'(ew)                                )
+          ) i_simd_fdivsqrt_pipe (
+            .clk_i      (clk_i                      ),
+            .rst_ni     (rst_ni                     ),
+            .operand_a_i(operand_a                  ),
+            .operand_b_i(operand_b                  ),
+            .mask_i     (mask_i                     ),
+            .op_i       (vinsn_issue_q.op           ),
+            .rm_i       (fp_rm                      ),
+            .be_i       (issue_be                   ),
+            .result_o   (vfdiv_simd_result[ew]      ),
+            .status_o   (vfdiv_simd_ex_flag[ew]     ),
+            .mask_o     (vfdiv_simd_mask[ew]        ),
+            .valid_i    (vfdiv_simd_in_valid[ew]    ),
+            .ready_o    (vfdiv_simd_in_ready[ew]    ),
+            .ready_i    (vfdiv_simd_out_ready[ew]   ),
+            .valid_o    (vfdiv_simd_out_valid[ew]   )
+          );
+        end : gen_fmt else begin : gen_no_fmt
+          assign vfdiv_simd_result[ew]    = '0;
+          assign vfdiv_simd_ex_flag[ew]   = '0;
+          assign vfdiv_simd_mask[ew]      = '0;
+          assign vfdiv_simd_in_ready[ew]  = 1'b0;
+          assign vfdiv_simd_out_valid[ew] = 1'b0;
+        end : gen_no_fmt
+      end : gen_simd_fdivsqrt_pipe
+
+      always_comb begin
+        vfdiv_simd_in_valid                           = '0;
+        vfdiv_simd_in_valid[vinsn_issue_q.vtype.vsew] = vfdiv_in_valid;
+        vfdiv_in_ready                                = vfdiv_simd_in_ready[vinsn_issue_q.vtype.vsew];
+
+        vfdiv_result         = vfdiv_simd_result[vinsn_processing_q.vtype.vsew];
+        vfdiv_ex_flag        = vfdiv_simd_ex_flag[vinsn_processing_q.vtype.vsew];
+        vfdiv_mask           = vfdiv_simd_mask[vinsn_processing_q.vtype.vsew];
+        vfdiv_out_valid      = vfdiv_simd_out_valid[vinsn_processing_q.vtype.vsew];
+        vfdiv_simd_out_ready = '0;
+        vfdiv_simd_out_ready[vinsn_processing_q.vtype.vsew] = vfdiv_out_ready;
+      end
+    end : gen_fdivsqrt_pipe else begin : gen_no_fdivsqrt_pipe
+      assign vfdiv_in_ready  = 1'b0;
+      assign vfdiv_result    = '0;
+      assign vfdiv_ex_flag   = '0;
+      assign vfdiv_mask      = '0;
+      assign vfdiv_out_valid = 1'b0;
+    end : gen_no_fdivsqrt_pipe
+
     ////////////////////////
     // VFREC7 & VFRSQRT7 //
     ///////////////////////
@@ -1204,14 +1335,20 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
     end
 
     // Stabilize signals regardless of FPU latency (signals to CVA6)
-    assign fflags_ex_d       = vfpu_ex_flag;
-    assign fflags_ex_valid_d = vfpu_out_valid & vfpu_out_ready;
+    assign fflags_ex_d       = (vfdiv_out_valid & vfdiv_out_ready) ? vfdiv_ex_flag : vfpu_ex_flag;
+    assign fflags_ex_valid_d = (vfpu_out_valid & vfpu_out_ready) |
+                               (vfdiv_out_valid & vfdiv_out_ready);
   end else begin : no_fpu_gen // The FPU is disabled
     assign vfpu_in_ready     = 1'b0;
     assign vfpu_result       = '0;
     assign vfpu_ex_flag      = '0;
     assign vfpu_mask         = '0;
     assign vfpu_out_valid    = 1'b0;
+    assign vfdiv_in_ready    = 1'b0;
+    assign vfdiv_result      = '0;
+    assign vfdiv_ex_flag     = '0;
+    assign vfdiv_mask        = '0;
+    assign vfdiv_out_valid   = 1'b0;
     assign fflags_ex_d       = '0;
     assign fflags_ex_valid_d = 1'b0;
   end : no_fpu_gen
@@ -1270,13 +1407,16 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
 
     // Inputs to the units are not valid by default
     vmul_in_valid = 1'b0;
-    vdiv_in_valid = 1'b0;
-    vfpu_in_valid = 1'b0;
+    vdiv_in_valid  = 1'b0;
+    vfdiv_in_valid = 1'b0;
+    vfpu_in_valid  = 1'b0;
 
     // If the result queue is not full, it is ready to accept a result
-    vmul_out_ready = ~result_queue_full && (vinsn_processing_q.op inside {[VMUL:VSMUL]});
-    vdiv_out_ready = ~result_queue_full && (vinsn_processing_q.op inside {[VDIVU:VREM]});
-    vfpu_out_ready = ~result_queue_full && (vinsn_processing_q.op inside {[VFADD:VMFGE]});
+    vmul_out_ready  = ~result_queue_full && (vinsn_processing_q.op inside {[VMUL:VSMUL]});
+    vdiv_out_ready  = ~result_queue_full && (vinsn_processing_q.op inside {[VDIVU:VREM]});
+    vfdiv_out_ready = ~result_queue_full && vinsn_processing_fdiv;
+    vfpu_out_ready  = ~result_queue_full && (vinsn_processing_q.op inside {[VFADD:VMFGE]}) &&
+                      !vinsn_processing_fdiv;
 
     // Valid of the unit in use (i.e., result queue input valid) is not asserted by default
     unit_out_valid  = 1'b0;
@@ -1379,13 +1519,14 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
         // Is there a vector instruction ready to be issued and do we have all the operands necessary for this instruction?
         if (operands_valid && vinsn_issue_valid && !is_reduction(vinsn_issue_q.op) && issue_cnt_q != '0 && !latency_stall) begin
           // Valiudate the inputs of the correct unit
-          vmul_in_valid = vinsn_issue_mul;
-          vdiv_in_valid = vinsn_issue_div;
-          vfpu_in_valid = vinsn_issue_fpu;
+          vmul_in_valid  = vinsn_issue_mul;
+          vdiv_in_valid  = vinsn_issue_div;
+          vfdiv_in_valid = vinsn_issue_fdiv;
+          vfpu_in_valid  = vinsn_issue_fpu;
 
           // Is the unit in use ready?
           if ((vinsn_issue_mul && vmul_in_ready) || (vinsn_issue_div && vdiv_in_ready) ||
-              (vinsn_issue_fpu && vfpu_in_ready)) begin
+              (vinsn_issue_fdiv && vfdiv_in_ready) || (vinsn_issue_fpu && vfpu_in_ready)) begin
             // Acknowledge the operands of this instruction
             mfpu_operand_ready_o = operands_ready;
 
@@ -1457,9 +1598,15 @@ module vmfpu import ara_pkg::*; import rvv_pkg::*; import fpnew_pkg::*;
             unit_out_mask   = vdiv_mask;
           end
           [VFADD:VMFGE]: begin
-            unit_out_valid  = vfpu_out_valid;
-            unit_out_result = vfpu_processed_result;
-            unit_out_mask   = vfpu_mask;
+            if (vinsn_processing_fdiv) begin
+              unit_out_valid  = vfdiv_out_valid;
+              unit_out_result = vfdiv_result;
+              unit_out_mask   = vfdiv_mask;
+            end else begin
+              unit_out_valid  = vfpu_out_valid;
+              unit_out_result = vfpu_processed_result;
+              unit_out_mask   = vfpu_mask;
+            end
           end
         endcase
 
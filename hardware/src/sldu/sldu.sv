@@ -166,25 +166,10 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
   target_fu_e [NrLanes-1:0] sldu_operand_target_fu_d, sldu_operand_target_fu_q;
 
   // Don't handshake if the operands target the addrgen!
-  // Moreover, when computing NP2 slides, loop over the same data!
   elen_t [NrLanes-1:0] sldu_operand_d;
   logic [NrLanes-1:0]  sldu_operand_valid_d;
   logic [NrLanes-1:0]  sldu_operand_ready_q;
 
-  typedef enum logic {
-    NP2_BUFFER_PNT,
-    NP2_RESULT_PNT
-  } np2_result_queue_pnt_e;
-
-  typedef enum logic {
-    NP2_EXT_SEL,
-    NP2_LOOP_SEL
-  } np2_loop_mux_e;
-  np2_loop_mux_e np2_loop_mux_sel_d, np2_loop_mux_sel_q;
-
-  logic slide_np2_buf_valid_d, slide_np2_buf_valid_q;
-
-
   for (genvar l = 0; l < NrLanes; l++) begin
     spill_register #(
       .T(elen_t)
@@ -199,20 +184,14 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
       .data_o (sldu_operand[l]            )
     );
 
-    assign sldu_operand_d[l] = np2_loop_mux_sel_q == NP2_EXT_SEL
-                             ? sldu_operand_i[l]
-                             : result_queue_q[NP2_BUFFER_PNT][l].wdata;
+    assign sldu_operand_d[l] = sldu_operand_i[l];
 
     assign sldu_operand_valid_d[l] = (sldu_operand_target_fu_q[l] == ALU_SLDU)
-                                   ? (np2_loop_mux_sel_q == NP2_EXT_SEL
-                                     ? sldu_operand_valid_i[l]
-                                     : slide_np2_buf_valid_q)
+                                   ? sldu_operand_valid_i[l]
                                    : 1'b0;
 
     assign sldu_operand_ready_o[l] = (sldu_operand_target_fu_q[l] == ALU_SLDU)
-                                   ? (np2_loop_mux_sel_q == NP2_EXT_SEL
-                                     ? sldu_operand_ready_q[l]
-                                     : 1'b0)
+                                   ? sldu_operand_ready_q[l]
                                    : 1'b0;
   end
 
@@ -258,38 +237,6 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
   // Don't upset the masku with a spurious ready
   assign mask_ready_o = mask_ready_q[0] & mask_valid_i[0] & ~vinsn_issue_q.vm & vinsn_issue_valid_q & !(vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu});
 
-  ///////////////////
-  //  NP2 Support  //
-  ///////////////////
-
-  // The SLDU only supports powers of two (p2) strides
-  // Decompose the non-power-of-two (np2) slide in multiple p2 slides
-
-  // We implement the np2 support here and fully process every input packet
-  // singularly to comply with the undisturbed policy. We cannot use the VRF
-  // as intermediate buffer; each VRF write is a commit.
-
-  typedef logic [idx_width(8*NrLanes)-1:0] stride_t;
-
-  stride_t                                  p2_stride_gen_stride_d;
-  logic                                     p2_stride_gen_valid_d;
-  logic                                     p2_stride_gen_update_d;
-  logic [idx_width(idx_width(8*NrLanes)):0] p2_stride_gen_popc_q;
-  stride_t                                  p2_stride_gen_stride_q;
-  logic                                     p2_stride_gen_valid_q;
-
-  p2_stride_gen #(
-    .NrLanes (NrLanes)
-  ) i_p2_stride_gen (
-    .clk_i       (clk_i                 ),
-    .rst_ni      (rst_ni                ),
-    .stride_i    (p2_stride_gen_stride_d),
-    .valid_i     (p2_stride_gen_valid_d ),
-    .update_i    (p2_stride_gen_update_d),
-    .popc_o      (p2_stride_gen_popc_q  ),
-    .stride_p2_o (p2_stride_gen_stride_q),
-    .valid_o     (p2_stride_gen_valid_q )
-  );
 
   //////////////////
   //  Reductions  //
@@ -331,8 +278,10 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
   // 0: slidedown, 1: slideup
   logic sld_dir;
 
-  // The SLDU slides by powers of two
-  logic [idx_width(4*NrLanes):0] sld_slamt;
+  // Slide amount within a VRF word, in elements. The datapath rotates by any amount in one pass,
+  // and the pointers below take care of the offset across VRF words.
+  typedef logic [idx_width(8*NrLanes)-1:0] stride_t;
+  stride_t sld_slamt;
 
   sldu_op_dp #(
     .NrLanes  (NrLanes    )
@@ -361,11 +310,7 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
     SLIDE_RUN,
     SLIDE_RUN_VSLIDE1UP_FIRST_WORD,
     SLIDE_RUN_OSUM,
-    SLIDE_WAIT_OSUM,
-    SLIDE_NP2_SETUP,
-    SLIDE_NP2_RUN,
-    SLIDE_NP2_COMMIT,
-    SLIDE_NP2_WAIT
+    SLIDE_WAIT_OSUM
   } slide_state_e;
   slide_state_e state_d, state_q;
 
@@ -419,12 +364,6 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
 
     red_stride_cnt_d = red_stride_cnt_q;
 
-    p2_stride_gen_stride_d = '0;
-    p2_stride_gen_valid_d  = 1'b0;
-    p2_stride_gen_update_d = 1'b0;
-
-    np2_loop_mux_sel_d    = np2_loop_mux_sel_q;
-    slide_np2_buf_valid_d = slide_np2_buf_valid_q;
 
     red_stride_cnt_d_wide = {red_stride_cnt_q, red_stride_cnt_q[idx_width(NrLanes)-1]};
 
@@ -449,7 +388,7 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
     unique case (state_q)
       SLIDE_IDLE: begin
         if (vinsn_issue_valid_q) begin
-          state_d   = vinsn_issue_q.is_stride_np2 ? SLIDE_NP2_SETUP : SLIDE_RUN;
+          state_d   = SLIDE_RUN;
           vrf_pnt_d = '0;
 
           unique case (vinsn_issue_q.op)
@@ -518,7 +457,7 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
         end
       end
 
-      SLIDE_RUN, SLIDE_RUN_VSLIDE1UP_FIRST_WORD, SLIDE_NP2_COMMIT: begin
+      SLIDE_RUN, SLIDE_RUN_VSLIDE1UP_FIRST_WORD: begin
         // Are we ready?
         // During a reduction (vinsn_issue_q.vfu == VFU_Alu/VFU_MFPU) don't wait for mask bits
         if ((&sldu_operand_valid ||
@@ -564,9 +503,7 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
           out_pnt_d   = vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu} ? NrLanes * 8                  : out_pnt_q + byte_count;
           issue_cnt_d = vinsn_issue_q.vfu inside {VFU_Alu, VFU_MFpu} ? issue_cnt_q - (NrLanes * 8)  : issue_cnt_q - byte_count;
 
-          // In Jump to SLIDE_RUN if stride is P2
-          if (state_q != SLIDE_NP2_COMMIT)
-            state_d = SLIDE_RUN;
+          state_d = SLIDE_RUN;
 
           // If this is a vslide1up instruction, copy the scalar operand to the first word
           if (state_q == SLIDE_RUN_VSLIDE1UP_FIRST_WORD)
@@ -607,13 +544,6 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
             // wide signal to please the tool
             red_stride_cnt_d_wide = {red_stride_cnt_q, red_stride_cnt_q[idx_width(NrLanes)-1]};
             red_stride_cnt_d      = red_stride_cnt_d_wide[idx_width(NrLanes)-1:0];
-
-            // Reset the input data mux
-            np2_loop_mux_sel_d = NP2_EXT_SEL;
-            if (state_q == SLIDE_NP2_COMMIT) begin
-              // Jump to NP2 setup again
-              state_d = SLIDE_NP2_SETUP;
-            end
           end
 
           // Filled up a word to the VRF or finished the instruction
@@ -633,8 +563,6 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
             result_queue_write_pnt_d                       = result_queue_write_pnt_q + 1;
             if (result_queue_write_pnt_q == ResultQueueDepth-1)
               result_queue_write_pnt_d = '0;
-
-            if (state_q == SLIDE_NP2_COMMIT) state_d = SLIDE_NP2_WAIT;
           end
 
           // Finished the operation
@@ -685,10 +613,6 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
             vinsn_queue_d.issue_cnt -= 1;
           end
         end
-        if (state_q == SLIDE_NP2_COMMIT)
-          if (slide_np2_buf_valid_q && sldu_operand_ready_q[0])
-            // Reset the buffer-valid if the buffer is read, by default
-            slide_np2_buf_valid_d = 1'b0;
       end
       SLIDE_RUN_OSUM: begin
         // Short Note: For ordered sum reduction instruction, only one lane has a valid data, and it is sent to the next lane
@@ -728,52 +652,6 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
         commit_cnt_d = 1'b0;
         state_d      = SLIDE_IDLE;
       end
-      SLIDE_NP2_SETUP: begin
-        // Prepare the write pointer
-        result_queue_write_pnt_d = NP2_BUFFER_PNT;
-        // Prepare the read pointer
-        result_queue_read_pnt_d = NP2_RESULT_PNT;
-        // Setup the mux sel as soon as we get one operand
-        if (sldu_operand_valid_i[0])
-          np2_loop_mux_sel_d = NP2_LOOP_SEL;
-        // Setup the p2-stride generator
-        p2_stride_gen_stride_d = stride_t'(vinsn_issue_q.stride >> vinsn_issue_q.vtype.vsew);
-        p2_stride_gen_valid_d  = 1'b1;
-        // Start processing the first VRF chunk as soon as the result queue is completely empty
-        if (np2_loop_mux_sel_q == NP2_LOOP_SEL && result_queue_empty) begin
-          state_d = SLIDE_NP2_RUN;
-        end
-      end
-      SLIDE_NP2_RUN: begin
-        // Reset the buffer-valid if the buffer is read, by default
-        if (slide_np2_buf_valid_q && sldu_operand_ready_q[0])
-          slide_np2_buf_valid_d = 1'b0;
-        // Setup the current p2 stride
-        sld_slamt = p2_stride_gen_stride_q;
-        // Slide the operands as soon as valid
-        if (&sldu_operand_valid) begin
-          for (int unsigned l = 0; l < NrLanes; l++)
-            result_queue_d[result_queue_write_pnt_q][l].wdata = sld_op_dst[l];
-          slide_np2_buf_valid_d = 1'b1;
-          // Operands correctly read
-          sldu_operand_ready     = '1;
-          // Update the p2 stride
-          p2_stride_gen_update_d = 1'b1;
-          // Commit the final result
-          if (p2_stride_gen_popc_q == {'0, 1'b1} && result_queue_empty) begin
-            state_d = SLIDE_NP2_COMMIT;
-            // Prepare the write pointer
-            result_queue_write_pnt_d = NP2_RESULT_PNT;
-          end
-        end
-      end
-      SLIDE_NP2_WAIT: begin
-        if (result_queue_empty) begin
-          result_queue_read_pnt_d  = NP2_RESULT_PNT;
-          result_queue_write_pnt_d = NP2_RESULT_PNT;
-          state_d = SLIDE_NP2_COMMIT;
-        end
-      end
       default:;
     endcase
 
@@ -809,12 +687,11 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
       (vinsn_commit.vfu inside {VFU_Alu, VFU_MFpu} || (&result_final_gnt_d || commit_cnt_q > (NrLanes * 8))))
       // There is something waiting to be written
       if (!result_queue_empty) begin
-        if (state_q != SLIDE_NP2_SETUP)
-          // Increment the read pointer
-          if (result_queue_read_pnt_q == ResultQueueDepth-1)
-            result_queue_read_pnt_d = 0;
-          else
-            result_queue_read_pnt_d = result_queue_read_pnt_q + 1;
+        // Increment the read pointer
+        if (result_queue_read_pnt_q == ResultQueueDepth-1)
+          result_queue_read_pnt_d = 0;
+        else
+          result_queue_read_pnt_d = result_queue_read_pnt_q + 1;
 
         // Decrement the counter of results waiting to be written
         result_queue_cnt_d -= 1;
@@ -897,8 +774,6 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
       pe_resp_o             <= '0;
       result_final_gnt_q    <= '0;
       red_stride_cnt_q      <= 1;
-      np2_loop_mux_sel_q    <= NP2_EXT_SEL;
-      slide_np2_buf_valid_q <= 1'b0;
     end else begin
       vinsn_running_q       <= vinsn_running_d;
       issue_cnt_q           <= issue_cnt_d;
@@ -911,8 +786,6 @@ module sldu import ara_pkg::*; import rvv_pkg::*; #(
       pe_resp_o             <= pe_resp;
       result_final_gnt_q    <= result_final_gnt_d;
       red_stride_cnt_q      <= red_stride_cnt_d;
-      np2_loop_mux_sel_q    <= np2_loop_mux_sel_d;
-      slide_np2_buf_valid_q <= slide_np2_buf_valid_d;
     end
   end
 
@@ -40,6 +40,10 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
     output logic                           axi_addrgen_req_valid_o,
     input  logic                           ldu_axi_addrgen_req_ready_i,
     input  logic                           stu_axi_addrgen_req_ready_i,
+    // Faults of the fault-only-first loads, from the load unit
+    input  logic                           ldu_fof_valid_i,
+    input  logic                           ldu_fof_error_i,
+    input  vlen_t                          ldu_fof_error_vl_i,
     // Interface with the lanes (for scatter/gather operations)
     input  elen_t            [NrLanes-1:0] addrgen_operand_i,
     input  target_fu_e       [NrLanes-1:0] addrgen_operand_target_fu_i,
@@ -117,7 +121,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
   axi_addr_t                        idx_final_addr_d, idx_final_addr_q;
   elen_t                            idx_addr;
   logic                             idx_op_error_d, idx_op_error_q;
-  vlen_t                            addrgen_error_vl_d;
+  vlen_t                            addrgen_error_vl_d, addrgen_error_vl_q;
 
   // Pointer to point to the correct
   logic [$clog2(NrLanes)-1:0] word_lane_ptr_d, word_lane_ptr_q;
@@ -156,13 +160,19 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
   // ADDRGEN_IDX_OP: Generates a series of AXI requests from a
   //    vector instruction, but reading a vector of offsets from Ara's lanes.
   //    This is used for scatter and gather operations.
-  enum logic [1:0] {
+  // ADDRGEN_FOF: Waits for the load unit to receive all the beats of a fault-only-first load,
+  //    to know whether it faulted, and where.
+  enum logic [2:0] {
     IDLE,
     ADDRGEN,
     ADDRGEN_IDX_OP,
-    ADDRGEN_IDX_OP_END
+    ADDRGEN_IDX_OP_END,
+    ADDRGEN_FOF
   } state_q, state_d;
 
+  // The faulting element of a fault-only-first load comes from the load unit
+  assign addrgen_error_vl_o = (state_q == ADDRGEN_FOF) ? ldu_fof_error_vl_i : addrgen_error_vl_q;
+
   always_comb begin: addr_generation
     // Maintain state
     state_d  = state_q;
@@ -257,9 +267,21 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
             addrgen_req_valid = '0;
             addrgen_ack_o     = 1'b1;
             state_d           = IDLE;
+            // Stall the interface until the load is over to catch possible faults
+            if (pe_req_q.fault_only_first) begin
+              addrgen_ack_o = 1'b0;
+              state_d       = ADDRGEN_FOF;
+            end
           end
         end
       end
+      ADDRGEN_FOF: begin
+        if (ldu_fof_valid_i) begin
+          addrgen_ack_o   = 1'b1;
+          addrgen_error_o = ldu_fof_error_i;
+          state_d         = IDLE;
+        end
+      end
       ADDRGEN_IDX_OP: begin
         // Stall the interface until the operation is over to catch possible exceptions
 
@@ -371,7 +393,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
       idx_op_cnt_q       <= '0;
       last_elm_subw_q    <= '0;
       idx_op_error_q     <= '0;
-      addrgen_error_vl_o <= '0;
+      addrgen_error_vl_q <= '0;
     end else begin
       state_q            <= state_d;
       pe_req_q           <= pe_req_d;
@@ -381,7 +403,7 @@ module addrgen import ara_pkg::*; import rvv_pkg::*; #(
       idx_op_cnt_q       <= idx_op_cnt_d;
       last_elm_subw_q    <= last_elm_subw_d;
       idx_op_error_q     <= idx_op_error_d;
-      addrgen_error_vl_o <= addrgen_error_vl_d;
+      addrgen_error_vl_q <= addrgen_error_vl_d;
     end
   end
 
@@ -37,6 +37,10 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
     input  addrgen_axi_req_t               axi_addrgen_req_i,
     input  logic                           axi_addrgen_req_valid_i,
     output logic                           axi_addrgen_req_ready_o,
+    // Fault-only-first loads: first faulting element, once all the R beats were received
+    output logic                           ldu_fof_valid_o,
+    output logic                           ldu_fof_error_o,
+    output vlen_t                          ldu_fof_error_vl_o,
     // Interface with the lanes
     output logic             [NrLanes-1:0] ldu_result_req_o,
     output vid_t             [NrLanes-1:0] ldu_result_id_o,
@@ -192,6 +196,13 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
   // - A pointer to which byte in the full VRF word we are writing data into.
   logic [idx_width(DataWidth*NrLanes/8):0] vrf_pnt_d, vrf_pnt_q;
 
+  // Fault-only-first loads. An R beat with an error response is a fault of the first element
+  // it carries. The elements after it are written anyway, since they are past the new vl.
+  logic  fof_error_d, fof_error_q;
+  vlen_t fof_error_vl_d, fof_error_vl_q;
+  logic  ldu_fof_valid_d, ldu_fof_error_d;
+  vlen_t ldu_fof_error_vl_d;
+
   always_comb begin: p_vldu
     // Maintain state
     vinsn_queue_d = vinsn_queue_q;
@@ -202,6 +213,12 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
     r_pnt_d   = r_pnt_q;
     vrf_pnt_d = vrf_pnt_q;
 
+    fof_error_d        = fof_error_q;
+    fof_error_vl_d     = fof_error_vl_q;
+    ldu_fof_valid_d    = 1'b0;
+    ldu_fof_error_d    = 1'b0;
+    ldu_fof_error_vl_d = '0;
+
     result_queue_d           = result_queue_q;
     result_queue_valid_d     = result_queue_valid_q;
     result_queue_read_pnt_d  = result_queue_read_pnt_q;
@@ -259,6 +276,14 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
         r_pnt_d   = r_pnt_q + valid_bytes;
         vrf_pnt_d = vrf_pnt_q + valid_bytes;
 
+        // Record the first faulting element of a fault-only-first load
+        if (vinsn_issue_q.fault_only_first && !fof_error_q &&
+            axi_r_i.resp inside {axi_pkg::RESP_SLVERR, axi_pkg::RESP_DECERR}) begin
+          fof_error_d    = 1'b1;
+          fof_error_vl_d = ((vinsn_issue_q.vl << int'(vinsn_issue_q.vtype.vsew)) - issue_cnt_q +
+            vrf_pnt_q) >> int'(vinsn_issue_q.vtype.vsew);
+        end
+
         // Copy data from the R channel into the result queue
         for (int axi_byte = 0; axi_byte < AxiDataWidth/8; axi_byte++) begin
           // Is this byte a valid byte in the R beat?
@@ -335,6 +360,14 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
 
       // Finished issuing results
       if (vinsn_issue_valid && issue_cnt_d == '0) begin
+        // All the beats of a fault-only-first load were received
+        if (vinsn_issue_q.fault_only_first) begin
+          ldu_fof_valid_d    = 1'b1;
+          ldu_fof_error_d    = fof_error_d;
+          ldu_fof_error_vl_d = fof_error_vl_d;
+          fof_error_d        = 1'b0;
+        end
+
         // Increment vector instruction queue pointers and counters
         vinsn_queue_d.issue_cnt -= 1;
         if (vinsn_queue_q.issue_pnt == VInsnQueueDepth-1)
@@ -447,6 +480,11 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
       vrf_pnt_q          <= '0;
       pe_resp_o          <= '0;
       result_final_gnt_q <= '0;
+      fof_error_q        <= 1'b0;
+      fof_error_vl_q     <= '0;
+      ldu_fof_valid_o    <= 1'b0;
+      ldu_fof_error_o    <= 1'b0;
+      ldu_fof_error_vl_o <= '0;
     end else begin
       vinsn_running_q    <= vinsn_running_d;
       issue_cnt_q        <= issue_cnt_d;
@@ -456,6 +494,11 @@ module vldu import ara_pkg::*; import rvv_pkg::*; #(
       vrf_pnt_q          <= vrf_pnt_d;
       pe_resp_o          <= pe_resp;
       result_final_gnt_q <= result_final_gnt_d;
+      fof_error_q        <= fof_error_d;
+      fof_error_vl_q     <= fof_error_vl_d;
+      ldu_fof_valid_o    <= ldu_fof_valid_d;
+      ldu_fof_error_o    <= ldu_fof_error_d;
+      ldu_fof_error_vl_o <= ldu_fof_error_vl_d;
     end
   end
 
@@ -109,6 +109,10 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
   logic             axi_addrgen_req_valid;
   logic             ldu_axi_addrgen_req_ready;
   logic             stu_axi_addrgen_req_ready;
+  // Faults of the fault-only-first loads
+  logic             ldu_fof_valid;
+  logic             ldu_fof_error;
+  vlen_t            ldu_fof_error_vl;
 
   addrgen #(
     .NrLanes     (NrLanes     ),
@@ -144,7 +148,10 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
     .axi_addrgen_req_o          (axi_addrgen_req            ),
     .axi_addrgen_req_valid_o    (axi_addrgen_req_valid      ),
     .ldu_axi_addrgen_req_ready_i(ldu_axi_addrgen_req_ready  ),
-    .stu_axi_addrgen_req_ready_i(stu_axi_addrgen_req_ready  )
+    .stu_axi_addrgen_req_ready_i(stu_axi_addrgen_req_ready  ),
+    .ldu_fof_valid_i            (ldu_fof_valid              ),
+    .ldu_fof_error_i            (ldu_fof_error              ),
+    .ldu_fof_error_vl_i         (ldu_fof_error_vl           )
   );
 
   ////////////////////////
@@ -176,6 +183,9 @@ module vlsu import ara_pkg::*; import rvv_pkg::*; #(
     .axi_addrgen_req_i      (axi_addrgen_req           ),
     .axi_addrgen_req_valid_i(axi_addrgen_req_valid     ),
     .axi_addrgen_req_ready_o(ldu_axi_addrgen_req_ready ),
+    .ldu_fof_valid_o        (ldu_fof_valid             ),
+    .ldu_fof_error_o        (ldu_fof_error             ),
+    .ldu_fof_error_vl_o     (ldu_fof_error_vl          ),
     // Interface with the Mask unit
     .mask_i                 (mask_i                    ),
     .mask_valid_i           (mask_valid_i              ),
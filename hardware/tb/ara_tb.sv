@@ -167,10 +167,10 @@ module ara_tb;
     $display("Dump results on %s", OutResultFile);
   end
 
-  assign ara_w       = dut.i_ara_soc.i_system.i_ara.i_vlsu.axi_req.w.data;
-  assign ara_w_strb  = dut.i_ara_soc.i_system.i_ara.i_vlsu.axi_req.w.strb;
-  assign ara_w_valid = dut.i_ara_soc.i_system.i_ara.i_vlsu.axi_req.w_valid;
-  assign ara_w_ready = dut.i_ara_soc.i_system.i_ara.i_vlsu.axi_resp.w_ready;
+  assign ara_w       = dut.i_ara_soc.gen_tiles[0].i_system.i_ara.i_vlsu.axi_req.w.data;
+  assign ara_w_strb  = dut.i_ara_soc.gen_tiles[0].i_system.i_ara.i_vlsu.axi_req.w.strb;
+  assign ara_w_valid = dut.i_ara_soc.gen_tiles[0].i_system.i_ara.i_vlsu.axi_req.w_valid;
+  assign ara_w_ready = dut.i_ara_soc.gen_tiles[0].i_system.i_ara.i_vlsu.axi_resp.w_ready;
 
 `ifndef IDEAL_DISPATCHER
   assign dump_en_mask = dut.i_ara_soc.hw_cnt_en_o[0];
@@ -254,7 +254,7 @@ module ara_tb;
   initial begin
     @(start_dump_event);
     $dumpfile(vcd_path);
-    $dumpvars(0, dut.i_ara_soc.i_system);
+    $dumpvars(0, dut.i_ara_soc.gen_tiles[0].i_system);
     $dumpon;
 
     #1 $display("[TB - VCD] DUMPING...\n");
@@ -65,8 +65,36 @@ module ara_testharness #(
    *  SoC  *
    *********/
 
+  // Integer divider in the lanes, chosen with the div_impl Makefile variable
+  localparam ara_pkg::div_impl_e DivImpl =
+`ifdef DIV_IMPL
+    ara_pkg::div_impl_e'(`DIV_IMPL);
+`else
+    ara_pkg::DivSerial;
+`endif
+
+  // Floating-point divide and square root in the lanes, chosen with the fdivsqrt_impl Makefile
+  // variable
+  localparam ara_pkg::fdivsqrt_impl_e FDivSqrtImpl =
+`ifdef FDIVSQRT_IMPL
+    ara_pkg::fdivsqrt_impl_e'(`FDIVSQRT_IMPL);
+`else
+    ara_pkg::FDivSqrtSerial;
+`endif
+
+  // Number of Ariane+Ara tiles, chosen with the nr_tiles Makefile variable
+  localparam int unsigned NrTiles =
+`ifdef NR_TILES
+    `NR_TILES;
+`else
+    1;
+`endif
+
   ara_soc #(
     .NrLanes     (NrLanes      ),
+    .DivImpl     (DivImpl      ),
+    .FDivSqrtImpl(FDivSqrtImpl ),
+    .NrTiles     (NrTiles      ),
     .AxiAddrWidth(AxiAddrWidth ),
     .AxiDataWidth(AxiDataWidth ),
     .AxiIdWidth  (AxiIdWidth   ),
@@ -153,11 +181,11 @@ module ara_testharness #(
     // If disabled
     if (!runtime_cnt_en_q)
       // Start only if the software allowed the enable and we detect the first V instruction
-      runtime_cnt_en_d = i_ara_soc.i_system.i_ara.acc_req_i.req_valid & cnt_en_mask;
+      runtime_cnt_en_d = i_ara_soc.gen_tiles[0].i_system.i_ara.acc_req_i.req_valid & cnt_en_mask;
     // If enabled
     if (runtime_cnt_en_q)
       // Stop counting only if the software disabled the counter and Ara returned idle
-      runtime_cnt_en_d = cnt_en_mask | ~i_ara_soc.i_system.i_ara.ara_idle;
+      runtime_cnt_en_d = cnt_en_mask | ~i_ara_soc.gen_tiles[0].i_system.i_ara.ara_idle;
   end
 
   // Vector runtime counter
@@ -177,14 +205,14 @@ module ara_testharness #(
     runtime_to_be_updated_d = runtime_to_be_updated_q;
 
     // Assert the update flag upon a new valid vector instruction
-    if (!runtime_to_be_updated_q && i_ara_soc.i_system.i_ara.acc_req_i.req_valid) begin
+    if (!runtime_to_be_updated_q && i_ara_soc.gen_tiles[0].i_system.i_ara.acc_req_i.req_valid) begin
       runtime_to_be_updated_d = 1'b1;
     end
 
     // Update the internal runtime and reset the update flag
     if (runtime_to_be_updated_q           &&
-        i_ara_soc.i_system.i_ara.ara_idle &&
-        !i_ara_soc.i_system.i_ara.acc_req_i.req_valid) begin
+        i_ara_soc.gen_tiles[0].i_system.i_ara.ara_idle &&
+        !i_ara_soc.gen_tiles[0].i_system.i_ara.acc_req_i.req_valid) begin
       runtime_buf_d = runtime_cnt_q;
       runtime_to_be_updated_d = 1'b0;
     end
@@ -24,6 +24,10 @@ module ara_verilog_wrap
     parameter fpext_support_e            FPExtSupport          = FPExtSupportEnable,
     // Support for fixed-point data types
     parameter fixpt_support_e            FixPtSupport          = FixedPointEnable,
+    // Integer divider in the lanes
+    parameter div_impl_e                 DivImpl               = DivSerial,
+    // Floating-point divide and square root in the lanes
+    parameter fdivsqrt_impl_e            FDivSqrtImpl          = FDivSqrtSerial,
     // AXI Interface
     parameter int unsigned               AxiDataWidth          = 32*NrLanes,
     parameter int unsigned               AxiAddrWidth          = 64,
@@ -345,6 +349,8 @@ module ara_verilog_wrap
     .FPUSupport  (FPUSupport       ),
     .FPExtSupport(FPExtSupport     ),
     .FixPtSupport(FixPtSupport     ),
+    .DivImpl     (DivImpl          ),
+    .FDivSqrtImpl(FDivSqrtImpl     ),
     .AxiDataWidth(AxiWideDataWidth ),
     .AxiAddrWidth(AxiAddrWidth     ),
     .axi_ar_t    (ara_axi_ar_chan_t),
@@ -508,7 +508,10 @@ module ara_verilog_wrap
     .dram_base_addr_o     (/* Unused */                ),
     .dram_end_addr_o      (/* Unused */                ),
     .exit_o               (exit_o                      ),
-    .event_trigger_o      (event_trigger)
+    .event_trigger_o      (event_trigger),
+    // No invalidation filter in OpenPiton
+    .inval_lines_i        ('0                          ),
+    .inval_issued_i       ('0                          )
   );
 
 
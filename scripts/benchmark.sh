@@ -95,6 +95,10 @@ extract_performance() {
     echo "Checking hw and sw cycles. $python ./scripts/check_cycles.py $kernel $hw_cycles $sw_cycles"
     $python ./scripts/check_cycles.py $kernel $hw_cycles $sw_cycles || exit
   fi
+  # Log the raw cycle count, if asked to (e.g., by sweep.sh)
+  if [[ -n "${cycles_log}" && ! $outfile =~ "ideal" ]]; then
+    echo "${args} ${hw_cycles}" >> ${cycles_log}
+  fi
   echo "Extracting performance from cycle count"
   $python ./scripts/performance.py $kernel "$args" $hw_cycles >> $outfile || exit
 }
@@ -616,7 +620,7 @@ pathfinder() {
   > ${kernel}_${nr_lanes}.benchmark
   > ${kernel}_${nr_lanes}_ideal.benchmark
 
-  for cols in 4 8 16 32 64 128 256 512 1024; do
+  for cols in 4 8 16 32 64 128 256 512 1024 2048 4096; do
     for rows in 64; do
 
       args="$runs $cols $rows"
@@ -680,6 +684,85 @@ roi_align() {
   done
 }
 
+#############
+## STENCIL ##
+#############
+
+stencil() {
+
+  kernel=stencil
+  defines=""
+
+  # 9-point 2D stencil
+  dims=2
+  shape=box
+  radius=1
+  tsteps=1
+
+  tempfile=`mktemp`
+
+  # Log the performance results
+  > ${kernel}_${nr_lanes}.benchmark
+  > ${kernel}_${nr_lanes}_ideal.benchmark
+
+  for size in 8 16 32 64 128; do
+
+    args="$dims $shape $radius $size $tsteps"
+
+    clean_and_gen_data $kernel "$args" || exit
+
+    # Default System
+    compile_and_run $kernel "$defines" $tempfile 0                                || exit
+    extract_performance $kernel "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+
+    # Ideal Dispatcher System, if QuestaSim is available
+    if [ "$ci" == 0 ]; then
+      compile_and_run $kernel "$defines" $tempfile 1                                      || exit
+      extract_performance $kernel "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+      # Verify ID results is non-blocking! Check the report afterwards
+      verify_id_results 0 | tee -a ${error_rpt}
+    fi
+  done
+}
+
+##########
+## VRED ##
+##########
+
+vred() {
+
+  kernel=vred
+  defines=""
+
+  # Average segment length (unused by the benchmark)
+  seglen=16
+
+  tempfile=`mktemp`
+
+  # Log the performance results
+  > ${kernel}_${nr_lanes}.benchmark
+  > ${kernel}_${nr_lanes}_ideal.benchmark
+
+  for size in 64 256 1024 4096 16384; do
+
+    args="$size $seglen"
+
+    clean_and_gen_data $kernel "$args" || exit
+
+    # Default System
+    compile_and_run $kernel "$defines" $tempfile 0                                || exit
+    extract_performance $kernel "$args" $tempfile ${kernel}_${nr_lanes}.benchmark || exit
+
+    # Ideal Dispatcher System, if QuestaSim is available
+    if [ "$ci" == 0 ]; then
+      compile_and_run $kernel "$defines" $tempfile 1                                      || exit
+      extract_performance $kernel "$args" $tempfile ${kernel}_${nr_lanes}_ideal.benchmark || exit
+      # Verify ID results is non-blocking! Check the report afterwards
+      verify_id_results 0 | tee -a ${error_rpt}
+    fi
+  done
+}
+
 case $1 in
   "imatmul" | "fmatmul")
     matmul $1
@@ -733,6 +816,14 @@ case $1 in
     roi_align
     ;;
 
+  "stencil")
+    stencil
+    ;;
+
+  "vred")
+    vred
+    ;;
+
   *)
     echo "Benchmarking all the apps."
     matmul imatmul
@@ -750,5 +841,7 @@ case $1 in
     dotproduct
     pathfinder
     roi_align
+    stencil
+    vred
     ;;
 esac
@@ -37,6 +37,8 @@ threshold = {
   'softmax'    : 500,
   'pathfinder' : 500,
   'roi_align'  : 500,
+  'stencil'    : 500,
+  'vred'       : 500,
 }
 
 skip_check = {
@@ -53,6 +55,8 @@ skip_check = {
   'softmax'    : 0,
   'pathfinder' : 0,
   'roi_align'  : 1, # This program has a larger scalar component
+  'stencil'    : 0,
+  'vred'       : 0,
 }
 
 def main():
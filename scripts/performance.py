@@ -105,6 +105,19 @@ def roi_align(args, cycles):
   crop_w  = int(args[6])
   performance = 9 * batch * depth * n_boxes * crop_h * crop_w / cycles
   return [depth, performance]
+def stencil(args, cycles):
+  dims    = int(args[0])
+  shape   = args[1]
+  radius  = int(args[2])
+  size    = int(args[3])
+  tsteps  = int(args[4])
+  taps    = (2 * radius + 1) ** dims if shape == 'box' else 2 * dims * radius + 1
+  performance = 2 * taps * (size - 2 * radius) ** dims * tsteps / cycles
+  return [size, performance]
+def vred(args, cycles):
+  size        = int(args[0])
+  performance = size / cycles
+  return [size, performance]
 
 perfExtr = {
   'imatmul'    : imatmul,
@@ -120,6 +133,8 @@ perfExtr = {
   'softmax'    : softmax,
   'pathfinder' : pathfinder,
   'roi_align'  : roi_align,
+  'stencil'    : stencil,
+  'vred'       : vred,
 }
 
 def main():
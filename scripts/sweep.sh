@@ -0,0 +1,66 @@
+#!/usr/bin/env bash
+# sweep.sh $knob "$values" ["$kernels"]
+# Sweep a hardware parameter of the configuration (e.g., insn_queue_depth,
+# vlsu_insn_queue_depth, sldu_insn_queue_depth, nr_vinsn) over the given
+# values, and benchmark each kernel (default: fmatmul fconv2d fconv3d) on
+# every resulting system with benchmark.sh, in Verilator.
+# E.g.: config=16_lanes ./scripts/sweep.sh insn_queue_depth "2 4 8"
+#
+# For every kernel, ${kernel}_${nr_lanes}_${knob}.sweep lists, per line, the
+# value of the knob, the arguments of the kernel (problem size), and the
+# cycle count.
+#
+# When this script is called, CLANG_PATH should point to the
+# clang directory used to verilate the design
+
+# Useful dirs
+script=$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && pwd )
+root=${script}/..
+hardware=$root/hardware
+
+knob=$1
+values=$2
+kernels=${3:-"fmatmul fconv2d fconv3d"}
+
+if [ -z "${knob}" ] || [ -z "${values}" ]; then
+  echo "Usage: $0 knob \"values\" [\"kernels\"]"
+  exit 1
+fi
+
+# Include Ara's configuration
+if [ -z ${config} ]; then
+  if [ -z ${ARA_CONFIGURATION} ]; then
+    config=default
+  else
+    config=${ARA_CONFIGURATION}
+  fi
+fi
+
+tmpscript=`mktemp`
+sed "s/ ?= /=/g" $root/config/${config}.mk > $tmpscript
+source ${tmpscript}
+
+# Move to root directory
+cd $root
+
+for kernel in $kernels; do
+  > ${kernel}_${nr_lanes}_${knob}.sweep
+done
+
+for value in $values; do
+  # The knob reaches the hardware Makefile through the environment
+  export ${knob}=${value}
+  config=${config} CLANG_PATH=${CLANG_PATH} make -B -C $hardware verilate || exit
+  for kernel in $kernels; do
+    cycles_log=`mktemp`
+    config=${config} cycles_log=${cycles_log} $script/benchmark.sh ci $kernel || exit
+    sed "s/^/${value} /" ${cycles_log} >> ${kernel}_${nr_lanes}_${knob}.sweep
+    rm ${cycles_log}
+  done
+done
+
+# Summary
+for kernel in $kernels; do
+  echo "${kernel} (${nr_lanes} lanes): ${knob} args... cycles"
+  cat ${kernel}_${nr_lanes}_${knob}.sweep
+done